@@ -0,0 +1,104 @@
+/**
+ * @file BitBoard.h
+ * @brief Definition of BitBoard, the living cells of a region packed one bit
+ *  per cell.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_BITBOARD_H
+#define GAMEOFLIFE_BITBOARD_H
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+class Population;
+
+/**
+  * @addtogroup Sim Cell classes
+  * @brief Classes that represent the cells and population of cells in the Game Of Life.
+  * @{
+  */
+
+/**
+ * @brief Rectangle of cells stored as bits, set for living cells.
+ * @details Each row is packed into 64 bit words, the lowest bit holding the
+ *  leftmost cell. Counting the living cells of a block is then a popcount per
+ *  word instead of a lookup per cell.
+ */
+class BitBoard {
+private:
+    int width;              /*!< Number of cells per row */
+    int height;             /*!< Number of rows */
+    int wordsPerRow;        /*!< Words holding one row */
+    vector<uint64_t> words; /*!< Rows stored one after another */
+
+public:
+    /**
+     * @brief Constructs an empty board.
+     */
+    BitBoard() : width(0), height(0), wordsPerRow(0) {}
+
+    /**
+     * @brief Clears the board and resizes it to width x height cells.
+     */
+    void reset(int width, int height);
+
+    /**
+     * @brief Packs a rectangle of the world of a population.
+     * @details The rectangle is given in world coordinates, where (0, 0) is the
+     *  first cell inside the rim. Positions outside the world are dead. The
+     *  cells are read with Population::readRegion().
+     *
+     * @param population Population holding the world.
+     * @param left First column of the rectangle.
+     * @param top First row of the rectangle.
+     * @param width Number of columns to pack.
+     * @param height Number of rows to pack.
+     *
+     * @test Test that living cells of the rectangle end up as set bits.
+     */
+    void capture(Population& population, int left, int top, int width, int height);
+
+    /**
+     * @brief Marks the cell at (x, y) as living or dead.
+     */
+    void set(int x, int y, bool alive) {
+        uint64_t bit = 1ULL << (x % 64);
+        uint64_t& word = words[y * wordsPerRow + x / 64];
+        word = alive ? (word | bit) : (word & ~bit);
+    }
+
+    /**
+     * @brief Returns whether the cell at (x, y) is alive.
+     */
+    bool get(int x, int y) const { return (words[y * wordsPerRow + x / 64] >> (x % 64)) & 1; }
+
+    /**
+     * @brief Counts the living cells in a block, clipped to the board.
+     *
+     * @test Test that blocks spanning several words are counted correctly.
+     */
+    int countBlock(int left, int top, int width, int height) const;
+
+    /**
+     * @brief Returns the number of set bits in word.
+     */
+    static int popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(word);
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+}; /** @} */
+
+#endif //GAMEOFLIFE_BITBOARD_H
@@ -27,6 +27,13 @@ struct StateColors {
  */
 const STATE_COLORS = { COLOR::WHITE, COLOR::BLACK, COLOR::CYAN, COLOR::MAGENTA };
 
+/**
+ * @brief Colors of dying cells, from just died to almost dead.
+ * @details Used by rules whose cells fade through several states before they
+ *  are dead.
+ */
+const COLOR DYING_COLORS[] = { COLOR::RED, COLOR::YELLOW, COLOR::GREEN, COLOR::BLUE };
+
 /**
  * @brief Enumeration of possible cell actions. Determined by rule.
  */
@@ -130,7 +137,16 @@ public:
      * 
      * @test Test that the function returns true when age is larger than zero.
      */
-    bool isAlive();
+    bool isAlive() { return !details.rimCell && details.age > 0; }
+
+    /**
+     * @brief Returns true if the cell is alive once its next generation
+     *  action has been carried out by updateState().
+     */
+    bool isAliveAfterUpdate() {
+        ACTION action = nextUpdate.nextGenerationAction;
+        return action == GIVE_CELL_LIFE || (action != KILL_CELL && isAlive());
+    }
 
     /**
      * @brief Set the NextGenerationAction in NextUpdate to action.
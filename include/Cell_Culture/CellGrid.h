@@ -0,0 +1,195 @@
+/**
+ * @file CellGrid.h
+ * @brief Definition of CellGrid, contiguous storage of all cells in the world.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_CELLGRID_H
+#define GAMEOFLIFE_CELLGRID_H
+
+#include <stdexcept>
+#include <vector>
+#include "Cell.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+  * @addtogroup Sim Cell classes
+  * @brief Classes that represent the cells and population of cells in the Game Of Life.
+  * @{
+  */
+
+/**
+ * @brief All cells of the world, rim included, stored row by row in a single
+ *  block of memory.
+ * @details Replaces the std::map<Point, Cell> that used to hold the cells, and
+ *  keeps the parts of its interface the simulation relies on: lookup by Point
+ *  with operator[] and at(), size(), and iteration yielding entries with the
+ *  Point as first and the Cell as second. Iteration visits the cells column by
+ *  column, in the same order as the map did.
+ *
+ *  The outermost ring of the grid lies outside the simulated world. In a
+ *  BOUNDED world it holds rim cells, in a TORUS it is a halo holding copies of
+ *  the cells on the opposite edge, refreshed by refreshHalo(). Either way code
+ *  walking the world can stay within the ring, without checking for rim cells.
+ *
+ *  Since Cell is trivially destructible, tearing down a grid is a single
+ *  deallocation no matter how many cells it holds. Cells can also be reached
+ *  by linear index, row * getColumns() + column, for code that walks the grid
+ *  directly.
+ */
+class CellGrid {
+private:
+    int columns;        /*!< Number of columns, rim included */
+    int rows;           /*!< Number of rows, rim included */
+    vector<Cell> cells; /*!< Cells stored row by row */
+    TOPOLOGY topology;  /*!< Behaviour of the edges */
+
+    /**
+     * @brief Enlarges the grid so that it includes position, keeping the
+     *  cells already stored at their positions.
+     */
+    void growToInclude(Point position);
+
+public:
+    /**
+     * @brief Cell together with its position, as returned by the iterators.
+     */
+    struct Entry {
+        const Point first;  /*!< Position of the cell */
+        Cell& second;       /*!< The cell */
+    };
+
+    /**
+     * @brief Forward iterator visiting the cells column by column.
+     */
+    class iterator {
+    private:
+        CellGrid* grid;
+        int position;   /*!< column * rows + row */
+
+        /**
+         * @brief Holds an Entry so that operator-> can return a pointer to it.
+         */
+        struct EntryPointer {
+            Entry entry;
+            Entry* operator->() { return &entry; }
+        };
+
+    public:
+        iterator(CellGrid* grid, int position) : grid(grid), position(position) {}
+
+        Entry operator*() const {
+            Point point{position / grid->rows, position % grid->rows};
+            return Entry{point, grid->cells[point.y * grid->columns + point.x]};
+        }
+        EntryPointer operator->() const { return EntryPointer{**this}; }
+
+        iterator& operator++() { position++; return *this; }
+        iterator operator++(int) { iterator previous = *this; position++; return previous; }
+
+        bool operator==(const iterator& other) const { return position == other.position; }
+        bool operator!=(const iterator& other) const { return position != other.position; }
+    };
+
+    /**
+     * @brief Constructs an empty grid.
+     */
+    CellGrid() : columns(0), rows(0), topology(BOUNDED) {}
+
+    /**
+     * @brief Replaces all cells with default constructed cells in a grid of
+     *  the given size.
+     *
+     * @param columns Number of columns, rim included.
+     * @param rows Number of rows, rim included.
+     */
+    void reset(int columns, int rows);
+
+    /**
+     * @brief Sets how the edges of the world behave, kept by reset().
+     */
+    void setTopology(TOPOLOGY topology) { this->topology = topology; }
+
+    /**
+     * @brief Returns how the edges of the world behave.
+     */
+    TOPOLOGY getTopology() const { return topology; }
+
+    /**
+     * @brief Copies the cells on each edge of the world into the halo on the
+     *  opposite side, corners included. Does nothing in a BOUNDED world.
+     *
+     * @test Test that the halo mirrors the opposite edges in a TORUS.
+     */
+    void refreshHalo();
+
+    /**
+     * @brief Copies the cells on the left and right edge of row into the halo
+     *  on the opposite side. Does nothing in a BOUNDED world.
+     */
+    void refreshHaloColumns(int row);
+
+    /**
+     * @brief Copies the top and bottom rows of the world, halo columns
+     *  included, into the halo rows on the opposite side. Does nothing in a
+     *  BOUNDED world.
+     */
+    void refreshHaloRows();
+
+    /**
+     * @brief Returns the cell at position, growing the grid if position lies
+     *  outside of it.
+     *
+     * @test Test that cells can be stored at arbitrary positions.
+     */
+    Cell& operator[](Point position) {
+        if (position.x >= columns || position.y >= rows)
+            growToInclude(position);
+        return cells[position.y * columns + position.x];
+    }
+
+    /**
+     * @brief Returns the cell at position.
+     * @throw std::out_of_range If position lies outside the grid.
+     *
+     * @test Test that positions outside the grid throw.
+     */
+    Cell& at(Point position) {
+        if (position.x < 0 || position.y < 0 || position.x >= columns || position.y >= rows)
+            throw out_of_range("CellGrid::at");
+        return cells[position.y * columns + position.x];
+    }
+
+    /**
+     * @brief Returns the cell at a linear index.
+     */
+    Cell& operator[](int index) { return cells[index]; }
+
+    /**
+     * @brief Returns the linear index of position.
+     */
+    int getIndex(Point position) const { return position.y * columns + position.x; }
+
+    /**
+     * @brief Returns the number of columns, rim included.
+     */
+    int getColumns() const { return columns; }
+
+    /**
+     * @brief Returns the number of rows, rim included.
+     */
+    int getRows() const { return rows; }
+
+    /**
+     * @brief Returns the number of cells, rim included.
+     */
+    int size() const { return columns * rows; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, columns * rows); }
+}; /** @} */
+
+#endif //GAMEOFLIFE_CELLGRID_H
@@ -0,0 +1,145 @@
+/**
+ * @file ChunkBoard.h
+ * @brief Definition of ChunkBoard, a world of packed cells stepped 64x64
+ *  cells at a time, skipping the chunks where nothing happens.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_CHUNKBOARD_H
+#define GAMEOFLIFE_CHUNKBOARD_H
+
+#include <cstdint>
+#include <vector>
+#include "Cell_Culture/LaneBoards.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+  * @addtogroup Sim Cell classes
+  * @brief Classes that represent the cells and population of cells in the Game Of Life.
+  * @{
+  */
+
+/**
+ * @brief A world packed one bit per cell and divided into chunks of 64x64
+ *  cells, stepping only the chunks around those that changed.
+ * @details Rows are packed as by Population::readRegion(), so a chunk is one
+ *  word of each of 64 rows. A word of cells is stepped at once: the words
+ *  of its eight neighbours are shifted into place and added up with bitwise
+ *  adders, and birth and survival are decided with bitwise compares, as
+ *  LaneBoards does for 64 worlds.
+ *
+ *  Stepped by the same rule as the generation before, a chunk can only
+ *  change if it or a neighbouring chunk just did, so quiet chunks are
+ *  skipped. The cost of a generation follows the area of the chunks where
+ *  something happens, whatever their density. The first generation after
+ *  the world was set, or after the rule changed, steps every chunk.
+ *
+ *  Cells are numbered row after row, index y * width + x, as in
+ *  EventBoard, and the same cells change as with an EventBoard.
+ */
+class ChunkBoard {
+private:
+    Dimensions worldSize;
+    TOPOLOGY topology;
+    int wordsPerRow;            /*!< Words of a row, chunks across */
+    int chunkRows;              /*!< Chunks down */
+    uint64_t lastWordMask;      /*!< Cells of the last word of a row inside the world */
+    vector<uint64_t> words;     /*!< Rows of cells, wordsPerRow words each */
+    vector<uint64_t> next;      /*!< Stepped words of the active chunks */
+    vector<uint8_t> changedChunks;  /*!< 1 for chunks the last generation changed */
+    vector<uint8_t> activeChunks;   /*!< 1 for chunks the coming generation steps */
+    vector<int> changes;        /*!< Cells changed by the last generation */
+    vector<int> rowLiving;      /*!< Living cells of every row */
+    vector<int> columnLiving;   /*!< Living cells of every column */
+    LaneRule lastRule;          /*!< Rule of the last generation */
+    bool evaluateAll;           /*!< True if every chunk has to be stepped */
+    uint64_t livingCells;
+
+    /**
+     * @brief Returns the word of a row, the row wrapping around a torus and
+     *  rows outside a bounded world being empty.
+     */
+    const uint64_t* getRow(int row) const;
+
+    /**
+     * @brief Returns whether the cell in a column of a packed row is alive.
+     */
+    uint64_t getCell(const uint64_t* row, int column) const {
+        return (row[column / 64] >> (column % 64)) & 1;
+    }
+
+    /**
+     * @brief Returns a word of a row shifted so that every bit holds the
+     *  cell west of it, or east of it.
+     */
+    uint64_t getWest(const uint64_t* row, int word) const;
+    uint64_t getEast(const uint64_t* row, int word) const;
+
+    /**
+     * @brief Changes a word to its stepped value, listing its changed cells.
+     */
+    void storeWord(int row, int word, uint64_t value);
+
+public:
+    /**
+     * @brief Constructs an empty world.
+     *
+     * @param worldSize Columns and rows of the world.
+     * @param topology Whether the world wraps around.
+     */
+    ChunkBoard(Dimensions worldSize, TOPOLOGY topology);
+
+    /**
+     * @brief Replaces the whole world.
+     *
+     * @param cells One byte per cell, row after row, nonzero if alive.
+     */
+    void setCells(const uint8_t* cells);
+
+    /**
+     * @brief Calculates the next generation.
+     *
+     * @param rule Birth and survival counts and counted neighbours.
+     *
+     * @test Test that the world steps as a Population with the same rules,
+     *  also when the rule changes from one generation to the next.
+     */
+    void step(const LaneRule& rule);
+
+    /**
+     * @brief Returns the cells the last step() changed, in no order.
+     */
+    const vector<int>& getChanges() const { return changes; }
+
+    /**
+     * @brief Returns true if the cell at an index is alive.
+     */
+    bool isAlive(int index) const {
+        return getCell(&words[static_cast<size_t>(index / worldSize.WIDTH) * wordsPerRow], index % worldSize.WIDTH) != 0;
+    }
+
+    /**
+     * @brief Returns the number of living cells.
+     */
+    uint64_t getLivingCells() const { return livingCells; }
+
+    /**
+     * @brief Returns the living cells of every row.
+     */
+    const vector<int>& getRowLiving() const { return rowLiving; }
+
+    /**
+     * @brief Returns the living cells of every column.
+     */
+    const vector<int>& getColumnLiving() const { return columnLiving; }
+
+    /**
+     * @brief Returns the columns and rows of the world.
+     */
+    Dimensions getWorldSize() const { return worldSize; }
+}; /** @} */
+
+#endif //GAMEOFLIFE_CHUNKBOARD_H
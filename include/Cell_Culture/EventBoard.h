@@ -0,0 +1,132 @@
+/**
+ * @file EventBoard.h
+ * @brief Definition of EventBoard, a world stepped by visiting only the cells
+ *  around those that changed.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_EVENTBOARD_H
+#define GAMEOFLIFE_EVENTBOARD_H
+
+#include <cstdint>
+#include <vector>
+#include "Cell_Culture/LaneBoards.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+  * @addtogroup Sim Cell classes
+  * @brief Classes that represent the cells and population of cells in the Game Of Life.
+  * @{
+  */
+
+/**
+ * @brief A world that keeps the neighbour counts of its cells up to date as
+ *  cells are born and die.
+ * @details Every cell has a byte of state and a byte of neighbour counts, the
+ *  living cardinal neighbours in the low four bits and the living diagonal
+ *  ones in the high four. A birth or death adds to or subtracts from the
+ *  counts of its eight neighbours, so counts never have to be summed anew.
+ *
+ *  Stepped by the same rule as the generation before, a cell can only change
+ *  if it or one of its neighbours just did. A generation then looks at the
+ *  cells that changed and their neighbours and nothing else, and costs time
+ *  in proportion to the activity of the world instead of its area. The first
+ *  generation after the world was set, or after the rule changed, looks at
+ *  every cell.
+ *
+ *  Cells are numbered row after row, index y * width + x. In a torus the
+ *  neighbours of an edge cell wrap around, and a world one or two cells wide
+ *  counts the same neighbour twice, as a CellGrid with its halo does.
+ */
+class EventBoard {
+private:
+    Dimensions worldSize;
+    TOPOLOGY topology;
+    vector<uint8_t> alive;      /*!< 1 for living cells */
+    vector<uint8_t> counts;     /*!< Living neighbours, cardinal | diagonal << 4 */
+    vector<uint8_t> queued;     /*!< 1 for cells already listed as candidates */
+    vector<int> changes;        /*!< Cells changed by the last generation */
+    vector<int> candidates;     /*!< Cells the coming generation looks at */
+    vector<int> changed;        /*!< Cells the coming generation changes */
+    vector<int> rowLiving;      /*!< Living cells of every row */
+    vector<int> columnLiving;   /*!< Living cells of every column */
+    uint8_t nextState[2][256];  /*!< Next state by [alive][counts] of lastRule */
+    LaneRule lastRule;          /*!< Rule of the last generation */
+    bool evaluateAll;           /*!< True if every cell has to be looked at */
+    uint64_t livingCells;
+
+    /**
+     * @brief Calls visit(neighbour, diagonal) for the eight neighbours of a
+     *  cell, leaving out those outside a bounded world.
+     */
+    template<class Visit>
+    void forEachNeighbour(int index, Visit visit) const;
+
+    /**
+     * @brief Fills nextState with the rule, if it is not the last rule.
+     */
+    void prepareRule(const LaneRule& rule);
+
+public:
+    /**
+     * @brief Constructs an empty world.
+     *
+     * @param worldSize Columns and rows of the world.
+     * @param topology Whether the world wraps around.
+     */
+    EventBoard(Dimensions worldSize, TOPOLOGY topology);
+
+    /**
+     * @brief Replaces the whole world and counts the neighbours of every cell.
+     *
+     * @param cells One byte per cell, row after row, nonzero if alive.
+     */
+    void setCells(const uint8_t* cells);
+
+    /**
+     * @brief Calculates the next generation.
+     * @details The cells that change are found first and changed afterwards,
+     *  so every cell is decided on the counts of the generation before.
+     *
+     * @param rule Birth and survival counts and counted neighbours.
+     *
+     * @test Test that the world steps as a Population with the same rules,
+     *  also when the rule changes from one generation to the next.
+     */
+    void step(const LaneRule& rule);
+
+    /**
+     * @brief Returns the cells the last step() changed, in no order.
+     */
+    const vector<int>& getChanges() const { return changes; }
+
+    /**
+     * @brief Returns true if the cell at an index is alive.
+     */
+    bool isAlive(int index) const { return alive[index] != 0; }
+
+    /**
+     * @brief Returns the number of living cells.
+     */
+    uint64_t getLivingCells() const { return livingCells; }
+
+    /**
+     * @brief Returns the living cells of every row.
+     */
+    const vector<int>& getRowLiving() const { return rowLiving; }
+
+    /**
+     * @brief Returns the living cells of every column.
+     */
+    const vector<int>& getColumnLiving() const { return columnLiving; }
+
+    /**
+     * @brief Returns the columns and rows of the world.
+     */
+    Dimensions getWorldSize() const { return worldSize; }
+}; /** @} */
+
+#endif //GAMEOFLIFE_EVENTBOARD_H
@@ -0,0 +1,131 @@
+/**
+ * @file LaneBoards.h
+ * @brief Definition of LaneBoards, 64 worlds of one size stepped together,
+ *  one bit of every word per world.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_LANEBOARDS_H
+#define GAMEOFLIFE_LANEBOARDS_H
+
+#include <cstdint>
+#include <vector>
+#include "GoL_Rules/RuleOfExistence.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Structs Data structures
+ * @brief Structs used in the application to group data together.
+ * @{
+ */
+
+/**
+ * @brief A rule that only depends on whether a cell is alive and how many
+ *  of its neighbours are, as bit sets of neighbour counts.
+ */
+struct LaneRule {
+    uint16_t birthCounts;       /*!< Bit n set if dead cells with n living neighbours are born */
+    uint16_t survivalCounts;    /*!< Bit n set if living cells with n living neighbours live on */
+    bool cardinal;              /*!< True if the neighbours N, E, S and W count */
+    bool diagonal;              /*!< True if the neighbours NE, SE, SW and NW count */
+}; /** @} */
+
+/**
+  * @addtogroup Sim Cell classes
+  * @brief Classes that represent the cells and population of cells in the Game Of Life.
+  * @{
+  */
+
+/**
+ * @brief Sixty-four independent worlds of the same size and topology, bit i
+ *  of every word belonging to world i.
+ * @details Each cell position has one word, holding that cell in all 64
+ *  worlds, its lanes. A generation adds up the eight neighbour words with
+ *  bitwise adders and decides birth and survival with bitwise compares, so
+ *  all lanes are stepped by the work of stepping one world a cell at a time,
+ *  without a per cell branch.
+ *
+ *  Rows are padded to whole multiples of 64 cells, so that 64 cell words
+ *  transposed give every lane's bits of those cells packed as by
+ *  Population::readRegion(). The padding cells stay dead.
+ */
+class LaneBoards {
+private:
+    Dimensions worldSize;
+    TOPOLOGY topology;
+    int wordsPerRow;        /*!< Words per row of a lane's bitmap */
+    int rowStride;          /*!< Cell words from one row to the next, 64 * wordsPerRow */
+    vector<uint64_t> cells; /*!< Cell words, row after row */
+    vector<uint64_t> next;  /*!< Cell words of the generation being calculated */
+
+public:
+    /**
+     * @brief Number of worlds stepped together.
+     */
+    static const int LANES = 64;
+
+    /**
+     * @brief Constructs 64 empty worlds.
+     *
+     * @param worldSize Columns and rows of every world.
+     * @param topology Whether the worlds wrap around.
+     */
+    LaneBoards(Dimensions worldSize, TOPOLOGY topology);
+
+    /**
+     * @brief Returns the lane rule of an action table.
+     * @details Dead cells whose action is GIVE_CELL_LIFE are born, living
+     *  cells whose action is not KILL_CELL live on.
+     */
+    static LaneRule getLaneRule(const ActionTable& table);
+
+    /**
+     * @brief Replaces the world of a lane.
+     *
+     * @param lane Lane to replace, 0 to 63.
+     * @param bitmap Living cells, laid out as by Population::readRegion()
+     *  with getWordsPerRow() words per row, nullptr for an empty world.
+     *
+     * @test Test that a lane is read back as it was set.
+     */
+    void setLane(int lane, const uint64_t* bitmap);
+
+    /**
+     * @brief Calculates the next generation of some lanes.
+     *
+     * @param rules Rules to apply.
+     * @param ruleLanes For each rule, the lanes it is applied to. Lanes of no
+     *  rule keep their generation.
+     *
+     * @test Test that each lane steps as a Population of its own.
+     */
+    void step(const vector<LaneRule>& rules, const vector<uint64_t>& ruleLanes);
+
+    /**
+     * @brief Unpacks every lane into a bitmap of its own.
+     *
+     * @param bitmaps Receives LANES bitmaps of getBitmapWords() words one
+     *  after another, each laid out as by Population::readRegion().
+     */
+    void readLanes(vector<uint64_t>& bitmaps) const;
+
+    /**
+     * @brief Returns the words per row of a lane's bitmap.
+     */
+    int getWordsPerRow() const { return wordsPerRow; }
+
+    /**
+     * @brief Returns the words of a lane's bitmap.
+     */
+    int getBitmapWords() const { return wordsPerRow * worldSize.HEIGHT; }
+
+    /**
+     * @brief Returns the columns and rows of every world.
+     */
+    Dimensions getWorldSize() const { return worldSize; }
+}; /** @} */
+
+#endif //GAMEOFLIFE_LANEBOARDS_H
@@ -10,15 +10,41 @@
 #ifndef POPULATION_H
 #define POPULATION_H
 
-#include<map>
 #include<string>
+#include<cstdint>
+#include<ctime>
+#include<memory>
+#include<vector>
 #include "Cell.h"
-#include "Support/Globals.h"
+#include "CellGrid.h"
+#include "ChunkBoard.h"
+#include "EventBoard.h"
+#include "Support/SupportStructures.h"
+#include "Support/MonotonicArena.h"
 #include "GoL_Rules/RuleOfExistence.h"
 #include "GoL_Rules/RuleFactory.h"
+#include "GoL_Rules/RuleSchedule.h"
 
 using namespace std;
 
+/**
+ * @addtogroup Structs Data structures
+ * @brief Structs used in the application to group data together.
+ * @{
+ */
+
+/**
+ * @brief What the adaptive engine measured of a generation.
+ */
+struct EngineSample {
+    int generation;         /*!< Generation calculated before the sample */
+    ENGINE engine;          /*!< Engine that calculated it */
+    double density;         /*!< Living cells per cell of the world */
+    double activity;        /*!< Cells the generation changed per living cell */
+    Point boxCorner;        /*!< Top left corner of the bounding box of the living cells */
+    Dimensions boxSize;     /*!< Size of the bounding box, 0x0 if no cell lives */
+}; /** @} */
+
 /**
   * @addtogroup Sim Cell classes
   * @brief Classes that represent the cells and population of cells in the Game Of Life.
@@ -47,41 +73,189 @@ private:
     int generation; 
 
     /**
-     * @brief std::map that maps each Cell to a Point.
+     * @brief Size, seed source and topology of the world. worldSize is
+     *  replaced by the size of a world read from file.
+     */
+    PopulationConfig config;
+
+    /**
+     * @brief Arena holding the rules of existence, freed as a whole together
+     *  with the Population.
+     */
+    MonotonicArena arena;
+
+    /**
+     * @brief CellGrid holding each Cell at its Point.
+     */
+    CellGrid cells;
+
+    /**
+     * @brief A RuleOfExistence of the schedule and the number of consecutive
+     *  generations it is applied to.
+     */
+    struct ScheduleSlot {
+        RuleOfExistence* rule;
+        int generations;
+    };
+
+    /**
+     * @brief The rules of the RuleSchedule in order, constructed once in the
+     *  arena together with the array itself.
+     */
+    ScheduleSlot* schedule;
+
+    /**
+     * @brief Number of slots in schedule.
+     */
+    int scheduleLength;
+
+    /**
+     * @brief Slot holding the rule of the current generation.
+     */
+    int scheduleIndex;
+
+    /**
+     * @brief Generations the current slot still applies to, this one included.
+     */
+    int generationsLeft;
+
+    /**
+     * @brief The rule of every slot as a LaneRule, empty if a rule has no
+     *  ActionTable and the schedule can only run on the grid.
+     */
+    vector<LaneRule> boardRules;
+
+    /**
+     * @brief The newest generation of the event engine, created once the
+     *  engine calculates a generation.
+     */
+    unique_ptr<EventBoard> eventBoard;
+
+    /**
+     * @brief The newest generation of the chunk engine, created once the
+     *  engine calculates a generation.
+     */
+    unique_ptr<ChunkBoard> chunkBoard;
+
+    /**
+     * @brief Engine whose board holds the newest generation of cells,
+     *  GRID_ENGINE if no board does.
+     */
+    ENGINE boardEngine;
+
+    /**
+     * @brief Indices in cells of the cells whose pending action changes
+     *  them, while a board holds the newest generation.
+     */
+    vector<int> pendingChanges;
+
+    /**
+     * @brief Engine the adaptive engine calculates the coming generations
+     *  with.
+     */
+    ENGINE adaptiveEngine;
+
+    /**
+     * @brief Generations until the adaptive engine samples the world.
+     */
+    int generationsToSample;
+
+    /**
+     * @brief The last sample taken by the adaptive engine.
+     */
+    EngineSample engineSample;
+
+    /**
+     * @brief Calculates a generation by letting the rule visit every cell.
      */
-    map<Point, Cell> cells;
+    void calculateGridGeneration(RuleOfExistence* rule);
 
     /**
-     * @brief RuleOfExistence for even generations.
+     * @brief Copies the newest generation of cells into a board, and lists
+     *  the cells that change when it is committed.
      */
-    RuleOfExistence* evenRuleOfExistence;
+    template<class Board>
+    void loadBoard(unique_ptr<Board>& board, ENGINE engine);
 
     /**
-     * @brief RuleOfExistence for odd generations.
+     * @brief Calculates a generation with the board of an engine.
+     * @details Only the cells that change are committed and given actions.
+     *  Cells that live on keep their age, which no rule with an ActionTable
+     *  reads.
+     *
+     * @param board Board of the engine, loaded from the cells unless it
+     *  calculated the generation before.
+     * @param engine EVENT_ENGINE or CHUNK_ENGINE.
+     * @param rule Rule of the generation.
      */
-    RuleOfExistence* oddRuleOfExistence;
+    template<class Board>
+    void calculateBoardGeneration(unique_ptr<Board>& board, ENGINE engine, const LaneRule& rule);
+
+    /**
+     * @brief Samples the generation just calculated and lets the adaptive
+     *  engine move on to the engine expected to be fastest.
+     * @details The cost of a generation is estimated for every engine, the
+     *  grid by the area of the world, the chunk engine by the chunks the
+     *  bounding box of the living cells covers and the event engine by the
+     *  changed cells. The engine is changed only if another one is expected
+     *  to take at most half the time, so a world on the edge between two
+     *  engines does not keep converting its cells back and forth.
+     */
+    void sampleEngine();
 
     /**
      * @brief Randomizes the state of each cell in cells.
      * @details Does not randomize the rim cells. The size of the simulation is
-     *  determined by the global WORLD_DIMENSIONS.
+     *  determined by the worldSize of config. Every row draws its cells from
+     *  its own stream derived from the seed, 64 cells at a time, and the rows
+     *  are generated in parallel. The result only depends on the seed,
+     *  density and worldSize of config.
      */
     void randomizeCellCulture();
 
+    /**
+     * @brief Fills cells with a world of the size of config in which the
+     *  cells of a bitmap are given life, laid out as by readRegion().
+     */
+    void buildCellCulture(const uint64_t* livingCells, int wordsPerRow);
+
     /**
      * @brief Populates the map cells with predefined cells from file.
-     * @details Uses FileLoader::LoadPopulationFromFile() to load the map with
-     *  data from the filename supplied when the application was run.
+     * @details Uses FileLoader::LoadPopulationFromFile() to load the grid with
+     *  data from the fileName of config, taking over the size of its world.
      */
     void buildCellCultureFromFile();
 
 public:
+    /**
+     * @brief Generations between the samples of the adaptive engine.
+     */
+    static const int ENGINE_SAMPLE_INTERVAL = 32;
+
     /**
      * @brief Constructor of Population.
-     * @details Sets generation to zero and sets even- and odd rule of existence
-     *  to nullptr.
+     * @details Sets generation to zero and leaves the rule schedule empty. A
+     *  randomized cell culture of the default size is seeded with the current
+     *  time.
      */
-    Population() : generation(0), evenRuleOfExistence(nullptr), oddRuleOfExistence(nullptr) {}
+    Population() : Population(PopulationConfig()) {
+        config.seed = static_cast<uint64_t>(time(0));
+    }
+
+    /**
+     * @brief Constructor of Population with a configuration of its own.
+     * @details Two populations with the same seed, density and world size
+     *  are randomized identically. Nothing is shared between populations, so
+     *  any number of them may be run concurrently.
+     *
+     * @param config Size, seed source and topology of the world.
+     */
+    explicit Population(const PopulationConfig& config)
+            : generation(0), config(config), schedule(nullptr), scheduleLength(0), scheduleIndex(0),
+              generationsLeft(0), boardEngine(GRID_ENGINE), adaptiveEngine(CHUNK_ENGINE), generationsToSample(1),
+              engineSample() {
+        cells.setTopology(config.topology);
+    }
     
     /**
      * @brief Destructor of Population.
@@ -105,9 +279,100 @@ public:
      */
     void initiatePopulation(string evenRuleName, string oddRuleName = "");
 
+    /**
+     * @brief Initiates cell population before simulation starts, applying the
+     *  rules in the order of a schedule.
+     * @details Every entry of the schedule gets its own rule, constructed
+     *  before the simulation starts, so choosing the rule of a generation
+     *  neither searches nor allocates. Generations run by the same entry use
+     *  the same rule and keep whatever it has prepared.
+     *
+     * @param ruleSchedule Rules and how many consecutive generations each is
+     *  applied to, starting over after the last one.
+     *
+     * @test Test that the rules follow each other as scheduled.
+     */
+    void initiatePopulation(const RuleSchedule& ruleSchedule);
+
+    /**
+     * @brief Starts an initiated population over with a new random world.
+     * @details The world keeps its size, so the grid and the rules of the
+     *  schedule are reused as they are, after forgetting what the rules kept
+     *  of earlier generations. The schedule and the generation counter start
+     *  from the beginning. The result is the same as initiating a new
+     *  population with this seed and density.
+     * @param seed Seed of the new world.
+     * @param density Fraction of living cells of the new world.
+     * @test Test that a restarted population runs as a new one.
+     */
+    void restart(uint64_t seed, double density);
+
+    /**
+     * @brief Draws the living cells of one row of the random world of a
+     *  configuration, as randomizeCellCulture() does.
+     *
+     * @param config Size, seed and density of the world.
+     * @param row Row to draw, 0 being the first row of the world.
+     * @param words Receives the row packed as by readRegion(), in
+     *  (WIDTH + 63) / 64 words.
+     */
+    static void randomizeRow(const PopulationConfig& config, int row, uint64_t* words);
+
+    /**
+     * @brief Continues an initiated population from a board of a later
+     *  generation, as if every generation up to it had been calculated.
+     * @details The board becomes the pending generation, so the next
+     *  generation calculated is the one after it, by the rule the schedule
+     *  gives it. The rules forget what they kept, which is only correct if
+     *  canResume() is true.
+     *
+     * @param bitmap Living cells of the world, laid out as by readRegion().
+     * @param wordsPerRow Words from one bitmap row to the next.
+     * @param generation Generation the board is of.
+     *
+     * @test Test that a resumed population runs as one that was not stopped.
+     */
+    void resume(const uint64_t* bitmap, int wordsPerRow, int generation);
+
+    /**
+     * @brief Returns true if no rule of the schedule keeps history, so the
+     *  population can be resumed from a board.
+     */
+    bool canResume() const;
+
+    /**
+     * @brief Chooses how the coming generations are calculated.
+     * @details The engines calculate the same generations, and a population
+     *  can change engine between any two of them. ADAPTIVE_ENGINE samples the
+     *  generation calculated next and then every ENGINE_SAMPLE_INTERVAL
+     *  generations, see sampleEngine().
+     *
+     * @param engine Engine of the coming generations.
+     */
+    void setEngine(ENGINE engine);
+
+    /**
+     * @brief Returns the engine that calculates the coming generations,
+     *  GRID_ENGINE if a rule of the schedule has no ActionTable. Never
+     *  ADAPTIVE_ENGINE, but the engine it chose.
+     */
+    ENGINE getEngine() const {
+        if (boardRules.empty())
+            return GRID_ENGINE;
+        return (config.engine == ADAPTIVE_ENGINE) ? adaptiveEngine : config.engine;
+    }
+
+    /**
+     * @brief Returns the last sample the adaptive engine took.
+     */
+    const EngineSample& getEngineSample() const { return engineSample; }
+
     /**
      * @brief Updates the cell population and determines the next generation
      *  based on the rules of existence.
+     * @details With the event engine only the cells around those that changed
+     *  are visited, see EventBoard, and with the chunk engine only the chunks
+     *  around those that changed, see ChunkBoard.
      * 
      * @return int Increments the generation counter.
      * 
@@ -127,6 +392,11 @@ public:
      */
     Cell& getCellAtPosition(Point position) { return cells.at(position); }
 
+    /**
+     * @brief Returns the grid holding all cells, rim included.
+     */
+    CellGrid& getCells() { return cells; }
+
     /**
      * @brief Returns the total amount of cells in the population.
      * 
@@ -136,6 +406,58 @@ public:
      */
     int getTotalCellPopulation() { return cells.size(); }
 
+    /**
+     * @brief Returns whether the world is bounded or wraps around.
+     */
+    TOPOLOGY getTopology() { return cells.getTopology(); }
+
+    /**
+     * @brief Returns the columns and rows of the world, rim excluded.
+     */
+    Dimensions getWorldSize() const { return config.worldSize; }
+
+    /**
+     * @brief Packs whether the cells of a rectangle of the world are alive
+     *  into a bitmap, one bit per cell.
+     * @details Each row of the bitmap takes wordsPerRow words and the lowest
+     *  bit of a word holds the leftmost of its cells, as in BitBoard. Cells
+     *  outside the world are read as dead. The rows are walked cell after
+     *  cell and written a word at a time, with no lookup per cell.
+     *
+     * @param left Column of the world at bit 0, 0 being the first column.
+     * @param top Row of the world in the first bitmap row.
+     * @param width Cells per bitmap row, at most 64 * wordsPerRow.
+     * @param height Rows of the bitmap.
+     * @param bitmap Receives height * wordsPerRow words.
+     * @param wordsPerRow Words from one bitmap row to the next.
+     *
+     * @test Test that a region read back matches the cells.
+     */
+    void readRegion(int left, int top, int width, int height, uint64_t* bitmap, int wordsPerRow);
+
+    /**
+     * @brief Copies whether the cells of a rectangle of the world are alive,
+     *  one byte per cell, 1 if alive and 0 if dead or outside the world.
+     *
+     * @param bytes Receives width * height bytes, row by row.
+     */
+    void readRegion(int left, int top, int width, int height, uint8_t* bytes);
+
+    /**
+     * @brief Stamps a bitmap laid out as by readRegion() into the world.
+     * @details Every cell under the bitmap lives if its bit is set and is
+     *  dead otherwise, and stays as stamped when the pending generation is
+     *  committed. Cells that already are as stamped keep their age, and
+     *  their pending action too unless it would change them. Cells outside
+     *  the bitmap keep their pending actions. Bits outside the world are
+     *  ignored and the halo of a torus is refreshed if a cell changed.
+     *
+     * @test Test that stamping what was read keeps every cell as it is,
+     *  that a stamp over cells about to change survives the next generation
+     *  and that a pattern stamped into a torus wraps across the edge.
+     */
+    void writeRegion(int left, int top, int width, int height, const uint64_t* bitmap, int wordsPerRow);
+
 }; /** @} */
 
 #endif
\ No newline at end of file
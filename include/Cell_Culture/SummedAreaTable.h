@@ -0,0 +1,138 @@
+/**
+ * @file SummedAreaTable.h
+ * @brief Definition of SummedAreaTable, counts of living cells in any
+ *  rectangle of the world in constant time.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_SUMMEDAREATABLE_H
+#define GAMEOFLIFE_SUMMEDAREATABLE_H
+
+#include <cstdint>
+#include <vector>
+#include "CellGrid.h"
+
+using namespace std;
+
+/**
+  * @addtogroup Sim Cell classes
+  * @brief Classes that represent the cells and population of cells in the Game Of Life.
+  * @{
+  */
+
+/**
+ * @brief Integral image of the living cells of a world.
+ * @details Entry (x, y) holds the number of living cells above and to the left
+ *  of world position (x, y), so the cells of any rectangle are counted from
+ *  its four corners, no matter how large it is. This lets neighbourhoods of
+ *  radius r cost the same as those of radius 1.
+ *
+ *  Rectangles reaching past the edges of a BOUNDED world are clipped, in a
+ *  TORUS they wrap around.
+ *
+ *  Diamonds, the cells within a Manhattan distance of a cell, are counted for
+ *  one radius at a time, sliding the diamond along each row and adding and
+ *  removing its edges from sums along the two diagonals of the world. Those
+ *  tables are only built on request.
+ */
+class SummedAreaTable {
+private:
+    int width;              /*!< Columns of the world */
+    int height;             /*!< Rows of the world */
+    TOPOLOGY topology;
+    vector<int32_t> sums;   /*!< (width + 1) x (height + 1) entries, row by row */
+
+    vector<int32_t> diagonalSums[2]; /*!< Sums along the diagonals running down and right, and down and left */
+    vector<int32_t> diamonds;        /*!< Living cells of the diamond around each cell, row by row */
+
+    /**
+     * @brief Counts the entries of a rectangle inside a table of the given
+     *  stride, from its four corners.
+     */
+    static int boxSum(const vector<int32_t>& table, int stride, int left, int top, int right, int bottom) {
+        return table[(bottom + 1) * stride + right + 1] - table[top * stride + right + 1]
+               - table[(bottom + 1) * stride + left] + table[top * stride + left];
+    }
+
+    /**
+     * @brief Turns the cells of a table, stored from its second row and
+     *  column, into their sums, rows in parallel.
+     */
+    static void integrate(vector<int32_t>& table, int width, int height);
+
+    /**
+     * @brief Returns the number of living cells on length cells of a
+     *  diagonal, from (column, row) one row down per step and one column
+     *  right if direction is 0, left if it is 1.
+     * @details The cells wrap around a TORUS, where length must not exceed
+     *  the height, and are clipped to a BOUNDED world.
+     */
+    int diagonalSum(int direction, int column, int row, int length) const;
+
+    /**
+     * @brief Splits the range [first, last] of a dimension of the given size
+     *  into at most two ranges inside it, wrapping or clipping it.
+     *
+     * @return int Number of ranges written to ranges.
+     */
+    int splitRange(int first, int last, int size, int ranges[2][2]) const;
+
+public:
+    /**
+     * @brief Constructs an empty table.
+     */
+    SummedAreaTable() : width(0), height(0), topology(BOUNDED) {}
+
+    /**
+     * @brief Counts the living cells of the world held by cells, rows in
+     *  parallel.
+     *
+     * @param cells Grid holding the world, rim included.
+     *
+     * @test Test that sums match counting the cells one by one.
+     */
+    void build(CellGrid& cells);
+
+    /**
+     * @brief Returns the number of living cells in the rectangle from
+     *  (left, top) to (right, bottom), both corners included.
+     * @details Positions are world positions, (0, 0) being the first cell
+     *  inside the rim.
+     *
+     * @test Test clipping in a BOUNDED world and wrapping in a TORUS.
+     */
+    int sum(int left, int top, int right, int bottom) const;
+
+    /**
+     * @brief Counts the living cells of every diamond of the given radius in
+     *  the world held by cells, for sumDiamond().
+     * @details Each diamond starts a row as a sum() per row it covers, and
+     *  moves right by adding the cells on its right edges and removing those
+     *  on its left edges, two diagonals each. Only tables the size of the
+     *  world are used, whatever the radius.
+     *
+     *  In a TORUS every cell is counted once, a diamond wider or taller than
+     *  the world covering the rows it overlaps as sum() does: completely.
+     *
+     * @param cells Grid holding the world, rim included.
+     * @param radius Radius of the diamonds.
+     */
+    void buildDiamonds(CellGrid& cells, int radius);
+
+    /**
+     * @brief Returns the number of living cells at most the radius given to
+     *  buildDiamonds() steps north, east, south or west of world position
+     *  (column, row), the cell itself included.
+     *
+     * @test Test that sums match counting the cells one by one.
+     */
+    int sumDiamond(int column, int row) const {
+        return diamonds.empty() ? 0 : diamonds[row * width + column];
+    }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+}; /** @} */
+
+#endif //GAMEOFLIFE_SUMMEDAREATABLE_H
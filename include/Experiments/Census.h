@@ -0,0 +1,116 @@
+/**
+ * @file Census.h
+ * @brief Declaration of Census, class that identifies and counts the objects
+ *  left on a board.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_CENSUS_H
+#define GAMEOFLIFE_CENSUS_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "Cell_Culture/Population.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Experiments Experiment classes
+ * @brief Classes that run and evaluate batches of simulations.
+ * @{
+ */
+
+/**
+ * @brief Tally of the objects found in one or more populations.
+ * @details Living cells are grouped into objects by 8-connectivity. Each object
+ *  is reduced to a code that is the same for all rotations and reflections of
+ *  it, and known still lifes, oscillators and spaceships are given their
+ *  common names. Objects without a name are counted by their code.
+ */
+class Census {
+private:
+    /**
+     * @brief Number of objects found, per object name.
+     */
+    map<string, int> objectCounts;
+
+    /**
+     * @brief Counts the objects of a world, one byte per cell, clearing the
+     *  cells as they are counted.
+     */
+    void countObjects(vector<uint8_t>& alive, int width, int height, bool wraps);
+
+public:
+    /**
+     * @brief Returns the code of an object, independent of its orientation.
+     * @details The code is the smallest of the eight rotated and reflected
+     *  bitmaps of the object, written as "<width>x<height>:<rows>" where each
+     *  row is a string of 0 and 1 separated by '/'.
+     *
+     * @param object Positions of the object's living cells.
+     * @return string Code of the object.
+     *
+     * @test Test that all orientations of an object give the same code.
+     */
+    static string getObjectCode(const vector<Point>& object);
+
+    /**
+     * @brief Returns the name of an object.
+     *
+     * @param object Positions of the object's living cells.
+     * @return string Common name of the object if it is known, otherwise
+     *  "unknown_" followed by its code.
+     *
+     * @test Test that common objects are named correctly.
+     */
+    static string classifyObject(const vector<Point>& object);
+
+    /**
+     * @brief Counts the objects among the living cells of a population.
+     * @details Only the cells within the world are inspected. Objects
+     *  crossing the edge of a TORUS are counted as one.
+     *
+     * @param population Population to take the census of.
+     *
+     * @test Test that separate objects are counted separately.
+     */
+    void takeCensus(Population& population);
+
+    /**
+     * @brief Counts the objects among the living cells of a bitmap, laid out
+     *  as by Population::readRegion().
+     *
+     * @param bitmap Living cells of the world.
+     * @param wordsPerRow Words from one bitmap row to the next.
+     * @param worldSize Columns and rows of the world.
+     * @param topology Whether objects may cross the edges.
+     */
+    void takeCensus(const uint64_t* bitmap, int wordsPerRow, Dimensions worldSize, TOPOLOGY topology);
+
+    /**
+     * @brief Adds count objects with the given name.
+     */
+    void addObjects(const string& name, int count = 1) { objectCounts[name] += count; }
+
+    /**
+     * @brief Adds the counts of another census to this one.
+     *
+     * @param other Census to add.
+     */
+    void merge(const Census& other);
+
+    /**
+     * @brief Returns the number of objects found, per object name.
+     */
+    const map<string, int>& getObjectCounts() const { return objectCounts; }
+
+    /**
+     * @brief Returns the total number of objects found.
+     */
+    int getTotalObjects() const;
+};
+/** @} */
+
+#endif //GAMEOFLIFE_CENSUS_H
@@ -0,0 +1,177 @@
+/**
+ * @file DistributedSimulation.h
+ * @brief Declaration of DistributedSimulation, class that splits one world
+ *  over several worker processes.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_DISTRIBUTEDSIMULATION_H
+#define GAMEOFLIFE_DISTRIBUTEDSIMULATION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "GoL_Rules/RuleSchedule.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Experiments Experiment classes
+ * @brief Classes that run and evaluate batches of simulations.
+ * @{
+ */
+
+/**
+ * @brief Living cells of the whole world after a generation.
+ */
+struct DistributedStats {
+    int generation;         /*!< Generation the count was taken after */
+    uint64_t livingCells;   /*!< Living cells summed over all workers */
+};
+
+/**
+ * @brief Runs a single world split over several worker processes.
+ * @details The world is cut into horizontal strips of whole rows, one strip
+ *  per worker process, so no process has to hold more than its own strip.
+ *  Every worker randomizes its rows from the same per row streams as
+ *  Population, which makes the world independent of the number of workers.
+ *
+ *  Neighbouring workers are connected by Unix domain socket pairs, in a ring
+ *  on a torus. Before every generation each worker sends its top and bottom
+ *  row to the workers above and below it, packed 64 cells to a word, and
+ *  receives their edge rows into its halo rows. The halo columns are
+ *  wrapped by each worker on its own, as every strip spans the full width.
+ *
+ *  The calling process coordinates: it forks the workers, sums the living
+ *  cells they report after every generation and writes checkpoints,
+ *  collecting the strips in order into one population file that -f can
+ *  read.
+ *
+ *  Only rules that look at whether a cell and its nearest neighbours are
+ *  alive, those with an ActionTable, can be distributed, as a halo of one
+ *  cell is all a worker knows of its neighbours.
+ */
+class DistributedSimulation {
+private:
+    int nrOfWorkers;
+    int maxGenerations;
+    Dimensions worldSize;
+    RuleSchedule ruleSchedule;
+    uint64_t seed;
+    double density;
+    TOPOLOGY topology;
+
+    string checkpointPrefix;    /*!< Path the checkpoint files start with, empty for none */
+    int checkpointInterval;     /*!< Generations between checkpoints */
+
+    vector<DistributedStats> stats;
+
+    /**
+     * @brief Returns true if the world is written after generation.
+     */
+    bool isCheckpoint(int generation) const {
+        return !checkpointPrefix.empty()
+               && (generation == maxGenerations || (checkpointInterval > 0 && generation % checkpointInterval == 0));
+    }
+
+    /**
+     * @brief Simulates the strip of one worker, run in the forked process.
+     *
+     * @param worker Index of the worker.
+     * @param coordinator Socket to the coordinator.
+     * @param above Socket to the worker above, -1 if there is none.
+     * @param below Socket to the worker below, -1 if there is none.
+     * @return bool False if a socket failed.
+     */
+    bool runWorker(int worker, int coordinator, int above, int below);
+
+    /**
+     * @brief Collects the reports of the workers until the last generation.
+     *
+     * @param coordinators Socket to each worker, in worker order.
+     * @return bool False if a worker stopped reporting or a checkpoint could
+     *  not be written.
+     */
+    bool collectReports(const vector<int>& coordinators);
+
+public:
+    /**
+     * @brief Constructor of DistributedSimulation.
+     *
+     * @param nrOfWorkers Number of worker processes, at most one per row.
+     * @param maxGenerations Number of generations to simulate.
+     * @param worldSize Columns and rows of the world, rim excluded.
+     * @param ruleSchedule Rules and how many consecutive generations each is
+     *  applied to.
+     * @param seed Seed for the random starting population.
+     * @param density Fraction of living cells in the starting population.
+     * @param topology Whether the world is bounded or wraps around.
+     */
+    DistributedSimulation(int nrOfWorkers, int maxGenerations, Dimensions worldSize, const RuleSchedule& ruleSchedule,
+                          uint64_t seed = 0, double density = 0.5, TOPOLOGY topology = BOUNDED)
+            : nrOfWorkers(max(1, min(nrOfWorkers, worldSize.HEIGHT))), maxGenerations(maxGenerations),
+              worldSize(worldSize), ruleSchedule(ruleSchedule), seed(seed), density(density), topology(topology),
+              checkpointInterval(0) {}
+
+    /**
+     * @brief Writes the world to population files every interval
+     *  generations and after the last one.
+     *
+     * @param prefix Path the files start with, followed by the generation.
+     * @param interval Generations between checkpoints, 0 for the last only.
+     */
+    void setCheckpoints(string prefix, int interval) {
+        checkpointPrefix = prefix;
+        checkpointInterval = interval;
+    }
+
+    /**
+     * @brief Returns the name of the checkpoint file of a generation.
+     */
+    string getCheckpointName(int generation) const;
+
+    /**
+     * @brief Returns the rows [firstRow, lastRow) of the world a worker owns.
+     *
+     * @test Test that the strips cover the world without overlapping.
+     */
+    static void getStrip(int worker, int nrOfWorkers, int height, int& firstRow, int& lastRow);
+
+    /**
+     * @brief Checks that every rule of a schedule can be distributed.
+     *
+     * @param ruleSchedule Schedule to check.
+     * @param rejectedRule Set to the first rule that can not be distributed.
+     * @return bool True if all rules have an ActionTable.
+     */
+    static bool canDistribute(const RuleSchedule& ruleSchedule, string& rejectedRule);
+
+    /**
+     * @brief Forks the workers and blocks until they have simulated every
+     *  generation.
+     *
+     * @return bool False if the rules can not be distributed or a worker
+     *  failed, in which case the remaining workers are stopped.
+     *
+     * @test Test that the world matches a Population of the same seed, for
+     *  any number of workers.
+     */
+    bool run();
+
+    /**
+     * @brief Returns the living cells after each generation.
+     */
+    const vector<DistributedStats>& getStats() const { return stats; }
+
+    /**
+     * @brief Returns the number of workers, after limiting it to the rows of
+     *  the world.
+     */
+    int getNrOfWorkers() const { return nrOfWorkers; }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_DISTRIBUTEDSIMULATION_H
@@ -0,0 +1,150 @@
+/**
+ * @file ParameterSweep.h
+ * @brief Declaration of ParameterSweep, class that runs every combination of
+ *  rules, densities and world sizes of a spec file and collects their census.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_PARAMETERSWEEP_H
+#define GAMEOFLIFE_PARAMETERSWEEP_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Experiments/Census.h"
+#include "GoL_Rules/RuleSchedule.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Experiments Experiment classes
+ * @brief Classes that run and evaluate batches of simulations.
+ * @{
+ */
+
+/**
+ * @brief One combination of parameters of a sweep and its outcome.
+ */
+struct SweepRun {
+    string rules;               /*!< Rule schedule as written in the spec */
+    RuleSchedule ruleSchedule;  /*!< The parsed schedule */
+    PopulationConfig config;    /*!< Size, seed, density and topology of the world */
+    int generations;            /*!< Generations to simulate */
+    uint64_t livingCells;       /*!< Living cells of the last generation */
+    Census census;              /*!< Objects of the last generation */
+    bool failed;                /*!< True if the run threw before it finished */
+};
+
+/**
+ * @brief Runs the cartesian product of the parameter lists of a spec file and
+ *  writes the outcome of every run to one CSV file.
+ * @details A spec has one parameter per line, its name followed by values
+ *  separated by spaces. Text after a # is ignored.
+ *
+ *      rules conway von_neumann conway*2;erik     (or all, every named rule)
+ *      densities 0.1..0.9:0.1                     (first..last:step)
+ *      sizes 80x24 160x48
+ *      seeds 1..10                                (step defaults to 1)
+ *      generations 10000
+ *      topologies bounded torus
+ *      output sweep.csv
+ *
+ *  Parameters left out have a single value: conway, 0.5, 80x24, 0, 500,
+ *  bounded and sweep.csv. Rules are written as for --schedule.
+ *
+ *  The calling thread and a task per worker of the WorkStealingPool take
+ *  the runs one at a time, largest first, counting cells times generations,
+ *  so the longest runs are not the ones left when the other cores run out
+ *  of work.
+ */
+class ParameterSweep {
+private:
+    vector<string> rules;
+    vector<double> densities;
+    vector<Dimensions> sizes;
+    vector<uint64_t> seeds;
+    vector<int> generations;
+    vector<TOPOLOGY> topologies;
+    string outputFile;
+
+    vector<SweepRun> runs;
+
+    /**
+     * @brief Simulates one run and records its outcome.
+     */
+    static void simulate(SweepRun& run);
+
+public:
+    /**
+     * @brief Constructs the sweep of a single default run.
+     */
+    ParameterSweep();
+
+    /**
+     * @brief Replaces the parameters with those of a spec.
+     *
+     * @param text Spec, one parameter per line.
+     * @param error Set to the reason if the spec is rejected.
+     * @return bool False, leaving the parameters as they were, if a line is
+     *  malformed.
+     *
+     * @test Test that lists and ranges are read and bad lines rejected.
+     */
+    bool parse(const string& text, string& error);
+
+    /**
+     * @brief Replaces the parameters with those of a spec file.
+     *
+     * @param fileName Path of the spec.
+     * @param error Set to the reason if the file is rejected.
+     * @return bool False if the file can not be read or is malformed.
+     */
+    bool loadFromFile(const string& fileName, string& error);
+
+    /**
+     * @brief Returns every combination of the parameters, in spec order,
+     *  before they are run.
+     */
+    vector<SweepRun> expand() const;
+
+    /**
+     * @brief Runs every combination, blocks until they are done.
+     *
+     * @test Test that every run matches a population simulated on its own.
+     */
+    void runSweep();
+
+    /**
+     * @brief Writes a header and one line per run, in spec order.
+     * @details The columns are rules, width, height, topology, density,
+     *  seed, generations, living_cells, objects, census and status, census
+     *  the objects found as name=count separated by semicolons and status
+     *  ok, or failed for a run that threw, with no cells or objects.
+     *
+     * @param output Stream to write to.
+     */
+    void writeCsv(ostream& output) const;
+
+    /**
+     * @brief Writes the CSV to the output file of the spec.
+     *
+     * @return bool False if the file can not be written.
+     */
+    bool writeCsv() const;
+
+    /**
+     * @brief Returns the runs of the last sweep, in spec order.
+     */
+    const vector<SweepRun>& getRuns() const { return runs; }
+
+    /**
+     * @brief Returns the file the CSV is written to.
+     */
+    const string& getOutputFile() const { return outputFile; }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_PARAMETERSWEEP_H
@@ -0,0 +1,195 @@
+/**
+ * @file SoupSearch.h
+ * @brief Declaration of SoupSearch, class that runs batches of random soups and
+ *  takes the census of what they settle into.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_SOUPSEARCH_H
+#define GAMEOFLIFE_SOUPSEARCH_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Cell_Culture/LaneBoards.h"
+#include "Experiments/Census.h"
+#include "GoL_Rules/RuleSchedule.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Experiments Experiment classes
+ * @brief Classes that run and evaluate batches of simulations.
+ * @{
+ */
+
+/**
+ * @brief Outcome of a single soup.
+ */
+struct SoupResult {
+    uint64_t seed;      /*!< Seed the soup was randomized with */
+    bool stabilized;    /*!< True if the soup became periodic */
+    int generations;    /*!< Generations simulated */
+    int period;         /*!< Period of the final state, 0 if not stabilized */
+};
+
+/**
+ * @brief Runs many independent random soups in parallel and aggregates their
+ *  census.
+ * @details Each soup is a Population configured as given, randomized with a
+ *  seed derived from the base seed and the soup's index, so a search can be
+ *  repeated exactly. Soups are run by the calling thread and the workers of
+ *  the WorkStealingPool until their state repeats or the generation limit
+ *  is reached, after which the objects left on the board are counted.
+ *
+ *  When every rule of the schedule only looks at whether cells and their
+ *  neighbours are alive, as conway and von_neumann do, soups are run 64 at
+ *  a time in the lanes of a LaneBoards. A soup that is done leaves its lane
+ *  to the next one. Each thread takes contiguous shares of the soups, and the
+ *  outcome is the same as simulating every soup as a Population of its own.
+ */
+class SoupSearch {
+private:
+    int nrOfSoups;
+    int maxGenerations;
+    RuleSchedule ruleSchedule;
+    PopulationConfig config;    /*!< Configuration of every soup, its seed the base seed */
+
+    bool laneParallel;  /*!< Run soups in lanes where the rules allow it */
+
+    mutex resultLock;   /*!< Guards census and results */
+    Census census;
+    vector<SoupResult> results;
+
+    /**
+     * @brief Simulates one soup and records its outcome.
+     *
+     * @param index Index of the soup within the search.
+     */
+    void runSoup(int index);
+
+    /**
+     * @brief Simulates a range of soups in the lanes of a LaneBoards and
+     *  records their outcomes.
+     *
+     * @param firstSoup Index of the first soup.
+     * @param lastSoup Index after the last soup.
+     * @param rules The distinct rules of the schedule.
+     * @param entryRules Index into rules of each entry of the schedule.
+     */
+    void runLaneSoups(int firstSoup, int lastSoup, const vector<LaneRule>& rules, const vector<int>& entryRules);
+
+    /**
+     * @brief Runs run(0) to run(shares - 1) on the calling thread and the
+     *  workers of the WorkStealingPool, returning once all are done.
+     */
+    void runShares(int shares, const function<void(int)>& run);
+
+    /**
+     * @brief Records the outcome of a soup.
+     */
+    void recordSoup(int index, const SoupResult& result, const Census& soupCensus);
+
+public:
+    /**
+     * @brief Constructor of SoupSearch.
+     *
+     * @param nrOfSoups Number of soups to run.
+     * @param maxGenerations Generations after which a soup is given up on.
+     * @param evenRuleName Rule of existence for even generations.
+     * @param oddRuleName Rule of existence for odd generations.
+     * @param config Size, density and topology of the soups. Its seed is the
+     *  base seed the seeds of the soups are derived from, its fileName is
+     *  not used.
+     */
+    SoupSearch(int nrOfSoups, int maxGenerations, string evenRuleName, string oddRuleName,
+               const PopulationConfig& config)
+            : SoupSearch(nrOfSoups, maxGenerations, RuleSchedule(evenRuleName, oddRuleName), config) {}
+
+    /**
+     * @brief Constructor of SoupSearch running every soup by a rule schedule.
+     *
+     * @param nrOfSoups Number of soups to run.
+     * @param maxGenerations Generations after which a soup is given up on.
+     * @param ruleSchedule Rules and how many consecutive generations each is
+     *  applied to.
+     * @param config Size, density and topology of the soups. Its seed is the
+     *  base seed the seeds of the soups are derived from, its fileName is
+     *  not used.
+     */
+    SoupSearch(int nrOfSoups, int maxGenerations, const RuleSchedule& ruleSchedule, const PopulationConfig& config)
+            : nrOfSoups(nrOfSoups), maxGenerations(maxGenerations), ruleSchedule(ruleSchedule), config(config),
+              laneParallel(true) {
+        this->config.fileName.clear();
+    }
+
+    /**
+     * @brief Returns the seed of a soup.
+     * @details Consecutive indices are scrambled so that neighbouring soups get
+     *  unrelated seeds.
+     *
+     * @param baseSeed Seed of the search.
+     * @param index Index of the soup.
+     * @return uint64_t Seed of the soup.
+     *
+     * @test Test that the same base seed and index always give the same seed.
+     */
+    static uint64_t getSoupSeed(uint64_t baseSeed, int index);
+
+    /**
+     * @brief Returns the hash of a bitmap of living cells, by which the
+     *  states a soup went through are recognized.
+     *
+     * @param bitmap Living cells, 64 per word.
+     * @param words Words of the bitmap.
+     * @return uint64_t Hash of the bitmap.
+     *
+     * @test Test that bitmaps differing only in high bits hash differently.
+     */
+    static uint64_t hashBitmap(const uint64_t* bitmap, int words);
+
+    /**
+     * @brief Returns the lane rules of a schedule.
+     *
+     * @param ruleSchedule Schedule to translate.
+     * @param rules Set to the distinct rules of the schedule.
+     * @param entryRules Set to the index into rules of each entry.
+     * @return bool False if a rule can not be run in lanes.
+     */
+    static bool getLaneRules(const RuleSchedule& ruleSchedule, vector<LaneRule>& rules, vector<int>& entryRules);
+
+    /**
+     * @brief Chooses between running soups in lanes, where the rules allow
+     *  it, and running every soup as a Population. Lanes are the default.
+     */
+    void setLaneParallel(bool enabled) { laneParallel = enabled; }
+
+    /**
+     * @brief Runs all soups, blocks until they are done.
+     *
+     * @test Test that two searches with the same seed give the same census,
+     *  with and without lanes.
+     */
+    void runSearch();
+
+    /**
+     * @brief Returns the aggregated census of all soups.
+     */
+    const Census& getCensus() { return census; }
+
+    /**
+     * @brief Returns the outcome of each soup, ordered by soup index.
+     */
+    const vector<SoupResult>& getResults() { return results; }
+
+    /**
+     * @brief Returns the number of soups that became periodic.
+     */
+    int getStabilizedSoups();
+};
+/** @} */
+
+#endif //GAMEOFLIFE_SOUPSEARCH_H
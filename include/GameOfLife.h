@@ -11,6 +11,8 @@
 
 #include "Cell_Culture/Population.h"
 #include "ScreenPrinter.h"
+#include "ImageExporter.h"
+#include "LiveView.h"
 #include <string>
 
 /**
@@ -35,6 +37,17 @@ private:
      */
     ScreenPrinter& screenPrinter;
 
+    /**
+     * @brief Writes the generations to image files, nullptr if not exported.
+     */
+    ImageExporter* imageExporter;
+
+    /**
+     * @brief Publishes the generations in shared memory, nullptr if not
+     *  published.
+     */
+    LiveView* liveView;
+
     /**
      * @brief Number of generations simulated.
      */
@@ -49,8 +62,22 @@ public:
      * @param nrOfGenerations Number of generations to simulate.
      * @param evenRuleName Rule of existence for even generations.
      * @param oddRuleName Rule of existence for odd generations.
+     * @param config Size, starting population and topology of the world.
+     */
+    GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName,
+               const PopulationConfig& config = PopulationConfig());
+
+    /**
+     * @brief Constructor
+     * @details Initiates the population with the given number of generations
+     *  and the rules applied in the order of the schedule.
+     *
+     * @param nrOfGenerations Number of generations to simulate.
+     * @param ruleSchedule Rules and how many consecutive generations each is
+     *  applied to.
+     * @param config Size, starting population and topology of the world.
      */
-    GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName);
+    GameOfLife(int nrOfGenerations, const RuleSchedule& ruleSchedule, const PopulationConfig& config);
 
     /**
      * @brief Runs the simulation.
@@ -60,6 +87,20 @@ public:
      */
     void runSimulation();
     
+    /**
+     * @brief Sets the exporter each printed generation is also written to.
+     *
+     * @param exporter ImageExporter owned by the caller, or nullptr.
+     */
+    void setImageExporter(ImageExporter* exporter) { imageExporter = exporter; }
+
+    /**
+     * @brief Sets the live view each printed generation is also published to.
+     *
+     * @param view LiveView owned by the caller, or nullptr.
+     */
+    void setLiveView(LiveView* view) { liveView = view; }
+
     /**
      * @brief return the amount in a population.
      */
@@ -10,6 +10,7 @@
 #define RULEFACTORY_H
 
 #include "GoL_Rules/RuleOfExistence.h"
+#include "Support/MonotonicArena.h"
 
 /**
  * @addtogroup Rules Rule classes
@@ -35,16 +36,56 @@ public:
     static RuleFactory& getInstance();
 
     /**
-     * @brief Returns a pointer to a RuleOfExistence based on given cell map
+     * @brief Returns a pointer to a RuleOfExistence based on given cell grid
      *  and ruleOfExistence.
+     * @details The rule is allocated with new and owned by the caller.
      * @todo Add error message and handling if bad rulename is given. Default
      *  value 'conway' is never used.
      *
-     * @param cells Reference to std::map with Cells mapped against Points
+     * @param cells Reference to the CellGrid the rule is applied to
      * @param ruleName std::string with rulename to be used. Standard is "conway"
      * @return RuleOfExistence*
      */
-    RuleOfExistence* createAndReturnRule(map<Point, Cell>& cells, string ruleName = "conway");
+    RuleOfExistence* createAndReturnRule(CellGrid& cells, string ruleName = "conway");
+
+    /**
+     * @brief Returns a pointer to a RuleOfExistence constructed in arena.
+     * @details The memory is freed together with the arena, but the caller
+     *  must call the rule's destructor before that.
+     *
+     * @param cells Reference to the CellGrid the rule is applied to
+     * @param ruleName std::string with rulename to be used
+     * @param arena Arena the rule is constructed in
+     * @return RuleOfExistence*
+     */
+    RuleOfExistence* createAndReturnRule(CellGrid& cells, string ruleName, MonotonicArena& arena);
+
+    /**
+     * @brief Returns the names of the rules that are known by name, rather
+     *  than written out like "345/2/4" or read from a map file.
+     */
+    static vector<string> getRuleNames();
+
+    /**
+     * @brief Returns true if a rule name is one the factory constructs,
+     *  rather than falling back to Conway's rule.
+     * @details Named rules, Larger than Life and Generations rules written
+     *  out, "map:" followed by a file name and "lookup:" followed by a rule
+     *  name are known. Whether a map can be read or a rule looked up is only
+     *  found out by constructing it, see canCreateRule().
+     *
+     * @test Test that misspelt names are rejected.
+     */
+    static bool isRuleName(const string& ruleName);
+
+    /**
+     * @brief Returns true if a rule name is known and the rule can be
+     *  constructed, building it once on a small grid.
+     *
+     * @test Test that unreadable maps and rules that can not be looked up
+     *  are rejected.
+     */
+    bool canCreateRule(const string& ruleName);
 };
 
 /** @} */
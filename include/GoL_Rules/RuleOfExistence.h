@@ -9,10 +9,10 @@
 #define RULEOFEXISTENCE_H
 
 #include<string>
-#include<map>
 #include<vector>
 #include "Cell_Culture/Cell.h"
-#include "Support/Globals.h"
+#include "Cell_Culture/CellGrid.h"
+#include "Support/SupportStructures.h"
 using namespace std;
 
 
@@ -38,6 +38,17 @@ struct PopulationLimits {
   */
 struct Directions {
     int HORIZONTAL, VERTICAL;
+};
+
+/**
+  *@struct ActionTable
+  *@brief Data structure for the actions of a rule that only depends on whether
+  *a cell is alive and how many of its neighbours are.
+  */
+struct ActionTable {
+    ACTION actions[2][9];   /*!< Action by [alive][alive neighbours] */
+    int cardinalMask;       /*!< -1 if the neighbours N, E, S and W count, 0 if not */
+    int diagonalMask;       /*!< -1 if the neighbours NE, SE, SW and NW count, 0 if not */
 }; /** @} */
 
 /**
@@ -71,15 +82,26 @@ const vector<Directions> DIAGONAL{ { 1,-1 },{ 1,1 },{ -1,1 },{ -1,-1 } };
   *@details The derivations of RuleOfExistence is what determines the culture of Cell Population. Each rule implements
   *specific behaviours and so may execute some parts in different orders. In order to accommodate this
   *requirement RuleOfExistence will utilize a **Template Method** desing pattern, where all derived rules
-  *implements their logic based on the virtual method executeRule().
+  *implements their logic based on the virtual method executeRows(), called by executeRule() between the
+  *beginGeneration() and endGeneration() hooks.
   */
 
 class RuleOfExistence {
 protected:
     string ruleName;
-    map<Point, Cell>& cells; /*!< Reference to the population of cells */
+    CellGrid& cells; /*!< Reference to the population of cells */
     const PopulationLimits POPULATION_LIMITS; /*!< Amounts of alive neighbouring cells, with specified limits */
     const vector<Directions>& DIRECTIONS; /*!< The directions, by which neighbouring cells are identified */
+
+    int neighbourOffsets[8];    /*!< DIRECTIONS as differences of linear indices in cells */
+    int neighbourCount;         /*!< Number of used neighbourOffsets */
+    int offsetColumns;          /*!< Number of columns neighbourOffsets were computed for */
+
+    /**
+     * @brief Translates DIRECTIONS into neighbourOffsets for the current
+     *  number of columns of cells.
+     */
+    void computeNeighbourOffsets();
    
     /**
      * @brief Checks how many alive neighbours of a cell that exist
@@ -87,7 +109,22 @@ protected:
      * @return Returns an int with the amount of neighbouring cells that are alive
      * @test should return the amount of alive neighbouring cells
      */
-    int countAliveNeighbours(Point currentPoint);
+    int countAliveNeighbours(Point currentPoint) { return countAliveNeighbours(cells.getIndex(currentPoint)); }
+
+    /**
+     * @brief Checks how many alive neighbours the cell at a linear index has.
+     * @details Each neighbour is found by adding its offset to index, the cell
+     *  must not lie on the rim or halo.
+     *
+     * @param index Linear index of the cell in cells.
+     * @return Returns an int with the amount of neighbouring cells that are alive
+     */
+    int countAliveNeighbours(int index) {
+        int aliveNeighbours = 0;
+        for (int i = 0; i < neighbourCount; i++)
+            aliveNeighbours += cells[index + neighbourOffsets[i]].isAlive();
+        return aliveNeighbours;
+    }
 
     /**
      * @brief Determines the next action that should happen for the current cell
@@ -109,21 +146,85 @@ public:
      * @param DIRECTIONS directions to neighbours
      * @param ruleName the rule that is applied
      */
-    RuleOfExistence(PopulationLimits limits, map<Point, Cell>& cells, const vector<Directions>& DIRECTIONS, string ruleName)
-            : POPULATION_LIMITS(limits), cells(cells), DIRECTIONS(DIRECTIONS), ruleName(ruleName) {}
+    RuleOfExistence(PopulationLimits limits, CellGrid& cells, const vector<Directions>& DIRECTIONS, string ruleName)
+            : POPULATION_LIMITS(limits), cells(cells), DIRECTIONS(DIRECTIONS), ruleName(ruleName) {
+        computeNeighbourOffsets();
+    }
     
     /**
      * @brief Destroy the Rule Of Existence object
      */
     virtual ~RuleOfExistence() {}
 
+    /**
+     * @brief Prepares the rule for a new generation, before any rows are
+     *  executed. Does nothing by default.
+     */
+    virtual void beginGeneration() {}
+
+    /**
+     * @brief Determines the next state of the cells in rows [firstRow, lastRow)
+     *  of the world.
+     * @details The cells of these rows and of the rows next to them must hold
+     *  their current state. Only the next state of the cells in the given rows
+     *  is written, so different rows of a generation may be executed
+     *  concurrently, and the rows below may still be waiting for their
+     *  current state to be committed.
+     *
+     * @param firstRow First row to execute.
+     * @param lastRow One past the last row to execute.
+     */
+    virtual void executeRows(int firstRow, int lastRow) = 0;
+
+    /**
+     * @brief Finishes a generation once all rows are executed. Does nothing by
+     *  default.
+     */
+    virtual void endGeneration() {}
+
+    /**
+     * @brief Describes the rule as an ActionTable, for rules that only look
+     *  at whether a cell and its neighbours are alive.
+     * @details The default uses getAction() with the DIRECTIONS of the rule,
+     *  rules that do more override it.
+     *
+     * @param table Set to the actions and counted neighbours of the rule.
+     * @return bool False if the rule can not be described by a table.
+     */
+    virtual bool getActionTable(ActionTable& table);
+
+    /**
+     * @brief Returns true if beginGeneration() reads the cells, or rows are
+     *  best executed many at a time.
+     * @details Population then commits every row before the generation is
+     *  begun and executes bands of rows, instead of committing rows while
+     *  others are executed one by one.
+     */
+    virtual bool needsCommittedGeneration() const { return false; }
+
+    /**
+     * @brief Forgets whatever the rule kept from earlier generations, as the
+     *  cells start over. Does nothing by default.
+     */
+    virtual void reset() {}
+
+    /**
+     * @brief Returns true if the next generation depends on more than which
+     *  cells are alive, such as their age. Such rules can not be resumed
+     *  from a board alone.
+     */
+    virtual bool keepsHistory() const { return false; }
+
     // Execute rule, in order specific to the concrete rule, by utilizing template method DP
     /**
      * @brief Execute rule, in order specific 
      * to the concrete rule, by utilizing template method DP
-     * @details Pure Virtual function that will be used by one of the derived classes
+     * @details Runs beginGeneration, executeRows for all rows of the world
+     *  split over the threads of the WorkStealingPool, and endGeneration.
+     *  The neighbour offsets are recomputed first if cells has been resized.
+     *  Population instead interleaves executeRows with committing the rows.
      */
-    virtual void executeRule() = 0;
+    void executeRule();
 
     string getRuleName() { return ruleName; }
 };
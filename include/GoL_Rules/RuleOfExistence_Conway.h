@@ -49,7 +49,7 @@ public:
  * rule name "conway", the population limits and ALL_DIRECTIONS.
  * @param cells the cell generation that the rule will be applied on
  */
-    RuleOfExistence_Conway(map<Point, Cell>& cells)
+    RuleOfExistence_Conway(CellGrid& cells)
             : RuleOfExistence({ 2,3,3 }, cells, ALL_DIRECTIONS, "conway") {}
     /**
      * @brief override of the base class destructor that Destroys the RuleOfExistence_Conway object
@@ -59,13 +59,13 @@ public:
 
     /**
      * @brief Execute the rule specific for Conway
-     * @details decides rules and executes them for all non rim cells
-     * and sets right colors depending on cells state
+     * @details decides rules and executes them for the non rim cells of the
+     * given rows and sets right colors depending on cells state
      * @test should determine what the next action should be for the cells
      * @test should set the according color for the action
      * @test should take all eight neighbours into account
      */
-    void executeRule();
+    void executeRows(int firstRow, int lastRow);
 };
 /** @} */
 
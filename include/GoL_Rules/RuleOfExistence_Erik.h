@@ -9,6 +9,7 @@
 #ifndef GAMEOFLIFE_RULEOFEXISTENCE_ERIK_H
 #define GAMEOFLIFE_RULEOFEXISTENCE_ERIK_H
 
+#include <mutex>
 #include "RuleOfExistence.h"
 
 /**
@@ -33,17 +34,59 @@ Uses same population limits as Conway rule.
 class RuleOfExistence_Erik : public RuleOfExistence
 {
 private:
+    /**
+     * @brief Oldest cell found in part of a generation, age -1 if none.
+     */
+    struct ElderCandidate {
+        int age;
+        int position;   /*!< column * rows + row, the order cells are visited in */
+    };
+
     char usedCellValue;	/*!< char value to differentiate very old cells */ 
-    Cell* primeElder;
+    int primeElder;     /*!< Index of the prime elder in cells, -1 if none */
+
+    int elderPosition;              /*!< Position of the previous prime elder, -1 if none */
+    ElderCandidate oldestBefore;    /*!< Oldest cell before elderPosition so far */
+    ElderCandidate oldestAfter;     /*!< Oldest cell after elderPosition so far */
+    mutex candidateLock;            /*!< Guards the candidates, rows run concurrently */
 
     /**
      * @brief determines the visualation of the passed cell population according to current state based on passed ACTION
+     * @details Prime elders are not handled here, see electPrimeElder.
      * 
      * @param cell current cell generation
      * @param action action to be taken
      */
     void erikfyCell(Cell& cell, ACTION action);
-    void setPrimeElder(Cell* newElder); /*!< visualises the set Prime Elder */ 
+
+    /**
+     * @brief Keeps the older of best and the cell at position, the earlier one
+     *  if their ages are equal.
+     */
+    static void keepOldest(ElderCandidate& best, int age, int position) {
+        if (age > best.age || (age == best.age && position < best.position))
+            best = ElderCandidate{age, position};
+    }
+
+    /**
+     * @brief Decides the prime elder of the generation and sets its color.
+     * @details The result is the same as visiting the cells one by one and
+     *  replacing the prime elder whenever a strictly older cell is found, as
+     *  the rule used to do. Since the elder of the previous generation is
+     *  forgotten where it dies, the oldest cells before and after its position
+     *  are given separately.
+     *
+     * @param before Oldest cell visited before the previous prime elder.
+     * @param after Oldest cell visited after it, or anywhere if there is none.
+     */
+    void electPrimeElder(ElderCandidate before, ElderCandidate after);
+
+    /**
+     * @brief Returns the position a cell is visited at, column by column.
+     */
+    int getPosition(int index) const {
+        return (index % cells.getColumns()) * cells.getRows() + index / cells.getColumns();
+    }
 
 public:
     /**
@@ -54,20 +97,36 @@ public:
      * 
      * @param cells cell generation on which the rule will be set
      */
-    RuleOfExistence_Erik(map<Point, Cell>& cells)
-            : RuleOfExistence({2,3,3}, cells, ALL_DIRECTIONS, "erik"), usedCellValue('E') {
-        primeElder = nullptr;
-    }
+    RuleOfExistence_Erik(CellGrid& cells)
+            : RuleOfExistence({2,3,3}, cells, ALL_DIRECTIONS, "erik"), usedCellValue('E'), primeElder(-1),
+              elderPosition(-1), oldestBefore{-1, 0}, oldestAfter{-1, 0} {}
      /**
      * @brief override of the base class destructor that Destroys the RuleOfExistence_Erik object
      * 
      */
     ~RuleOfExistence_Erik() {}
 
+    /**
+     * @brief Forgets the candidates of the previous generation.
+     */
+    void beginGeneration();
+
+    /**
+     * @brief Forgets the prime elder.
+     */
+    void reset() { primeElder = -1; }
+
+    /**
+     * @brief The elders are told apart by the age of the cells.
+     */
+    bool keepsHistory() const { return true; }
+
     /**
      * @brief Execute the rule specific for Erik
-     * @details decides rules and executes them for all non rim cells
-     * and sets right colors depending on cells state
+     * @details decides rules and executes them for the non rim cells of the
+     * given rows and sets right colors depending on cells state. Each call
+     * reports the oldest cells of its rows, which endGeneration reduces to a
+     * single prime elder.
      * @test should determine what the next action should be for the cells
      *       should set the according color for the action
      *       should take all eight neighbours into account
@@ -77,7 +136,17 @@ public:
      *       their should only be one Prime Elder in every generation
      *       
      */
-    void executeRule();
+    void executeRows(int firstRow, int lastRow);
+
+    /**
+     * @brief Elects the prime elder of the generation.
+     */
+    void endGeneration();
+
+    /**
+     * @brief Old cells and the prime elder depend on more than neighbours.
+     */
+    bool getActionTable(ActionTable&) { return false; }
 };
 /** @} */
 
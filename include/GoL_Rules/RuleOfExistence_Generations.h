@@ -0,0 +1,144 @@
+/**
+  * @file RuleOfExistence_Generations.h
+  * @date 2018-11-04
+  * @version 0.1
+  * @brief Generations RuleOfExistence, where dying cells pass through several
+  *  states before they are dead.
+  */
+
+#ifndef GAMEOFLIFE_RULEOFEXISTENCE_GENERATIONS_H
+#define GAMEOFLIFE_RULEOFEXISTENCE_GENERATIONS_H
+
+#include <cstdint>
+#include "RuleOfExistence.h"
+
+/**
+ * @addtogroup Rules Rule classes
+ * @brief Functions that decide the rules with which the simulation is run.
+ * @{
+ */
+
+/**
+ * @class RuleOfExistence_Generations derrived from RuleOfExistence
+ * @brief Concrete Rule of existence for the Generations family.
+ * @details A cell is dead (state 0), alive (state 1) or dying (states 2 to
+ *  states - 1). Dead cells with a birth count of living neighbours are born,
+ *  living cells with a survival count live on and otherwise start dying. A
+ *  dying cell moves on to the next state every generation, whatever its
+ *  neighbours, until it is dead. Only living cells count as neighbours.
+ *
+ *  The states are stored bit sliced, plane b of a word holding bit b of the
+ *  states of 64 cells of a row, so a cell takes one to four bits. Neighbours
+ *  are counted and states stepped for 64 cells at a time with bitwise
+ *  operations. Dying cells are dead to the Cell, which only shows their state
+ *  in the colors of DYING_COLORS.
+ *
+ *  Rules are named as in Golly, survival/birth/states, such as "/2/3" for
+ *  Brian's Brain or "345/2/4" for Star Wars. "B2/S/C3" is read as well, and
+ *  "brians_brain" and "star_wars" are shorthands.
+ */
+class RuleOfExistence_Generations : public RuleOfExistence
+{
+private:
+    int states;             /*!< Number of states, 2 to 16 */
+    int bits;               /*!< Planes needed to store states */
+    uint16_t birthCounts;   /*!< Bit n set if dead cells with n living neighbours are born */
+    uint16_t survivalCounts;/*!< Bit n set if living cells with n living neighbours live on */
+
+    int width;              /*!< Columns of the world */
+    int height;             /*!< Rows of the world */
+    int wordsPerRow;
+    vector<uint64_t> planes;        /*!< Current states, bits words per 64 cells */
+    vector<uint64_t> nextPlanes;    /*!< States of the next generation */
+
+    /**
+     * @brief Returns the mask of cells in state 1 of word of world row row,
+     *  wrapping or clipping the row.
+     */
+    uint64_t livingCells(int row, int word) const;
+
+    /**
+     * @brief Returns the color a cell in state should be drawn with.
+     */
+    COLOR getStateColor(int state) const;
+
+public:
+    /**
+     * @brief Construct a new RuleOfExistence_Generations object
+     *
+     * @param cells cell generation on which the rule will be set
+     * @param states number of states, 2 to 16
+     * @param birthCounts bit n set if dead cells with n living neighbours are born
+     * @param survivalCounts bit n set if living cells with n living neighbours live on
+     * @param ruleName name the rule was created by
+     */
+    RuleOfExistence_Generations(CellGrid& cells, int states, uint16_t birthCounts, uint16_t survivalCounts,
+                                string ruleName);
+
+    /**
+     * @brief override of the base class destructor that Destroys the RuleOfExistence_Generations object
+     */
+    ~RuleOfExistence_Generations() {}
+
+    /**
+     * @brief Reads the parameters of a rule from its name.
+     *
+     * @param ruleName "brians_brain", "star_wars" or a rule in the form
+     *  "S/B/C" or "Bb/Ss/Cc", where S and B are lists of neighbour counts.
+     * @param states Set to the number of states.
+     * @param birthCounts Set to the birth counts, bit n for n neighbours.
+     * @param survivalCounts Set to the survival counts, bit n for n neighbours.
+     * @return bool False if ruleName is no Generations rule.
+     *
+     * @test Test that both forms and the shorthands are read and others rejected.
+     */
+    static bool parseRuleName(const string& ruleName, int& states, uint16_t& birthCounts, uint16_t& survivalCounts);
+
+    /**
+     * @brief Brings the planes up to date with the cells.
+     * @details Living cells are in state 1. Cells that died by another rule
+     *  are dead and other cells keep their state, so dying cells go on dying.
+     */
+    void beginGeneration();
+
+    /**
+     * @brief Execute the rule specific for Generations
+     * @details steps the states of the given rows 64 cells at a time, then
+     * sets the actions and colors of the non rim cells
+     * @test should match stepping each cell on its own
+     */
+    void executeRows(int firstRow, int lastRow);
+
+    /**
+     * @brief Makes the stepped states current.
+     */
+    void endGeneration() { planes.swap(nextPlanes); }
+
+    /**
+     * @brief Dying cells need more states than dead and alive.
+     */
+    bool getActionTable(ActionTable&) { return false; }
+
+    /**
+     * @brief The planes are brought up to date from the whole generation.
+     */
+    bool needsCommittedGeneration() const { return true; }
+
+    /**
+     * @brief Forgets the dying cells, the planes are refilled from the cells.
+     */
+    void reset();
+
+    /**
+     * @brief Dying cells are not told apart from dead ones by the board.
+     */
+    bool keepsHistory() const { return states > 2; }
+
+    /**
+     * @brief Returns the state of the cell at world position (column, row).
+     */
+    int getState(int column, int row) const;
+};
+/** @} */
+
+#endif //GAMEOFLIFE_RULEOFEXISTENCE_GENERATIONS_H
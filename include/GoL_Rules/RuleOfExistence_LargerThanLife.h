@@ -0,0 +1,112 @@
+/**
+  * @file RuleOfExistence_LargerThanLife.h
+  * @date 2018-11-04
+  * @version 0.1
+  * @brief Larger than Life RuleOfExistence, counting neighbours within any
+  *  radius.
+  */
+
+#ifndef GAMEOFLIFE_RULEOFEXISTENCE_LARGERTHANLIFE_H
+#define GAMEOFLIFE_RULEOFEXISTENCE_LARGERTHANLIFE_H
+
+#include "RuleOfExistence.h"
+#include "Cell_Culture/SummedAreaTable.h"
+
+/**
+  * @addtogroup Structs Data structures
+  * @brief Structs used in the application to group data together.
+  * @{
+  */
+
+/**
+  *@struct LargerThanLifeLimits
+  *@brief Data structure for the parameters of a Larger than Life rule.
+  */
+struct LargerThanLifeLimits {
+    int radius;                 /*!< How far away neighbours may lie, 1 to 500 */
+    NEIGHBOURHOOD shape;        /*!< Square or diamond of cells around a cell */
+    bool countsCell;            /*!< Whether a cell counts as its own neighbour */
+    int survivalMin, survivalMax;   /*!< A living cell with this many neighbours lives on */
+    int birthMin, birthMax;     /*!< A dead cell with this many neighbours is reborn */
+}; /** @} */
+
+/**
+ * @addtogroup Rules Rule classes
+ * @brief Functions that decide the rules with which the simulation is run.
+ * @{
+ */
+
+/**
+ * @class RuleOfExistence_LargerThanLife derrived from RuleOfExistence
+ * @brief Concrete Rule of existence for the Larger than Life family.
+ * @details Cells live on or are reborn when the number of living cells in a
+ *  square or diamond of the given radius around them lies within a range. The
+ *  neighbours are counted from a SummedAreaTable built at the start of each
+ *  generation, so every cell costs the same no matter the radius.
+ *
+ *  Rules are named as in Golly, "R5,C0,M1,S34..58,B34..45,NM" being Bosco's
+ *  rule: radius 5, two states, the cell counted as its own neighbour,
+ *  survival with 34 to 58 and birth with 34 to 45 neighbours in a Moore
+ *  neighbourhood (NN for von Neumann). "bosco" is a shorthand for it.
+ */
+class RuleOfExistence_LargerThanLife : public RuleOfExistence
+{
+private:
+    const LargerThanLifeLimits LIMITS;
+    SummedAreaTable livingCells;    /*!< Living cells of the current generation */
+
+public:
+    /**
+     * @brief Construct a new RuleOfExistence_LargerThanLife object
+     *
+     * @param cells cell generation on which the rule will be set
+     * @param limits parameters of the rule
+     * @param ruleName name the rule was created by
+     */
+    RuleOfExistence_LargerThanLife(CellGrid& cells, LargerThanLifeLimits limits, string ruleName)
+            : RuleOfExistence({ limits.survivalMin, limits.survivalMax, limits.birthMin }, cells, ALL_DIRECTIONS,
+                              ruleName), LIMITS(limits) {}
+
+    /**
+     * @brief override of the base class destructor that Destroys the RuleOfExistence_LargerThanLife object
+     */
+    ~RuleOfExistence_LargerThanLife() {}
+
+    /**
+     * @brief Reads the parameters of a rule from its name.
+     *
+     * @param ruleName "bosco" or a rule in the form "Rr,Cc,Mm,Sa..b,Ba..b,Nx".
+     * @param limits Set to the parameters of the rule.
+     * @return bool False if ruleName is no Larger than Life rule.
+     *
+     * @test Test that Golly rule names and "bosco" are read and others rejected.
+     */
+    static bool parseRuleName(const string& ruleName, LargerThanLifeLimits& limits);
+
+    /**
+     * @brief Counts the living cells of the generation into the summed area
+     *  table of the shape of the neighbourhood.
+     */
+    void beginGeneration();
+
+    /**
+     * @brief Execute the rule specific for Larger than Life
+     * @details decides rules and executes them for the non rim cells of the
+     * given rows and sets right colors depending on cells state
+     * @test should match counting the neighbours one by one
+     */
+    void executeRows(int firstRow, int lastRow);
+
+    /**
+     * @brief The rule looks further than its nearest neighbours.
+     */
+    bool getActionTable(ActionTable&) { return false; }
+
+    /**
+     * @brief The summed area table is built from the whole generation.
+     */
+    bool needsCommittedGeneration() const { return true; }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_RULEOFEXISTENCE_LARGERTHANLIFE_H
@@ -0,0 +1,101 @@
+/**
+  * @file RuleOfExistence_Lookup.h
+  * @date 2018-11-04
+  * @version 0.1
+  * @brief RuleOfExistence stepping blocks of 2x2 cells by looking up their
+  *  4x4 neighbourhood in a table.
+  */
+
+#ifndef GAMEOFLIFE_RULEOFEXISTENCE_LOOKUP_H
+#define GAMEOFLIFE_RULEOFEXISTENCE_LOOKUP_H
+
+#include <cstdint>
+#include "RuleOfExistence.h"
+
+/**
+ * @addtogroup Rules Rule classes
+ * @brief Functions that decide the rules with which the simulation is run.
+ * @{
+ */
+
+/**
+ * @class RuleOfExistence_Lookup derrived from RuleOfExistence
+ * @brief Concrete Rule of existence, running another rule from a table of
+ *  every 4x4 block of cells.
+ * @details The next state of the 2x2 cells in the middle of a 4x4 block only
+ *  depends on the 16 cells of the block. Every block is tabulated once, when
+ *  the rule is constructed, in 65536 entries of four bits. A generation then
+ *  packs the living cells of its rows into bits and finds the next state of
+ *  four cells with one lookup, instead of counting the neighbours of every
+ *  cell.
+ *
+ *  Rows are stepped in pairs, so Population commits the whole generation
+ *  before executing bands of rows. A row without a partner in its band gets
+ *  the upper half of a block whose lowest row is left empty.
+ *
+ *  The rule is named "lookup:" followed by the name of the rule it runs,
+ *  which must have an ActionTable or be a Generations rule of two states,
+ *  such as "lookup:conway" or "lookup:23/36/2".
+ */
+class RuleOfExistence_Lookup : public RuleOfExistence
+{
+private:
+    ActionTable table;          /*!< Actions of the rule that is run */
+    vector<uint8_t> nextBlocks; /*!< Next state of the middle 2x2 cells, by the 16 cells of the block */
+
+    /**
+     * @brief Fills nextBlocks from table.
+     */
+    void tabulateBlocks();
+
+public:
+    /**
+     * @brief Construct a new RuleOfExistence_Lookup object
+     *
+     * @param cells cell generation on which the rule will be set
+     * @param innerRuleName name of the rule to run
+     *
+     * @throws ios_base::failure If the rule can not be described by an
+     *  ActionTable.
+     */
+    RuleOfExistence_Lookup(CellGrid& cells, string innerRuleName);
+
+    /**
+     * @brief override of the base class destructor that Destroys the RuleOfExistence_Lookup object
+     */
+    ~RuleOfExistence_Lookup() {}
+
+    /**
+     * @brief Returns the next state of the middle cells of a 4x4 block.
+     *
+     * @param block Bit 4 * y + x set if the cell in column x and row y of the
+     *  block is alive.
+     * @return int Bit 2 * y + x set if the cell in column x + 1 and row y + 1
+     *  of the block lives on or is born.
+     */
+    int getNextBlock(int block) const { return nextBlocks[block]; }
+
+    /**
+     * @brief Execute the rule that is run
+     * @details packs the rows, looks up every 2x2 block of cells and sets the
+     * actions and colors of the non rim cells as the rule that is run would
+     * @test should match running the rule that is run
+     */
+    void executeRows(int firstRow, int lastRow);
+
+    /**
+     * @brief Returns the table of the rule that is run.
+     */
+    bool getActionTable(ActionTable& table) {
+        table = this->table;
+        return true;
+    }
+
+    /**
+     * @brief Bands of rows are executed at once, read in pairs.
+     */
+    bool needsCommittedGeneration() const { return true; }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_RULEOFEXISTENCE_LOOKUP_H
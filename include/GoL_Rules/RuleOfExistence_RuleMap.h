@@ -0,0 +1,94 @@
+/**
+  * @file RuleOfExistence_RuleMap.h
+  * @date 2018-11-04
+  * @version 0.1
+  * @brief RuleOfExistence applying different rules to different regions of
+  *  the world.
+  */
+
+#ifndef GAMEOFLIFE_RULEOFEXISTENCE_RULEMAP_H
+#define GAMEOFLIFE_RULEOFEXISTENCE_RULEMAP_H
+
+#include <cstdint>
+#include "RuleOfExistence.h"
+
+/**
+ * @addtogroup Rules Rule classes
+ * @brief Functions that decide the rules with which the simulation is run.
+ * @{
+ */
+
+/**
+ * @class RuleOfExistence_RuleMap derrived from RuleOfExistence
+ * @brief Concrete Rule of existence, applying the rule a map assigns to the
+ *  region of each cell.
+ * @details The map is read from a file by FileLoader, naming the rules and
+ *  giving the index of the rule of every cell. The named rules are created by
+ *  the RuleFactory and turned into ActionTables, so only rules that look at
+ *  whether a cell and its nearest neighbours are alive can be used.
+ *
+ *  Every cell counts its cardinal and diagonal neighbours and looks up its
+ *  action in the table of its rule, masking out the neighbours the rule does
+ *  not count. Cells on either side of a rule boundary take the same steps,
+ *  so boundaries cost nothing extra.
+ *
+ *  The rule is named "map:" followed by the name of the map file.
+ */
+class RuleOfExistence_RuleMap : public RuleOfExistence
+{
+private:
+    vector<ActionTable> tables;     /*!< Table of each rule of the map */
+    Dimensions mapSize;             /*!< Columns and rows of the map */
+    vector<uint8_t> mapIds;         /*!< Rule index of each cell of the map, row by row */
+    vector<uint8_t> ruleIds;        /*!< Rule index of each cell of cells, rim included */
+    int mappedColumns, mappedRows;  /*!< Size of cells ruleIds was stretched to */
+
+    /**
+     * @brief Stretches the map over the world held by cells into ruleIds.
+     */
+    void stretchMap();
+
+public:
+    /**
+     * @brief Construct a new RuleOfExistence_RuleMap object
+     *
+     * @param cells cell generation on which the rule will be set
+     * @param mapFileName name of the file holding the map
+     *
+     * @throws ios_base::failure If the map can not be read, or names a rule
+     *  that can not be described by an ActionTable.
+     */
+    RuleOfExistence_RuleMap(CellGrid& cells, string mapFileName);
+
+    /**
+     * @brief override of the base class destructor that Destroys the RuleOfExistence_RuleMap object
+     */
+    ~RuleOfExistence_RuleMap() {}
+
+    /**
+     * @brief Stretches the map over the world again if cells was resized.
+     */
+    void beginGeneration();
+
+    /**
+     * @brief Execute the rules of the map
+     * @details looks up the action of each non rim cell of the given rows in
+     * the table of its rule and sets right colors depending on cells state
+     * @test should match running each rule of the map on its own region
+     */
+    void executeRows(int firstRow, int lastRow);
+
+    /**
+     * @brief The map holds several tables, not one.
+     */
+    bool getActionTable(ActionTable&) { return false; }
+
+    /**
+     * @brief Returns the index of the rule of the cell at a linear index of
+     *  cells.
+     */
+    int getRuleId(int index) const { return ruleIds[index]; }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_RULEOFEXISTENCE_RULEMAP_H
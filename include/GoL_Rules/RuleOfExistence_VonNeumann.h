@@ -38,7 +38,7 @@ public:
      * 
      * @param cells cell generation on which the rule will be set
      */
-    RuleOfExistence_VonNeumann(map<Point, Cell>& cells)
+    RuleOfExistence_VonNeumann(CellGrid& cells)
             : RuleOfExistence({ 2,3,3 }, cells, CARDINAL, "von_neumann") {}
 
     /**
@@ -49,13 +49,13 @@ public:
 
    /**
      * @brief Execute the rule specific for VonNeumann
-     * @details decides rules and executes them for all non rim cells
-     * and sets right colors depending on cells state
+     * @details decides rules and executes them for the non rim cells of the
+     * given rows and sets right colors depending on cells state
      * @test should determine what the next action should be for the cells
      * @test should set the according color for the action
      * @test should take only the four diagonal neighbours into account
      */
-    void executeRule();
+    void executeRows(int firstRow, int lastRow);
 };
 /** @} */
 
@@ -0,0 +1,103 @@
+/**
+ * @file RuleSchedule.h
+ * @brief Definition of RuleSchedule, the order in which rules are applied to
+ *  the generations.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_RULESCHEDULE_H
+#define GAMEOFLIFE_RULESCHEDULE_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @addtogroup Structs Data structures
+ * @brief Structs used in the application to group data together.
+ * @{
+ */
+
+/**
+ * @struct ScheduledRule
+ * @brief A rule and the number of consecutive generations it is applied to.
+ */
+struct ScheduledRule {
+    string ruleName;
+    int generations;
+}; /** @} */
+
+/**
+ * @addtogroup Rules Rule classes
+ * @brief Functions that decide the rules with which the simulation is run.
+ * @{
+ */
+
+/**
+ * @brief Cyclic list of rules, each applied to a number of consecutive
+ *  generations before the next one takes over.
+ * @details A schedule is written as entries separated by semicolons or line
+ *  breaks, each a rule name optionally followed by an asterisk and a number
+ *  of generations, e.g. "conway*100;von_neumann*5". After the last entry the
+ *  schedule starts over. Alternating an even and an odd rule is the schedule
+ *  "even;odd".
+ */
+class RuleSchedule {
+private:
+    vector<ScheduledRule> entries;
+
+public:
+    /**
+     * @brief Constructs an empty schedule.
+     */
+    RuleSchedule() {}
+
+    /**
+     * @brief Constructs the schedule alternating between two rules.
+     *
+     * @param evenRuleName Rule for even generations.
+     * @param oddRuleName Rule for odd generations, the even rule if empty.
+     */
+    RuleSchedule(string evenRuleName, string oddRuleName);
+
+    /**
+     * @brief Replaces the entries with those of a written schedule.
+     * @details Text after a # on a line is ignored, as are empty entries.
+     *
+     * @param text Schedule in the form "rule*generations;rule*generations".
+     * @return bool False, leaving the schedule empty, if an entry is malformed
+     *  or there are no entries.
+     *
+     * @test Test that counts default to one and malformed entries are rejected.
+     */
+    bool parse(const string& text);
+
+    /**
+     * @brief Replaces the entries with those of a schedule file, one or more
+     *  entries per line.
+     *
+     * @return bool False if the file can not be read or parse() fails.
+     */
+    bool loadFromFile(const string& fileName);
+
+    /**
+     * @brief Appends an entry, applying ruleName to the given number of
+     *  generations.
+     */
+    void add(string ruleName, int generations = 1);
+
+    const vector<ScheduledRule>& getEntries() const { return entries; }
+
+    bool empty() const { return entries.empty(); }
+
+    /**
+     * @brief Returns the number of generations after which the schedule
+     *  starts over.
+     */
+    long long getPeriod() const;
+};
+/** @} */
+
+#endif //GAMEOFLIFE_RULESCHEDULE_H
@@ -0,0 +1,142 @@
+/**
+ * @file ImageExporter.h
+ * @brief Declaration of ImageExporter, class that writes generations to image
+ *  files.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_IMAGEEXPORTER_H
+#define GAMEOFLIFE_IMAGEEXPORTER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Cell_Culture/Population.h"
+#include "Support/BoundedQueue.h"
+
+using namespace std;
+
+/**
+ * @brief Writes generations of a Population as PPM or PNG images, beside the
+ *  ScreenPrinter.
+ * @details Each cell becomes a square of scale x scale pixels in the RGB value
+ *  of its color, so LIVING, DEAD, OLD and ELDER cells look as they do in the
+ *  terminal. The simulation thread only copies the colors of the cells into a
+ *  frame and hands it over through a bounded queue; scaling, encoding and
+ *  writing happen on worker threads of the exporter. When the workers fall
+ *  behind, the queue fills up and the simulation waits for room rather than
+ *  buffering frames without limit.
+ */
+class ImageExporter {
+private:
+    /**
+     * @brief Colors of the cells of one generation, waiting to be written.
+     */
+    struct Frame {
+        int generation;
+        int width;
+        int height;
+        vector<uint8_t> colors; /*!< COLOR of each cell, row by row */
+    };
+
+    string prefix;          /*!< Path the file names start with */
+    IMAGE_FORMAT format;
+    int scale;              /*!< Pixels per cell side */
+    int interval;           /*!< Export every interval:th generation */
+
+    BoundedQueue<Frame> frames;
+    vector<thread> workers;
+    atomic<int> failedFrames;
+    bool finished;
+
+    /**
+     * @brief Encodes and writes frames until the queue is closed.
+     */
+    void workerLoop();
+
+    /**
+     * @brief Scales frame to RGB pixels, encodes it and writes its file.
+     */
+    bool writeFrame(const Frame& frame);
+
+public:
+    /**
+     * @brief Starts the workers of the exporter.
+     *
+     * @param prefix Path the file names start with, followed by the
+     *  generation number and the extension of format.
+     * @param format File format of the images.
+     * @param scale Pixels per cell side, at least one.
+     * @param interval Export every interval:th generation, at least one.
+     * @param queueCapacity Frames that may wait for a worker.
+     * @param workerCount Number of worker threads, at least one.
+     */
+    ImageExporter(string prefix, IMAGE_FORMAT format = PNG, int scale = 1, int interval = 1,
+                  size_t queueCapacity = 8, unsigned workerCount = 2);
+
+    /**
+     * @brief Writes the frames still queued and stops the workers.
+     */
+    ~ImageExporter();
+
+    ImageExporter(const ImageExporter&) = delete;
+    ImageExporter& operator=(const ImageExporter&) = delete;
+
+    /**
+     * @brief Queues the visible generation of population for writing, if
+     *  generation is a multiple of the interval.
+     *
+     * @param population Population to export.
+     * @param generation Number used in the file name.
+     *
+     * @test Test that files are written for every interval:th generation.
+     */
+    void exportFrame(Population& population, int generation);
+
+    /**
+     * @brief Blocks until every queued frame has been written and stops the
+     *  workers. No frames can be exported afterwards.
+     */
+    void finish();
+
+    /**
+     * @brief Returns the number of frames that could not be written.
+     */
+    int getFailedFrames() const { return failedFrames; }
+
+    /**
+     * @brief Returns the file name of the frame of generation.
+     */
+    string getFileName(int generation) const;
+
+    /**
+     * @brief Returns the RGB value of a terminal color.
+     */
+    static void getRGB(COLOR color, uint8_t rgb[3]);
+
+    /**
+     * @brief Encodes RGB pixels, three bytes per pixel row by row, as a
+     *  binary PPM image.
+     *
+     * @test Test the header and pixel data of a small image.
+     */
+    static string encodePPM(const vector<uint8_t>& pixels, int width, int height);
+
+    /**
+     * @brief Encodes RGB pixels, three bytes per pixel row by row, as a PNG
+     *  image.
+     * @details Rows use the Sub filter, which turns runs of equal pixels into
+     *  runs of zeros, or the Up filter when they repeat the row above. They
+     *  are compressed with fixed Huffman codes and runs of repeated bytes.
+     *  That keeps the encoder small and fast while the large uniform areas of
+     *  a board still compress well.
+     *
+     * @test Test the signature, header and size of a uniform image.
+     */
+    static string encodePNG(const vector<uint8_t>& pixels, int width, int height);
+};
+
+#endif //GAMEOFLIFE_IMAGEEXPORTER_H
@@ -0,0 +1,129 @@
+/**
+ * @file RunCache.h
+ * @brief Declaration of RunCache, boards of finished simulations kept on disk
+ *  by the content of the run.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_RUNCACHE_H
+#define GAMEOFLIFE_RUNCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "GoL_Rules/RuleSchedule.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Structs Data structures
+ * @brief Structs used in the application to group data together.
+ * @{
+ */
+
+/**
+ * @brief A generation of a run, read from the cache.
+ */
+struct CachedBoard {
+    uint64_t generation;
+    Dimensions worldSize;
+    uint64_t wordsPerRow;
+    uint64_t livingCells;
+    vector<uint64_t> board;     /*!< Rows of the world, packed as by BitBoard */
+}; /** @} */
+
+/**
+ * @addtogroup Library Library classes
+ * @brief Classes that run simulations for other programs, in process.
+ * @{
+ */
+
+/**
+ * @brief Content addressed store of the generations simulations reached.
+ * @details A run is addressed by a hash of its first board, the size and
+ *  topology of its world and its rule schedule, so equal runs share their
+ *  entries however they were started. Each generation stored is a file
+ *  named after it in the directory of the run:
+ *
+ *      <directory>/<run key>/<generation>.gol
+ *
+ *  A file holds a 64 byte header, magic "GOLCACHE", version, topology and
+ *  the length of the rule schedule, followed by the rule schedule and then
+ *  by a slot laid out as a LiveViewSlot of a live view: the slot fields
+ *  at the start of a 64 byte aligned block and the board 64 bytes into it.
+ *  The header lets a lookup reject the entries of another run that happens
+ *  to have the same key.
+ *
+ *  Entries are written to a temporary file and renamed into place, so any
+ *  number of threads and processes may share a cache. Nothing is ever
+ *  evicted.
+ */
+class RunCache {
+private:
+    string directory;
+
+public:
+    /**
+     * @brief Constructor of RunCache.
+     *
+     * @param directory Directory of the cache, created when the first entry
+     *  is stored.
+     */
+    explicit RunCache(string directory) : directory(directory) {}
+
+    /**
+     * @brief Returns the key of a run.
+     *
+     * @param board Living cells of the first generation, packed as by
+     *  BitBoard.
+     * @param worldSize Columns and rows of the world.
+     * @param topology Whether the world wraps around.
+     * @param ruleSchedule Rules of the run.
+     * @return string Sixteen hexadecimal digits.
+     *
+     * @test Test that equal runs get equal keys and a changed cell or rule
+     *  another key.
+     */
+    static string getRunKey(const vector<uint64_t>& board, Dimensions worldSize, TOPOLOGY topology,
+                            const RuleSchedule& ruleSchedule);
+
+    /**
+     * @brief Writes a generation of a run, replacing an entry of the same
+     *  generation.
+     *
+     * @param runKey Key of the run, from getRunKey().
+     * @param topology Topology the run key was made with.
+     * @param ruleSchedule Rule schedule the run key was made with.
+     * @param entry Generation and board to store.
+     * @return bool False if the entry could not be written.
+     */
+    bool store(const string& runKey, TOPOLOGY topology, const RuleSchedule& ruleSchedule, const CachedBoard& entry);
+
+    /**
+     * @brief Reads the latest generation of a run stored within a range.
+     *
+     * @param runKey Key of the run, from getRunKey().
+     * @param worldSize Size the run key was made with.
+     * @param topology Topology the run key was made with.
+     * @param ruleSchedule Rule schedule the run key was made with.
+     * @param first First generation looked for.
+     * @param last Last generation looked for.
+     * @param entry Set to the generation found.
+     * @return bool False if no valid entry lies within the range.
+     *
+     * @test Test that the latest entry up to last is found and entries of
+     *  other runs are rejected.
+     */
+    bool findLatest(const string& runKey, Dimensions worldSize, TOPOLOGY topology, const RuleSchedule& ruleSchedule,
+                    uint64_t first, uint64_t last, CachedBoard& entry) const;
+
+    /**
+     * @brief Returns the directory of the cache.
+     */
+    const string& getDirectory() const { return directory; }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_RUNCACHE_H
@@ -0,0 +1,143 @@
+/**
+ * @file Simulation.h
+ * @brief Declaration of Simulation, the C++ side of libgameoflife.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_SIMULATION_H
+#define GAMEOFLIFE_SIMULATION_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Cell_Culture/Population.h"
+#include "GoL_Rules/RuleSchedule.h"
+#include "Library/RunCache.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Library Library classes
+ * @brief Classes that run simulations for other programs, in process.
+ * @{
+ */
+
+/**
+ * @brief A Population and its rules, stepped and read by other programs.
+ * @details Population commits a generation only when it calculates the
+ *  next one, so its cells lag one generation behind the generations
+ *  calculated. Simulation reads each cell together with its pending action,
+ *  which makes the cells read after step() those of the newest generation.
+ *  Nothing is printed, so the terminal is not needed.
+ *
+ *  Given a RunCache, step() looks up the latest generation of the run it has
+ *  stored up to the target and resumes from it, and stores the generations
+ *  it reaches. Only runs whose rules keep nothing but the board are cached.
+ */
+class Simulation {
+private:
+    Population population;
+    RuleSchedule ruleSchedule;
+    uint64_t generation;
+
+    RunCache* cache;            /*!< Cache used by step(), nullptr if none */
+    uint64_t cacheInterval;     /*!< Generations between stored entries, 0 for the targets only */
+    string runKey;              /*!< Key of the run, empty until the cache is first used */
+
+    /**
+     * @brief Packs the current generation into board, returning its living
+     *  cells.
+     */
+    uint64_t readBoard(vector<uint64_t>& board);
+
+    /**
+     * @brief Steps through the cache, see setCache().
+     */
+    void stepCached(int generations);
+
+public:
+    /**
+     * @brief Creates the world of config and the rules of ruleSchedule.
+     *
+     * @param config Size, starting population and topology of the world.
+     * @param ruleSchedule Rules and how many consecutive generations each is
+     *  applied to.
+     * @throws invalid_argument If the world is empty or the schedule has no
+     *  rules.
+     * @throws ios_base::failure If the population file can not be read.
+     */
+    Simulation(const PopulationConfig& config, const RuleSchedule& ruleSchedule);
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    /**
+     * @brief Starts over with a new random world of the same size, reusing
+     *  the grid and the rules.
+     */
+    void restart(uint64_t seed, double density) {
+        population.restart(seed, density);
+        generation = 0;
+        runKey.clear();
+    }
+
+    /**
+     * @brief Makes step() read and write a cache of runs.
+     * @details The run is keyed by its first board, so a cache set after
+     *  the first step is not used until restart().
+     *
+     * @param cache Cache shared with other simulations, nullptr for none.
+     *  It must outlive its use by the simulation.
+     * @param interval Besides the generation each step() ends at, every
+     *  interval:th generation is stored, so later runs to other targets can
+     *  resume from it. 0 stores the ends of the steps only.
+     */
+    void setCache(RunCache* cache, uint64_t interval = 0) {
+        this->cache = cache;
+        cacheInterval = interval;
+    }
+
+    /**
+     * @brief Simulates a number of generations.
+     *
+     * @test Test that stepping matches a Population of the same seed, with
+     *  and without a cache.
+     */
+    void step(int generations);
+
+    /**
+     * @brief Returns whether the cell at world position (column, row) of the
+     *  current generation is alive, 0 being the first column and row.
+     */
+    bool isAlive(int column, int row);
+
+    /**
+     * @brief Copies a region of the current generation, one byte per cell.
+     *
+     * @return bool False, leaving cells untouched, if the region does not lie
+     *  within the world.
+     *
+     * @test Test that regions outside the world are rejected.
+     */
+    bool readRegion(int column, int row, int width, int height, uint8_t* cells);
+
+    /**
+     * @brief Returns the number of living cells of the current generation.
+     */
+    uint64_t countLivingCells();
+
+    /**
+     * @brief Returns the generations stepped since creation.
+     */
+    uint64_t getGeneration() const { return generation; }
+
+    /**
+     * @brief Returns the columns and rows of the world.
+     */
+    Dimensions getWorldSize() const { return population.getWorldSize(); }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_SIMULATION_H
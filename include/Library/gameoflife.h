@@ -0,0 +1,150 @@
+/**
+ * @file gameoflife.h
+ * @brief C interface of libgameoflife, running simulations in process.
+ * @details Everything the library exposes to other languages goes through
+ *  the functions declared here. Simulations are opaque handles, all sizes
+ *  are fixed width and no C++ type crosses the interface, so programs built
+ *  against one version keep working with later versions of the same
+ *  GOL_API_VERSION. Nothing is written to the terminal.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_LIBRARY_GAMEOFLIFE_H
+#define GAMEOFLIFE_LIBRARY_GAMEOFLIFE_H
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define GOL_EXPORT __declspec(dllexport)
+#elif defined(__GNUC__)
+#define GOL_EXPORT __attribute__((visibility("default")))
+#else
+#define GOL_EXPORT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Version of the interface, raised whenever it changes incompatibly.
+ */
+#define GOL_API_VERSION 1
+
+/**
+ * @brief Results of the functions of the interface.
+ */
+enum gol_status {
+    GOL_OK = 0,                 /*!< The call succeeded */
+    GOL_ERROR_ARGUMENT = -1,    /*!< A handle, size or region was invalid */
+    GOL_ERROR_RULES = -2,       /*!< The schedule was invalid or named an unknown rule */
+    GOL_ERROR_FILE = -3,        /*!< The population file could not be read */
+    GOL_ERROR_INTERNAL = -4     /*!< Memory ran out or the simulation failed */
+};
+
+/**
+ * @brief Handle of a simulation, created by gol_create() or gol_load().
+ */
+typedef struct gol_simulation gol_simulation;
+
+/**
+ * @brief Size and state of a simulation.
+ */
+typedef struct gol_stats {
+    uint64_t generation;        /*!< Generations stepped since creation */
+    uint64_t living_cells;      /*!< Living cells of the current generation */
+    int32_t width;              /*!< Columns of the world */
+    int32_t height;             /*!< Rows of the world */
+} gol_stats;
+
+/**
+ * @brief Returns the GOL_API_VERSION the library was built with.
+ */
+GOL_EXPORT int32_t gol_api_version(void);
+
+/**
+ * @brief Returns a static description of a status.
+ */
+GOL_EXPORT const char* gol_status_message(int32_t status);
+
+/**
+ * @brief Creates a simulation of a randomized world.
+ *
+ * @param rules Rule schedule such as "conway" or "conway*3;erik", NULL for
+ *  "conway".
+ * @param width Columns of the world.
+ * @param height Rows of the world.
+ * @param seed Seed of the random world, equal seeds give equal worlds.
+ * @param density Fraction of living cells, 0 to 1.
+ * @param torus Nonzero if the world wraps around.
+ * @param simulation Set to the new handle, or NULL on failure.
+ * @return GOL_OK or the reason the simulation could not be created.
+ */
+GOL_EXPORT int32_t gol_create(const char* rules, int32_t width, int32_t height, uint64_t seed, double density,
+                              int32_t torus, gol_simulation** simulation);
+
+/**
+ * @brief Creates a simulation of a world read from a population file, in
+ *  the format -f reads.
+ *
+ * @param rules Rule schedule, NULL for "conway".
+ * @param file_name Path of the population file.
+ * @param torus Nonzero if the world wraps around.
+ * @param simulation Set to the new handle, or NULL on failure.
+ * @return GOL_OK or the reason the simulation could not be created.
+ */
+GOL_EXPORT int32_t gol_load(const char* rules, const char* file_name, int32_t torus, gol_simulation** simulation);
+
+/**
+ * @brief Simulates a number of generations.
+ */
+GOL_EXPORT int32_t gol_step(gol_simulation* simulation, int32_t generations);
+
+/**
+ * @brief Makes gol_step read and write a cache of runs in a directory.
+ * @details A step to a generation the run reached before, in this or
+ *  another process, returns at once, and a step past it resumes from the
+ *  latest generation cached on the way. Runs whose rules remember more than
+ *  the board, such as "erik", are simulated as without a cache. Must be
+ *  called before the first step.
+ *
+ * @param simulation Simulation to cache.
+ * @param directory Directory of the cache, created if needed, NULL to stop
+ *  caching.
+ * @param interval Generations between the entries cached on the way to the
+ *  end of a step, 0 for the end of each step only.
+ */
+GOL_EXPORT int32_t gol_set_cache(gol_simulation* simulation, const char* directory, uint64_t interval);
+
+/**
+ * @brief Copies whether the cells of a region of the current generation
+ *  are alive.
+ *
+ * @param simulation Simulation to read.
+ * @param x First column of the region, 0 being the leftmost of the world.
+ * @param y First row of the region, 0 being the topmost of the world.
+ * @param width Columns of the region.
+ * @param height Rows of the region.
+ * @param cells Receives width * height bytes, row by row, 1 for each living
+ *  and 0 for each dead cell.
+ * @return GOL_ERROR_ARGUMENT if the region does not lie within the world.
+ */
+GOL_EXPORT int32_t gol_query_region(gol_simulation* simulation, int32_t x, int32_t y, int32_t width, int32_t height,
+                                    uint8_t* cells);
+
+/**
+ * @brief Fills stats with the size and state of a simulation.
+ */
+GOL_EXPORT int32_t gol_get_stats(gol_simulation* simulation, gol_stats* stats);
+
+/**
+ * @brief Frees a simulation, NULL is ignored.
+ */
+GOL_EXPORT void gol_destroy(gol_simulation* simulation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //GAMEOFLIFE_LIBRARY_GAMEOFLIFE_H
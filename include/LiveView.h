@@ -0,0 +1,186 @@
+/**
+ * @file LiveView.h
+ * @brief Declaration of LiveView, publishing the board in shared memory, and
+ *  LiveViewReader, reading it from other processes.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_LIVEVIEW_H
+#define GAMEOFLIFE_LIVEVIEW_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "Cell_Culture/Population.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Structs Data structures
+ * @brief Structs used in the application to group data together.
+ * @{
+ */
+
+/**
+ * @brief Start of a live view segment.
+ * @details The segment holds the header followed by LIVE_VIEW_SLOTS slots,
+ *  each a LiveViewSlot followed by the board of one generation. Boards are
+ *  packed as by BitBoard: each row takes wordsPerRow 64 bit words and the
+ *  lowest bit of a word holds the leftmost of its cells. All fields are
+ *  native endian.
+ */
+struct LiveViewHeader {
+    char magic[8];              /*!< "GOLVIEW" and a terminating zero */
+    uint32_t version;           /*!< Layout version, currently 1 */
+    uint32_t slotCount;         /*!< Number of slots following the header */
+    uint64_t slotSize;          /*!< Bytes from one slot to the next */
+    uint64_t boardWords;        /*!< Capacity of the board of each slot, in words */
+    atomic<uint64_t> latest;    /*!< Slot holding the newest generation */
+};
+
+/**
+ * @brief Seqlock'd description of the generation a slot holds.
+ * @details sequence is odd while the slot is written. A reader that sees the
+ *  same even sequence before and after reading the slot has read a
+ *  consistent generation.
+ */
+struct LiveViewSlot {
+    atomic<uint64_t> sequence;  /*!< Odd while the slot is written */
+    uint64_t generation;        /*!< Generation held by the slot */
+    uint32_t width;             /*!< Columns of the world */
+    uint32_t height;            /*!< Rows of the world */
+    uint64_t wordsPerRow;       /*!< Words holding one row of the board */
+    uint64_t livingCells;       /*!< Living cells of the generation */
+};
+
+/**
+ * @brief A generation read in place from a live view.
+ */
+struct LiveViewSnapshot {
+    uint64_t generation;
+    int width, height;
+    uint64_t wordsPerRow;
+    uint64_t livingCells;
+    const uint64_t* board;      /*!< Rows of the board, inside the segment */
+    int slot;                   /*!< Slot the snapshot was taken from */
+    uint64_t sequence;          /*!< Sequence of the slot when reading began */
+}; /** @} */
+
+/**
+ * @brief Number of slots of a live view, the newest generation and the one
+ *  being written.
+ */
+const int LIVE_VIEW_SLOTS = 2;
+
+/**
+ * @brief Publishes every generation in a POSIX shared memory segment.
+ * @details External tools map the segment and read the board where it lies.
+ *  Each generation is written to the slot readers are not directed to, under
+ *  the seqlock of that slot, and then made the latest. The simulation never
+ *  waits for readers, and a reader has a whole generation to read the latest
+ *  slot before it is written again. Readers notice when they were too slow
+ *  by the changed sequence and simply read the new latest slot.
+ */
+class LiveView {
+private:
+    string name;
+    int width, height;
+    uint64_t wordsPerRow;
+    size_t segmentSize;
+    char* segment;              /*!< Mapped segment, nullptr if it could not be created */
+
+    LiveViewHeader* getHeader() { return reinterpret_cast<LiveViewHeader*>(segment); }
+    LiveViewSlot* getSlot(int slot);
+
+public:
+    /**
+     * @brief Creates and maps the segment, replacing one of the same name.
+     *
+     * @param name Name of the segment, e.g. "/gameoflife".
+     * @param worldSize Columns and rows of the world, rim excluded.
+     */
+    LiveView(string name, Dimensions worldSize);
+
+    /**
+     * @brief Unmaps and removes the segment.
+     */
+    ~LiveView();
+
+    LiveView(const LiveView&) = delete;
+    LiveView& operator=(const LiveView&) = delete;
+
+    /**
+     * @brief Returns false if the segment could not be created.
+     */
+    bool isOpen() const { return segment != nullptr; }
+
+    /**
+     * @brief Packs the visible generation of population into the segment
+     *  and makes it the latest.
+     *
+     * @param population Population to publish, of the size of the view.
+     * @param generation Generation number published with the board.
+     *
+     * @test Test that a reader sees the board and the generation.
+     */
+    void publish(Population& population, int generation);
+
+    /**
+     * @brief Returns the name of the segment.
+     */
+    const string& getName() const { return name; }
+};
+
+/**
+ * @brief Maps a live view segment read only and reads snapshots in place.
+ */
+class LiveViewReader {
+private:
+    size_t segmentSize;
+    const char* segment;        /*!< Mapped segment, nullptr if not open */
+
+    const LiveViewHeader* getHeader() const { return reinterpret_cast<const LiveViewHeader*>(segment); }
+    const LiveViewSlot* getSlot(int slot) const;
+
+public:
+    /**
+     * @brief Maps the segment of the given name.
+     */
+    explicit LiveViewReader(string name);
+
+    /**
+     * @brief Unmaps the segment.
+     */
+    ~LiveViewReader();
+
+    LiveViewReader(const LiveViewReader&) = delete;
+    LiveViewReader& operator=(const LiveViewReader&) = delete;
+
+    /**
+     * @brief Returns false if the segment could not be mapped.
+     */
+    bool isOpen() const { return segment != nullptr; }
+
+    /**
+     * @brief Starts reading the latest generation.
+     * @details The board is not copied, snapshot points into the segment.
+     *  What is read from it is only valid if endRead() returns true.
+     *
+     * @param snapshot Set to the latest generation.
+     * @return bool False if nothing has been published yet or the slot was
+     *  being written.
+     */
+    bool beginRead(LiveViewSnapshot& snapshot) const;
+
+    /**
+     * @brief Returns true if the slot of snapshot was not written while it
+     *  was read.
+     *
+     * @test Test that a slot written again is detected.
+     */
+    bool endRead(const LiveViewSnapshot& snapshot) const;
+};
+
+#endif //GAMEOFLIFE_LIVEVIEW_H
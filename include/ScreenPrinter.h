@@ -13,6 +13,7 @@
 
 #include "../terminal/terminal.h"
 #include "Cell_Culture/Population.h"
+#include "Viewport.h"
 
 /**
  * @brief Responsible for visually representing the simulation world on screen.
@@ -27,6 +28,11 @@ private:
      */
     Terminal terminal;
 
+    /**
+     * @brief Part of the world that is printed.
+     */
+    Viewport viewport;
+
     /**
      * @brief Empty private constructor.
      */
@@ -44,13 +50,19 @@ public:
     }
 
     /**
-     * @brief Prints Population to screen.
-     * @todo Change type of WindowHeight and WindowWidth to Dimensions.
+     * @brief Prints the part of Population under the viewport to screen.
+     * @details Small enough worlds are printed one colored character per cell,
+     *  larger ones zoomed out with the glyphs of the viewport.
      * 
      * @param population Reference to Population object.
      */
     void printBoard(Population& population);
 
+    /**
+     * @brief Returns the viewport deciding what printBoard shows.
+     */
+    Viewport& getViewport() { return viewport; }
+
     /**
      * @brief Prints the help screen.
      */
@@ -0,0 +1,226 @@
+/**
+ * @file SimulationServer.h
+ * @brief Declaration of SimulationServer, a long lived process running
+ *  simulation jobs sent over a Unix domain socket.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_SIMULATIONSERVER_H
+#define GAMEOFLIFE_SIMULATIONSERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "GoL_Rules/RuleSchedule.h"
+#include "Library/RunCache.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @addtogroup Structs Data structures
+ * @brief Structs used in the application to group data together.
+ * @{
+ */
+
+/**
+ * @brief A simulation requested by a client.
+ */
+struct ServerJob {
+    string id;                  /*!< Name the client gave the job, sent back with the result */
+    PopulationConfig config;    /*!< Size, seed, density and topology of the world */
+    string rules;               /*!< Rule schedule as written by the client */
+    RuleSchedule ruleSchedule;  /*!< The parsed schedule */
+    int generations;            /*!< Generations to simulate */
+}; /** @} */
+
+/**
+ * @addtogroup Server Server classes
+ * @brief Classes that serve simulations to other processes.
+ * @{
+ */
+
+/**
+ * @brief Runs simulation jobs for clients connected to a Unix domain socket.
+ * @details Clients send one job per line and get one line back per job, in
+ *  the order the jobs finish:
+ *
+ *      run id=<name> seed=<n> generations=<n> size=<w>x<h> density=<f>
+ *          topology=<bounded|torus> rules=<schedule>
+ *      done <name> generation=<n> living=<n>
+ *      error <name> <reason>
+ *
+ *  All fields but id are optional, defaulting as the command line does, and
+ *  rules is written as for --schedule. Jobs of more cells or cell
+ *  generations than the limits of setJobLimits() are answered with
+ *  "error <name> too large". "quit" closes the connection once the results
+ *  of its jobs are sent.
+ *
+ *  A single thread accepts connections, reads jobs and writes results, all
+ *  sockets being non-blocking. Jobs run on the WorkStealingPool. The jobs
+ *  read in one round that are small are batched into tasks of about
+ *  batchWork cell generations, so a burst of tiny jobs costs a few tasks
+ *  instead of one each, while large jobs get a task of their own and are
+ *  still split over the cores by Population.
+ *
+ *  Every worker thread keeps its most recent simulations together with
+ *  their rules, constructed by RuleFactory. A job for a world of the same
+ *  size, topology and rules restarts one of them with the new seed instead
+ *  of allocating the grid and constructing the rules again.
+ *
+ *  With a RunCache, jobs that were run before are answered from the cache,
+ *  and jobs running further than one before resume from it.
+ */
+class SimulationServer {
+private:
+    /**
+     * @brief A client, shared with the tasks running its jobs.
+     */
+    struct Connection {
+        int socket;
+        string input;           /*!< Received bytes not yet forming a line */
+        bool inputClosed;       /*!< Set when the client hung up or sent quit */
+        mutex outputLock;       /*!< Guards output and pendingJobs */
+        string output;          /*!< Result lines not yet sent */
+        int pendingJobs;        /*!< Jobs queued or running */
+    };
+
+    /**
+     * @brief A job read from a connection, waiting to be dispatched.
+     */
+    struct QueuedJob {
+        shared_ptr<Connection> connection;
+        ServerJob job;
+    };
+
+    string socketPath;
+    uint64_t batchWork;         /*!< Cell generations up to which jobs are batched */
+    int listener;               /*!< Listening socket, -1 if not started */
+    int wakeRead, wakeWrite;    /*!< Pipe waking the loop for results and stop() */
+    atomic<bool> stopping;
+    vector<shared_ptr<Connection>> connections;
+    unique_ptr<RunCache> cache;     /*!< Cache of the jobs, nullptr if none */
+    uint64_t cacheInterval;         /*!< Generations between cached entries */
+    uint64_t maxCells;              /*!< Largest world a job may ask for */
+    uint64_t maxWork;               /*!< Most cell generations a job may ask for */
+    atomic<int> runningTasks;       /*!< Tasks of this server queued or running */
+
+    /**
+     * @brief Reads what a client sent and queues the jobs of its complete
+     *  lines.
+     * @return bool False if the connection failed.
+     */
+    bool readRequests(Connection& connection, const shared_ptr<Connection>& shared, vector<QueuedJob>& jobs);
+
+    /**
+     * @brief Sends as much of the pending output as the socket takes.
+     * @return bool False if the connection failed.
+     */
+    bool writeResults(Connection& connection);
+
+    /**
+     * @brief Submits the jobs of a round to the pool, batching small ones.
+     */
+    void dispatch(vector<QueuedJob>& jobs);
+
+    /**
+     * @brief Runs a job on the calling worker and queues its result.
+     */
+    void runJob(QueuedJob& queued);
+
+    /**
+     * @brief Queues a line for a connection and wakes the loop to send it.
+     */
+    void postResult(Connection& connection, const string& line, bool jobFinished);
+
+    /**
+     * @brief Closes every socket and removes the socket file.
+     */
+    void closeAll();
+
+public:
+    static const uint64_t DEFAULT_MAX_CELLS = 1 << 24;          /*!< Cells of a 4096x4096 world */
+    static const uint64_t DEFAULT_MAX_WORK = uint64_t(1) << 34; /*!< 1024 generations of the largest world */
+
+    /**
+     * @brief Constructor of SimulationServer.
+     *
+     * @param socketPath Path of the socket file, replaced if it exists.
+     * @param batchWork Jobs of fewer cell generations than this are batched.
+     */
+    explicit SimulationServer(string socketPath, uint64_t batchWork = 1 << 22);
+
+    /**
+     * @brief Closes the sockets, stop() must have returned from run().
+     */
+    ~SimulationServer();
+
+    SimulationServer(const SimulationServer&) = delete;
+    SimulationServer& operator=(const SimulationServer&) = delete;
+
+    /**
+     * @brief Creates the socket and starts listening.
+     *
+     * @return bool False if the socket could not be created.
+     */
+    bool start();
+
+    /**
+     * @brief Keeps the results of the jobs in a cache, before start().
+     *
+     * @param directory Directory of the cache.
+     * @param interval Generations between the entries stored on the way to
+     *  the last generation of a job, 0 for the last generation only.
+     *
+     * @test Test that a cached job gets the result of an uncached one.
+     */
+    void setCache(const string& directory, uint64_t interval);
+
+    /**
+     * @brief Limits the size of the jobs accepted, before start().
+     * @details Without it a job may have up to DEFAULT_MAX_CELLS cells and
+     *  DEFAULT_MAX_WORK cell generations.
+     *
+     * @param cells Most cells, width times height, of a job's world.
+     * @param work Most cells times generations of a job.
+     */
+    void setJobLimits(uint64_t cells, uint64_t work);
+
+    /**
+     * @brief Serves clients until stop() is called, then waits for the jobs
+     *  still running.
+     *
+     * @test Test that results of batched and single jobs match simulations
+     *  run on their own.
+     */
+    void run();
+
+    /**
+     * @brief Makes run() return. Safe to call from other threads and from
+     *  signal handlers.
+     */
+    void stop();
+
+    /**
+     * @brief Reads a job from a request line.
+     *
+     * @param line Request without its line break.
+     * @param job Set to the job.
+     * @param error Set to the reason if the line is rejected, "too large"
+     *  for a job beyond the limits.
+     * @param maxCells Most cells of the job's world.
+     * @param maxWork Most cell generations of the job.
+     * @return bool False if line is no valid run request.
+     *
+     * @test Test that fields default and bad values are rejected.
+     */
+    static bool parseJob(const string& line, ServerJob& job, string& error, uint64_t maxCells = DEFAULT_MAX_CELLS,
+                         uint64_t maxWork = DEFAULT_MAX_WORK);
+};
+/** @} */
+
+#endif //GAMEOFLIFE_SIMULATIONSERVER_H
@@ -0,0 +1,95 @@
+/**
+ * @file BoundedQueue.h
+ * @brief Definition of BoundedQueue, a blocking queue with a fixed capacity.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_BOUNDEDQUEUE_H
+#define GAMEOFLIFE_BOUNDEDQUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+using namespace std;
+
+/**
+ * @addtogroup Support Support classes
+ * @brief Classes supporting the simulation, without being part of it.
+ * @{
+ */
+
+/**
+ * @brief Queue handing items from producers to consumer threads.
+ * @details push() blocks while the queue is full, so a producer that is faster
+ *  than its consumers is slowed down instead of filling up memory. Once the
+ *  queue is closed, pop() drains the remaining items and then returns false.
+ *
+ * @tparam T Type of the items.
+ */
+template<typename T>
+class BoundedQueue {
+private:
+    deque<T> items;
+    size_t capacity;
+    bool closed;
+
+    mutex lock;
+    condition_variable notFull;
+    condition_variable notEmpty;
+
+public:
+    /**
+     * @brief Constructs an empty queue holding at most capacity items.
+     */
+    explicit BoundedQueue(size_t capacity) : capacity(capacity > 0 ? capacity : 1), closed(false) {}
+
+    /**
+     * @brief Adds an item, waiting for room if the queue is full.
+     *
+     * @return bool False if the queue was closed and item was dropped.
+     */
+    bool push(T item) {
+        unique_lock<mutex> guard(lock);
+        notFull.wait(guard, [this] { return items.size() < capacity || closed; });
+        if (closed)
+            return false;
+
+        items.push_back(move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest item, waiting for one if the queue is empty.
+     *
+     * @return bool False if the queue is closed and empty.
+     */
+    bool pop(T& item) {
+        unique_lock<mutex> guard(lock);
+        notEmpty.wait(guard, [this] { return !items.empty() || closed; });
+        if (items.empty())
+            return false;
+
+        item = move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Stops accepting items and wakes up everyone waiting.
+     */
+    void close() {
+        lock_guard<mutex> guard(lock);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_BOUNDEDQUEUE_H
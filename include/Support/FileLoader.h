@@ -9,9 +9,12 @@
 #ifndef FileLoaderH
 #define FileLoaderH
 
-#include <map>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include "Cell_Culture/Cell.h"
-#include "Globals.h"
+#include "Cell_Culture/CellGrid.h"
+#include "SupportStructures.h"
 
 using namespace std;
 
@@ -19,7 +22,7 @@ using namespace std;
  * @brief Determines starting values for simulation, based on contents of 
  * specified file.
  * @details Reads startup values from specified file, containing values for 
- * WORLD_DIMENSIONS and cell Population. Will create the corresponding cells.
+ * the world dimensions and cell Population. Will create the corresponding cells.
  */
 class FileLoader {
 
@@ -31,17 +34,38 @@ public:
 
     /**
      * @brief Loads a population seed from a file.
-     * @details Stores the population seed in a referenced std::map with mapping
-     *  Point -> Cell
+     * @details Stores the population seed in a referenced CellGrid, which is
+     *  resized to the dimensions read from the file.
      * 
-     * @param cells Reference to a std::map with cells mapped to points.
+     * @param fileName Name of the file to read.
+     * @param cells Reference to the CellGrid to fill.
+     * @param worldSize Set to the dimensions read from the file.
      * 
      * @test Test loading files with correct syntax of different size. Also test
      *  files with incorrect syntax, incorrect symbols and empty file.
      * @todo Add checks to ensure correct syntax is required for simulation to 
      *   start, throw error otherwise.
      */
-    void loadPopulationFromFile(map<Point, Cell>& cells);
+    void loadPopulationFromFile(const string& fileName, CellGrid& cells, Dimensions& worldSize);
+
+    /**
+     * @brief Loads a map assigning rules to the regions of the world.
+     * @details The first line holds the dimensions of the map, e.g. 4x2, and
+     *  the second the names of the rules separated by spaces. They are
+     *  followed by a line of digits for every row, each digit the index of
+     *  the rule of its cell. A map smaller than the world is stretched over it.
+     *
+     * @param mapFileName Name of the file to read.
+     * @param ruleNames Set to the names of the rules, at most ten.
+     * @param size Set to the dimensions of the map.
+     * @param ruleIds Set to the rule index of each cell of the map, row by row.
+     *
+     * @throws ios_base::failure If the file can not be read or is malformed.
+     *
+     * @test Test loading a map and a file that does not exist.
+     */
+    void loadRuleMapFromFile(const string& mapFileName, vector<string>& ruleNames, Dimensions& size,
+                             vector<uint8_t>& ruleIds);
 };
 
 #endif
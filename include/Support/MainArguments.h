@@ -9,8 +9,11 @@
 #ifndef GAMEOFLIFE_MAINARGUMENTS_H
 #define GAMEOFLIFE_MAINARGUMENTS_H
 
-#include "Globals.h"
+#include "SupportStructures.h"
 #include "ScreenPrinter.h"
+#include "GoL_Rules/RuleSchedule.h"
+#include <cstdint>
+#include <ctime>
 #include <sstream>
 #include <string>
 
@@ -36,10 +39,117 @@ struct ApplicationValues {
      */
     string evenRuleName, oddRuleName;
 
+    /**
+     * @brief Order in which the rules are applied, alternating the even and
+     *  odd rule unless a schedule is given.
+     */
+    RuleSchedule ruleSchedule;
+
     /**
      * @brief Number of generations to simulate before stop.
      */
     int maxGenerations = 100;
+
+    /**
+     * @brief Columns and rows of the world, rim excluded.
+     */
+    Dimensions worldSize = { 80, 24 };
+
+    /**
+     * @brief File the starting population is read from, empty to randomize
+     *  it.
+     */
+    string fileName;
+
+    /**
+     * @brief Number of random soups to search, zero runs a normal simulation.
+     */
+    int nrOfSoups = 0;
+
+    /**
+     * @brief Seed for randomized populations, defaults to the current time.
+     */
+    uint64_t seed = static_cast<uint64_t>(time(0));
+
+    /**
+     * @brief Fraction of living cells in randomized populations.
+     */
+    double density = 0.5;
+
+    /**
+     * @brief Whether the world is bounded or wraps around.
+     */
+    TOPOLOGY topology = BOUNDED;
+
+    /**
+     * @brief How the generations are calculated.
+     */
+    ENGINE engine = ADAPTIVE_ENGINE;
+
+    /**
+     * @brief Returns the configuration of the population to simulate.
+     */
+    PopulationConfig getPopulationConfig() const {
+        PopulationConfig config;
+        config.worldSize = worldSize;
+        config.fileName = fileName;
+        config.seed = seed;
+        config.density = density;
+        config.topology = topology;
+        config.engine = engine;
+        return config;
+    }
+
+    /**
+     * @brief Path the exported image files start with, empty if no images
+     *  are exported.
+     */
+    string exportPrefix;
+
+    /**
+     * @brief File format of the exported images.
+     */
+    IMAGE_FORMAT exportFormat = PNG;
+
+    /**
+     * @brief Export every exportInterval:th generation.
+     */
+    int exportInterval = 1;
+
+    /**
+     * @brief Pixels per cell side in the exported images.
+     */
+    int exportScale = 1;
+
+    /**
+     * @brief Number of worker processes the world is split over, zero runs
+     *  the simulation in this process.
+     */
+    int nrOfWorkers = 0;
+
+    /**
+     * @brief Path the checkpoint files of a distributed simulation start
+     *  with, empty if no checkpoints are written.
+     */
+    string checkpointPrefix;
+
+    /**
+     * @brief Generations between checkpoints, zero for the last generation
+     *  only.
+     */
+    int checkpointInterval = 0;
+
+    /**
+     * @brief Name of the shared memory segment the generations are
+     *  published in, empty if they are not.
+     */
+    string liveViewName;
+
+    /**
+     * @brief Path of the spec of a parameter sweep, empty if no sweep is
+     *  run.
+     */
+    string sweepFile;
 };
 /** @} */
 
@@ -170,7 +280,7 @@ public:
 
     /**
      * @brief Changes the world size for the simulation.
-     * @details Changes the WORLD_DIMENSIONS property of appValues. If no
+     * @details Changes the worldSize property of appValues. If no
      *  dimensions are provided printNoValue is run and the simulation does not
      *  start.
      * 
@@ -203,7 +313,7 @@ public:
 
     /**
      * @brief Sets the filename to fileNameArg
-     * @details Sets the global filename defined in Globals.h to fileNameArg.
+     * @details Sets the fileName property of appValues to fileNameArg.
      *  This will make the simulation use that file as input when starting the
      *  simulation.
      * 
@@ -263,6 +373,539 @@ public:
      * @test That it sets oddrule correctly.
      */
     void execute(ApplicationValues& appValues, char* oddRule);
+};
+
+/**
+ * @brief Runs a batch of random soups instead of a single simulation.
+ */
+class SoupsArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of SoupsArgument.
+     */
+    SoupsArgument() : BaseArgument("--soups") {}
+    /**
+     * @brief Destructor of SoupsArgument.
+     */
+    ~SoupsArgument() {}
+
+    /**
+     * @brief Sets the number of soups to search.
+     * @details Soups are always randomized, so the argument can not be
+     *  combined with -f.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param soups Number of soups.
+     *
+     * @test Test that it sets the number of soups correctly.
+     */
+    void execute(ApplicationValues& appValues, char* soups);
+};
+
+/**
+ * @brief Allows setting the seed of randomized populations, making runs
+ *  reproducible.
+ */
+class SeedArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of SeedArgument.
+     */
+    SeedArgument() : BaseArgument("--seed") {}
+    /**
+     * @brief Destructor of SeedArgument.
+     */
+    ~SeedArgument() {}
+
+    /**
+     * @brief Sets the random seed.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param seed Unsigned integer seed.
+     *
+     * @test Test that it sets the seed correctly.
+     */
+    void execute(ApplicationValues& appValues, char* seed);
+};
+
+/**
+ * @brief Allows setting the fraction of living cells in randomized
+ *  populations.
+ */
+class DensityArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of DensityArgument.
+     */
+    DensityArgument() : BaseArgument("--density") {}
+    /**
+     * @brief Destructor of DensityArgument.
+     */
+    ~DensityArgument() {}
+
+    /**
+     * @brief Sets the density, values outside 0 to 1 stop the simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param density Fraction of living cells.
+     *
+     * @test Test that it sets the density correctly.
+     */
+    void execute(ApplicationValues& appValues, char* density);
+};
+
+/**
+ * @brief Allows choosing between a bounded world and one that wraps around at
+ *  its edges.
+ */
+class TopologyArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of TopologyArgument.
+     */
+    TopologyArgument() : BaseArgument("--topology") {}
+    /**
+     * @brief Destructor of TopologyArgument.
+     */
+    ~TopologyArgument() {}
+
+    /**
+     * @brief Sets the topology, "bounded" or "torus". Other values stop the
+     *  simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param topology Name of the topology.
+     *
+     * @test Test that it sets the topology correctly.
+     */
+    void execute(ApplicationValues& appValues, char* topology);
+};
+
+/**
+ * @brief Sets the number of characters available for printing the world.
+ */
+class ViewportArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ViewportArgument.
+     */
+    ViewportArgument() : BaseArgument("--viewport") {}
+    /**
+     * @brief Destructor of ViewportArgument.
+     */
+    ~ViewportArgument() {}
+
+    /**
+     * @brief Sets the screen size of the viewport of ScreenPrinter.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param dimensions Screen size given as <columns>x<rows>.
+     *
+     * @test Test that it sets the screen size correctly.
+     */
+    void execute(ApplicationValues& appValues, char* dimensions);
+};
+
+/**
+ * @brief Zooms out so that each dot printed stands for a block of cells.
+ */
+class ZoomArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ZoomArgument.
+     */
+    ZoomArgument() : BaseArgument("--zoom") {}
+    /**
+     * @brief Destructor of ZoomArgument.
+     */
+    ~ZoomArgument() {}
+
+    /**
+     * @brief Sets the number of cells per dot side of the viewport of
+     *  ScreenPrinter. Values below one stop the simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param zoom Cells per dot side.
+     *
+     * @test Test that it sets the zoom correctly.
+     */
+    void execute(ApplicationValues& appValues, char* zoom);
+};
+
+/**
+ * @brief Moves the viewport to another part of the world.
+ */
+class PanArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of PanArgument.
+     */
+    PanArgument() : BaseArgument("--pan") {}
+    /**
+     * @brief Destructor of PanArgument.
+     */
+    ~PanArgument() {}
+
+    /**
+     * @brief Sets the top left cell shown by the viewport of ScreenPrinter.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param position Position given as <column>,<row>, counted from zero.
+     *
+     * @test Test that it sets the origin correctly.
+     */
+    void execute(ApplicationValues& appValues, char* position);
+};
+
+/**
+ * @brief Chooses the glyphs the world is printed with.
+ */
+class GlyphsArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of GlyphsArgument.
+     */
+    GlyphsArgument() : BaseArgument("--glyphs") {}
+    /**
+     * @brief Destructor of GlyphsArgument.
+     */
+    ~GlyphsArgument() {}
+
+    /**
+     * @brief Sets the glyphs of the viewport of ScreenPrinter, "cells",
+     *  "halfblock" or "braille". Other values stop the simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param glyphs Name of the glyphs.
+     *
+     * @test Test that it sets the glyphs correctly.
+     */
+    void execute(ApplicationValues& appValues, char* glyphs);
+};
+
+/**
+ * @brief Writes the generations to image files as well.
+ */
+class ExportArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ExportArgument.
+     */
+    ExportArgument() : BaseArgument("--export") {}
+    /**
+     * @brief Destructor of ExportArgument.
+     */
+    ~ExportArgument() {}
+
+    /**
+     * @brief Sets the path the image files start with.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param prefix Path, followed by the generation and extension.
+     *
+     * @test Test that it sets the prefix correctly.
+     */
+    void execute(ApplicationValues& appValues, char* prefix);
+};
+
+/**
+ * @brief Chooses the file format of the exported images.
+ */
+class ExportFormatArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ExportFormatArgument.
+     */
+    ExportFormatArgument() : BaseArgument("--export-format") {}
+    /**
+     * @brief Destructor of ExportFormatArgument.
+     */
+    ~ExportFormatArgument() {}
+
+    /**
+     * @brief Sets the format, "png" or "ppm". Other values stop the
+     *  simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param format Name of the format.
+     *
+     * @test Test that it sets the format correctly.
+     */
+    void execute(ApplicationValues& appValues, char* format);
+};
+
+/**
+ * @brief Exports only every Nth generation.
+ */
+class ExportIntervalArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ExportIntervalArgument.
+     */
+    ExportIntervalArgument() : BaseArgument("--export-every") {}
+    /**
+     * @brief Destructor of ExportIntervalArgument.
+     */
+    ~ExportIntervalArgument() {}
+
+    /**
+     * @brief Sets the export interval. Values below one stop the simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param interval Number of generations between exported images.
+     *
+     * @test Test that it sets the interval correctly.
+     */
+    void execute(ApplicationValues& appValues, char* interval);
+};
+
+/**
+ * @brief Enlarges the exported images.
+ */
+class ExportScaleArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ExportScaleArgument.
+     */
+    ExportScaleArgument() : BaseArgument("--export-scale") {}
+    /**
+     * @brief Destructor of ExportScaleArgument.
+     */
+    ~ExportScaleArgument() {}
+
+    /**
+     * @brief Sets the pixels per cell side. Values below one stop the
+     *  simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param scale Pixels per cell side.
+     *
+     * @test Test that it sets the scale correctly.
+     */
+    void execute(ApplicationValues& appValues, char* scale);
+};
+
+/**
+ * @brief Applies the rules in a schedule instead of alternating them.
+ */
+class ScheduleArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ScheduleArgument.
+     */
+    ScheduleArgument() : BaseArgument("--schedule") {}
+    /**
+     * @brief Destructor of ScheduleArgument.
+     */
+    ~ScheduleArgument() {}
+
+    /**
+     * @brief Sets the rule schedule, overriding -er and -or. A malformed
+     *  schedule stops the simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param schedule Schedule in the form "rule*generations;rule*generations".
+     *
+     * @test Test that it sets the schedule correctly.
+     */
+    void execute(ApplicationValues& appValues, char* schedule);
+};
+
+/**
+ * @brief Applies the rules in a schedule read from a file.
+ */
+class ScheduleFileArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of ScheduleFileArgument.
+     */
+    ScheduleFileArgument() : BaseArgument("--schedule-file") {}
+    /**
+     * @brief Destructor of ScheduleFileArgument.
+     */
+    ~ScheduleFileArgument() {}
+
+    /**
+     * @brief Reads the rule schedule from a file, overriding -er and -or. A
+     *  missing file or malformed schedule stops the simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param scheduleFile Name of the file holding the schedule.
+     */
+    void execute(ApplicationValues& appValues, char* scheduleFile);
+};
+
+/**
+ * @brief Applies the rules of a rule map to the regions it covers.
+ */
+class RuleMapArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of RuleMapArgument.
+     */
+    RuleMapArgument() : BaseArgument("--rule-map") {}
+    /**
+     * @brief Destructor of RuleMapArgument.
+     */
+    ~RuleMapArgument() {}
+
+    /**
+     * @brief Sets the even and odd rule to the map read from a file,
+     *  overriding -er and -or.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param ruleMap Name of the file holding the rule map.
+     *
+     * @test Test that it sets both rules to the map.
+     */
+    void execute(ApplicationValues& appValues, char* ruleMap);
+};
+
+/**
+ * @brief Splits the world over several worker processes.
+ */
+class WorkersArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of WorkersArgument.
+     */
+    WorkersArgument() : BaseArgument("--workers") {}
+    /**
+     * @brief Destructor of WorkersArgument.
+     */
+    ~WorkersArgument() {}
+
+    /**
+     * @brief Sets the number of worker processes. Can not be combined with
+     *  -f.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param workers Number of worker processes, at least 1.
+     *
+     * @test Test that it sets the number of workers correctly.
+     */
+    void execute(ApplicationValues& appValues, char* workers);
+};
+
+/**
+ * @brief Writes checkpoints of a distributed simulation.
+ */
+class CheckpointArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of CheckpointArgument.
+     */
+    CheckpointArgument() : BaseArgument("--checkpoint") {}
+    /**
+     * @brief Destructor of CheckpointArgument.
+     */
+    ~CheckpointArgument() {}
+
+    /**
+     * @brief Sets the path the checkpoint files start with.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param prefix Path prefix, e.g. "checkpoints/world".
+     */
+    void execute(ApplicationValues& appValues, char* prefix);
+};
+
+/**
+ * @brief Sets how often a distributed simulation writes checkpoints.
+ */
+class CheckpointIntervalArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of CheckpointIntervalArgument.
+     */
+    CheckpointIntervalArgument() : BaseArgument("--checkpoint-every") {}
+    /**
+     * @brief Destructor of CheckpointIntervalArgument.
+     */
+    ~CheckpointIntervalArgument() {}
+
+    /**
+     * @brief Sets the number of generations between checkpoints.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param interval Generations between checkpoints, at least 1.
+     */
+    void execute(ApplicationValues& appValues, char* interval);
+};
+
+/**
+ * @brief Publishes the generations in shared memory.
+ */
+class LiveViewArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of LiveViewArgument.
+     */
+    LiveViewArgument() : BaseArgument("--live-view") {}
+    /**
+     * @brief Destructor of LiveViewArgument.
+     */
+    ~LiveViewArgument() {}
+
+    /**
+     * @brief Sets the name of the shared memory segment.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param name Name of the segment, a slash followed by up to 254
+     *  characters other than slashes.
+     *
+     * @test Test that it sets the name and rejects names without a slash.
+     */
+    void execute(ApplicationValues& appValues, char* name);
+};
+
+/**
+ * @brief Runs the parameter sweep of a spec file.
+ */
+class SweepArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of SweepArgument.
+     */
+    SweepArgument() : BaseArgument("--sweep") {}
+    /**
+     * @brief Destructor of SweepArgument.
+     */
+    ~SweepArgument() {}
+
+    /**
+     * @brief Sets the path of the spec file.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param sweepFile Path of the spec file.
+     */
+    void execute(ApplicationValues& appValues, char* sweepFile);
+};
+
+/**
+ * @brief Allows choosing how the generations are calculated.
+ */
+class EngineArgument : public BaseArgument {
+public:
+    /**
+     * @brief Constructor of EngineArgument.
+     */
+    EngineArgument() : BaseArgument("--engine") {}
+    /**
+     * @brief Destructor of EngineArgument.
+     */
+    ~EngineArgument() {}
+
+    /**
+     * @brief Sets the engine, "grid", "chunk", "event" or "adaptive". Other
+     *  values stop the simulation.
+     *
+     * @param appValues Reference to an ApplicationValues struct.
+     * @param engine Name of the engine.
+     *
+     * @test Test that it sets the engine correctly.
+     */
+    void execute(ApplicationValues& appValues, char* engine);
 };/** @} */
 
 #endif //GAMEOFLIFE_MAINARGUMENTS_H
@@ -0,0 +1,85 @@
+/**
+ * @file MonotonicArena.h
+ * @brief Declaration of MonotonicArena, an allocator that releases all its
+ *  memory at once.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_MONOTONICARENA_H
+#define GAMEOFLIFE_MONOTONICARENA_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+using namespace std;
+
+/**
+ * @addtogroup Support Support classes
+ * @brief Classes supporting the simulation, without being part of it.
+ * @{
+ */
+
+/**
+ * @brief Hands out memory from large blocks and frees it all when destroyed.
+ * @details Allocation moves a pointer forward within the current block, and a
+ *  new block, twice as large as the previous, is requested when it runs out.
+ *  Individual allocations are never freed. Objects created in the arena are
+ *  not destroyed by it; whoever creates an object with a non-trivial
+ *  destructor must call that destructor before the arena goes away.
+ */
+class MonotonicArena {
+private:
+    /**
+     * @brief Header placed at the start of every block.
+     */
+    struct Block {
+        Block* previous;
+    };
+
+    Block* lastBlock;   /*!< Most recently allocated block */
+    char* next;         /*!< First free byte in lastBlock */
+    char* blockEnd;     /*!< One past the last byte of lastBlock */
+    size_t nextBlockSize;
+
+public:
+    /**
+     * @brief Constructs an arena, no memory is allocated until it is needed.
+     *
+     * @param initialBlockSize Size in bytes of the first block.
+     */
+    explicit MonotonicArena(size_t initialBlockSize = 1024)
+            : lastBlock(nullptr), next(nullptr), blockEnd(nullptr), nextBlockSize(initialBlockSize) {}
+
+    /**
+     * @brief Frees all blocks.
+     */
+    ~MonotonicArena() { release(); }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * @brief Returns size bytes aligned to alignment.
+     *
+     * @test Test that allocations are aligned and do not overlap.
+     */
+    void* allocate(size_t size, size_t alignment = alignof(max_align_t));
+
+    /**
+     * @brief Constructs a T in the arena.
+     */
+    template<class T, class... Args>
+    T* create(Args&&... args) {
+        return new (allocate(sizeof(T), alignof(T))) T(forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Frees all blocks, invalidating everything allocated so far.
+     */
+    void release();
+};
+/** @} */
+
+#endif //GAMEOFLIFE_MONOTONICARENA_H
@@ -0,0 +1,109 @@
+/**
+ * @file Random.h
+ * @brief Fast, seedable random number generation.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_RANDOM_H
+#define GAMEOFLIFE_RANDOM_H
+
+#include <cstdint>
+
+/**
+ * @addtogroup Support Support classes
+ * @brief Classes supporting the simulation, without being part of it.
+ * @{
+ */
+
+/**
+ * @brief Advances state and returns the next splitmix64 output.
+ * @details Used to expand a single seed into generator states and to derive
+ *  independent streams from a seed and a stream number.
+ *
+ * @param state Generator state, updated by the call.
+ * @return uint64_t Next output.
+ */
+inline uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Returns the seed of stream number stream derived from seed.
+ * @details Streams are numbered by the caller, e.g. per row of a board, which
+ *  makes the result independent of how the work is split between threads.
+ */
+inline uint64_t getStreamSeed(uint64_t seed, uint64_t stream) {
+    uint64_t state = seed ^ splitMix64(stream);
+    return splitMix64(state);
+}
+
+/**
+ * @brief The xoshiro256** generator, producing 64 random bits per call.
+ */
+class Xoshiro256 {
+private:
+    uint64_t state[4];
+
+    static uint64_t rotateLeft(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    /**
+     * @brief Constructs a generator whose state is expanded from seed.
+     */
+    explicit Xoshiro256(uint64_t seed) {
+        for (uint64_t& word : state)
+            word = splitMix64(seed);
+    }
+
+    /**
+     * @brief Returns the next 64 random bits.
+     */
+    uint64_t next() {
+        uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotateLeft(state[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief Returns 64 bits where each bit is set with the given probability.
+     * @details The probability is given in 1/65536ths. Random words are
+     *  combined with AND and OR following the binary digits of the
+     *  probability, starting at the lowest set digit, so a probability of one
+     *  half costs a single call to next().
+     *
+     * @param probability Probability of a set bit, 0 to 65536.
+     * @return uint64_t Random bits.
+     *
+     * @test Test that the fraction of set bits matches the probability.
+     */
+    uint64_t nextBits(uint32_t probability) {
+        if (probability == 0)
+            return 0;
+        if (probability >= 65536)
+            return ~0ULL;
+
+        int digit = 0;
+        while (!(probability & (1u << digit)))
+            digit++;
+
+        uint64_t bits = 0;
+        for (; digit < 16; digit++)
+            bits = (probability & (1u << digit)) ? (bits | next()) : (bits & next());
+        return bits;
+    }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_RANDOM_H
@@ -9,6 +9,9 @@
 #ifndef GAMEOFLIFE_SUPPORTSTRUCTURES_H
 #define GAMEOFLIFE_SUPPORTSTRUCTURES_H
 
+#include <cstdint>
+#include <string>
+
 /**
  * @addtogroup Structs Data structures
  * @brief Structs used in the application to group data together.
@@ -50,6 +53,47 @@ struct Point {
     }
 };
 
+/**
+ * @brief Enumeration of the ways the edges of the world can behave.
+ * @details In a BOUNDED world the outermost ring of cells is made of dead rim
+ *  cells. In a TORUS the edges wrap around, and the ring holds copies of the
+ *  cells on the opposite edge.
+ */
+enum TOPOLOGY { BOUNDED, TORUS };
+
+/**
+ * @brief Enumeration of the ways cells can be drawn on screen.
+ * @details CELL_CHARACTERS draws each cell as a colored character. The others
+ *  draw blocks of cells as dots, HALF_BLOCKS fitting 1x2 dots in a character
+ *  and BRAILLE 2x4 dots.
+ */
+enum GLYPHS { CELL_CHARACTERS, HALF_BLOCKS, BRAILLE };
+
+/**
+ * @brief Enumeration of the file formats frames can be exported as.
+ */
+enum IMAGE_FORMAT { PPM, PNG };
+
+/**
+ * @brief Enumeration of the shapes of the neighbourhood of a cell.
+ * @details MOORE holds the cells within a square around the cell, VON_NEUMANN
+ *  the cells within a diamond, at most the radius steps north, east, south or
+ *  west of it.
+ */
+enum NEIGHBOURHOOD { MOORE, VON_NEUMANN };
+
+/**
+ * @brief Enumeration of the ways a Population can calculate its generations.
+ * @details GRID_ENGINE has the rule visit every cell of the world.
+ *  EVENT_ENGINE only visits the cells around those that just changed, see
+ *  EventBoard, and CHUNK_ENGINE steps the 64x64 chunks around those that
+ *  just changed 64 cells at a time, see ChunkBoard. ADAPTIVE_ENGINE samples
+ *  the world as it runs and moves to the engine expected to be fastest.
+ *  EVENT_ENGINE and CHUNK_ENGINE need rule schedules whose rules all have
+ *  an ActionTable, other schedules are run on the grid whatever the engine.
+ */
+enum ENGINE { GRID_ENGINE, EVENT_ENGINE, CHUNK_ENGINE, ADAPTIVE_ENGINE };
+
 /**
  * @brief Data structure storing dimensions as width and height.
  */
@@ -63,6 +107,47 @@ struct Dimensions {
      * @brief Height stored as integer.
      */
     int HEIGHT;
+};
+
+/**
+ * @struct PopulationConfig
+ * @brief Data structure for everything a Population needs to set up its
+ *  world.
+ * @details Every Population keeps a copy of its own, so populations of
+ *  different sizes and seed sources can exist side by side, also on
+ *  different threads.
+ */
+struct PopulationConfig {
+    /**
+     * @brief Columns and rows of the world, rim excluded. Replaced by the
+     *  size read from fileName.
+     */
+    Dimensions worldSize = { 80, 24 };
+
+    /**
+     * @brief File the world is read from, empty to randomize it.
+     */
+    std::string fileName;
+
+    /**
+     * @brief Seed for randomizing the world.
+     */
+    uint64_t seed = 0;
+
+    /**
+     * @brief Fraction of living cells in a randomized world.
+     */
+    double density = 0.5;
+
+    /**
+     * @brief Whether the world is bounded or wraps around.
+     */
+    TOPOLOGY topology = BOUNDED;
+
+    /**
+     * @brief How the generations are calculated.
+     */
+    ENGINE engine = GRID_ENGINE;
 };/** @} */
 
 
@@ -0,0 +1,154 @@
+/**
+ * @file WorkStealingPool.h
+ * @brief Declaration of WorkStealingPool, a thread pool where idle workers
+ *  steal queued tasks from busy ones.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_WORKSTEALINGPOOL_H
+#define GAMEOFLIFE_WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @addtogroup Support Support classes
+ * @brief Classes supporting the simulation, without being part of it.
+ * @{
+ */
+
+/**
+ * @brief Thread pool with one task queue per worker and work stealing.
+ * @details Each worker pushes and pops tasks at the back of its own queue, and
+ *  when that runs dry it steals from the front of the other workers' queues.
+ *  Tasks submitted from outside the pool are spread round-robin over the
+ *  queues. A thread in waitForAll() helps executing any queued task
+ *  instead of blocking, so it must not be called from within a task, which
+ *  counts as unfinished itself. parallelFor() only ever runs chunks of its
+ *  own range on the calling thread, so it may be called from within a task.
+ */
+class WorkStealingPool {
+private:
+    /**
+     * @brief Task queue owned by a single worker.
+     */
+    struct WorkerQueue {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<WorkerQueue>> queues;
+    vector<thread> workers;
+
+    atomic<bool> stopping;
+    atomic<int> queuedTasks;    /*!< Tasks waiting in any queue */
+    atomic<int> unfinishedTasks;/*!< Tasks queued or currently running */
+    atomic<unsigned> nextQueue; /*!< Round-robin queue for external submits */
+
+    mutex idleLock;
+    condition_variable idleCondition;
+
+    /**
+     * @brief Index of the worker running on the calling thread, -1 if the
+     *  thread does not belong to any pool.
+     */
+    static thread_local int workerIndex;
+
+    /**
+     * @brief Pool the calling thread belongs to, nullptr if none.
+     */
+    static thread_local WorkStealingPool* workerPool;
+
+    /**
+     * @brief Takes a task from the back of the queue at index.
+     */
+    bool popTask(int index, function<void()>& task);
+
+    /**
+     * @brief Takes a task from the front of any queue but the thief's own.
+     */
+    bool stealTask(int thief, function<void()>& task);
+
+    /**
+     * @brief Finds and runs one task. Returns false if there was none.
+     */
+    bool runPendingTask();
+
+    /**
+     * @brief Main loop of each worker thread.
+     */
+    void workerLoop(int index);
+
+public:
+    /**
+     * @brief Starts threadCount workers.
+     * @param threadCount Number of worker threads, at least one is started.
+     */
+    explicit WorkStealingPool(unsigned threadCount = thread::hardware_concurrency());
+
+    /**
+     * @brief Finishes all queued tasks and joins the workers.
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Returns the process wide pool, sized after the number of cores.
+     *
+     * @return WorkStealingPool& Reference to the static instance.
+     */
+    static WorkStealingPool& getInstance();
+
+    /**
+     * @brief Queues a task for execution.
+     * @details Tasks submitted from a worker go to that worker's own queue,
+     *  where they are likely to run while their data is still in cache.
+     *
+     * @param task Function to run.
+     */
+    void submit(function<void()> task);
+
+    /**
+     * @brief Blocks until every submitted task has finished, running tasks on
+     *  the calling thread in the meantime.
+     * @details Never returns when called from within a task, as that task
+     *  has not finished. Code running in tasks waits for the tasks it
+     *  submitted itself instead.
+     */
+    void waitForAll();
+
+    /**
+     * @brief Splits [begin, end) into chunks of at least grain indices and runs
+     *  body(chunkBegin, chunkEnd) on them in parallel.
+     * @details The calling thread takes part in the work and the call returns
+     *  once all chunks are done, so it may be nested inside pool tasks. While
+     *  waiting for chunks other threads took, the caller yields rather than
+     *  running unrelated queued tasks on its stack, which could reach the
+     *  state of the task that called parallelFor().
+     *
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param grain Smallest number of indices handed out at a time.
+     * @param body Function processing one chunk.
+     */
+    void parallelFor(int begin, int end, int grain, const function<void(int, int)>& body);
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    unsigned getThreadCount() { return workers.size(); }
+};
+/** @} */
+
+#endif //GAMEOFLIFE_WORKSTEALINGPOOL_H
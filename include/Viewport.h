@@ -0,0 +1,110 @@
+/**
+ * @file Viewport.h
+ * @brief Definition of Viewport, the part of the world shown on screen.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#ifndef GAMEOFLIFE_VIEWPORT_H
+#define GAMEOFLIFE_VIEWPORT_H
+
+#include <string>
+#include <vector>
+#include "Cell_Culture/BitBoard.h"
+#include "Cell_Culture/Population.h"
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @brief Window onto the world that can be panned and zoomed.
+ * @details When zoomed out each dot of a glyph stands for a square block of
+ *  cells, and is drawn when enough of them are alive. Only the cells under
+ *  the viewport are read, packed into a BitBoard and counted with popcounts,
+ *  so the output never grows beyond the screen no matter how large the world
+ *  is.
+ */
+class Viewport {
+private:
+    Dimensions screen;  /*!< Characters available on screen */
+    Point origin;       /*!< World position of the top left cell shown */
+    int zoom;           /*!< Cells per dot side, 0 fits the whole world */
+    GLYPHS glyphs;      /*!< Glyphs used when zoomed out */
+    BitBoard board;     /*!< Cells under the viewport, reused between renders */
+
+public:
+    /**
+     * @brief Constructs a viewport of 80x24 characters that fits the world.
+     */
+    Viewport() : screen{80, 24}, origin{0, 0}, zoom(0), glyphs(BRAILLE) {}
+
+    /**
+     * @brief Sets the number of characters available on screen.
+     */
+    void setScreen(Dimensions screen) { this->screen = screen; }
+    Dimensions getScreen() const { return screen; }
+
+    /**
+     * @brief Sets the world position of the top left cell shown.
+     */
+    void setOrigin(Point origin) { this->origin = origin; }
+    Point getOrigin() const { return origin; }
+
+    /**
+     * @brief Moves the viewport by the given number of cells.
+     */
+    void pan(int columns, int rows) { origin = Point{origin.x + columns, origin.y + rows}; }
+
+    /**
+     * @brief Sets the number of cells per dot side, 0 fits the whole world.
+     */
+    void setZoom(int zoom) { this->zoom = zoom > 0 ? zoom : 0; }
+    int getZoom() const { return zoom; }
+
+    /**
+     * @brief Halves the number of cells per dot side, down to one.
+     */
+    void zoomIn() { zoom = zoom > 1 ? zoom / 2 : 1; }
+
+    /**
+     * @brief Doubles the number of cells per dot side.
+     */
+    void zoomOut() { zoom = zoom > 0 ? zoom * 2 : 2; }
+
+    /**
+     * @brief Sets the glyphs used to draw the cells.
+     */
+    void setGlyphs(GLYPHS glyphs) { this->glyphs = glyphs; }
+    GLYPHS getGlyphs() const { return glyphs; }
+
+    /**
+     * @brief Returns whether the world is drawn one character per cell.
+     * @details That is the case when asked for with CELL_CHARACTERS, or when
+     *  fitting a world that is small enough for the screen.
+     */
+    bool showsCells(Dimensions world) const;
+
+    /**
+     * @brief Returns the number of cells per dot side used for world.
+     *
+     * @test Test that a fitted world fills at most the screen.
+     */
+    int getScale(Dimensions world) const;
+
+    /**
+     * @brief Returns the origin moved inside world, where drawing starts.
+     */
+    Point getClampedOrigin(Dimensions world) const;
+
+    /**
+     * @brief Draws the cells under the viewport with the zoomed out glyphs.
+     *
+     * @param population Population holding the world.
+     * @return vector<string> One UTF-8 encoded line per screen row used.
+     *
+     * @test Test that blocks of cells end up as the right braille dots.
+     */
+    vector<string> render(Population& population);
+};
+
+#endif //GAMEOFLIFE_VIEWPORT_H
@@ -0,0 +1,55 @@
+/**
+ * @file BitBoard.cpp
+ * @brief Implementation of BitBoard, the living cells of a region packed one
+ *  bit per cell.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Cell_Culture/BitBoard.h"
+#include <algorithm>
+#include "Cell_Culture/Population.h"
+
+// Starts over with all cells dead.
+void BitBoard::reset(int width, int height) {
+    this->width = max(width, 0);
+    this->height = max(height, 0);
+    wordsPerRow = (this->width + 63) / 64;
+    words.assign(wordsPerRow * this->height, 0);
+}
+
+// The board has the layout of a region read from a population.
+void BitBoard::capture(Population& population, int left, int top, int width, int height) {
+    reset(width, height);
+    population.readRegion(left, top, this->width, this->height, words.data(), wordsPerRow);
+}
+
+// Masks the words of each row to the block and sums their popcounts.
+int BitBoard::countBlock(int left, int top, int width, int height) const {
+    int firstColumn = max(left, 0);
+    int lastColumn = min(left + width, this->width);
+    int firstRow = max(top, 0);
+    int lastRow = min(top + height, this->height);
+    if (firstColumn >= lastColumn || firstRow >= lastRow)
+        return 0;
+
+    int firstWord = firstColumn / 64;
+    int lastWord = (lastColumn - 1) / 64;
+    uint64_t firstMask = ~0ULL << (firstColumn % 64);
+    uint64_t lastMask = ~0ULL >> (63 - (lastColumn - 1) % 64);
+
+    int count = 0;
+    for (int row = firstRow; row < lastRow; row++) {
+        const uint64_t* boardRow = &words[row * wordsPerRow];
+
+        if (firstWord == lastWord) {
+            count += popcount(boardRow[firstWord] & firstMask & lastMask);
+            continue;
+        }
+        count += popcount(boardRow[firstWord] & firstMask);
+        for (int word = firstWord + 1; word < lastWord; word++)
+            count += popcount(boardRow[word]);
+        count += popcount(boardRow[lastWord] & lastMask);
+    }
+    return count;
+}
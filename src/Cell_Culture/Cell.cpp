@@ -48,16 +48,6 @@ void Cell::updateState() {
     }
 }
 
-// is the cell alive?
-bool Cell::isAlive() {
-    if (details.rimCell) {
-        return false;
-    }
-    else {
-        return details.age > 0;
-    }
-}
-
 // Sets the cells next action to take in its coming update.
 void Cell::setNextGenerationAction(ACTION action) {
     if (details.rimCell)
@@ -0,0 +1,59 @@
+/**
+ * @file CellGrid.cpp
+ * @brief Implementation of CellGrid, contiguous storage of all cells in the
+ *  world.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Cell_Culture/CellGrid.h"
+#include <algorithm>
+
+// Starts over with a grid of default cells.
+void CellGrid::reset(int columns, int rows) {
+    this->columns = columns;
+    this->rows = rows;
+    cells.assign(columns * rows, Cell());
+}
+
+// Copies the existing cells into a larger grid.
+void CellGrid::growToInclude(Point position) {
+    int newColumns = max(columns, position.x + 1);
+    int newRows = max(rows, position.y + 1);
+
+    vector<Cell> grown(newColumns * newRows);
+    for (int row = 0; row < rows; row++)
+        copy(cells.begin() + row * columns, cells.begin() + (row + 1) * columns, grown.begin() + row * newColumns);
+
+    cells.swap(grown);
+    columns = newColumns;
+    rows = newRows;
+}
+
+// Wraps the world by copying each edge to the halo on the other side.
+void CellGrid::refreshHalo() {
+    for (int row = 1; row < rows - 1; row++)
+        refreshHaloColumns(row);
+    refreshHaloRows();
+}
+
+// Copies the first and last cell of the row to the opposite halo.
+void CellGrid::refreshHaloColumns(int row) {
+    if (topology != TORUS || columns < 3)
+        return;
+
+    int width = columns - 2;
+    cells[row * columns] = cells[row * columns + width];
+    cells[row * columns + width + 1] = cells[row * columns + 1];
+}
+
+// Copies the full top and bottom rows of the world, so that the corners get
+// the diagonally opposite cells.
+void CellGrid::refreshHaloRows() {
+    if (topology != TORUS || rows < 3)
+        return;
+
+    int height = rows - 2;
+    copy(cells.begin() + height * columns, cells.begin() + (height + 1) * columns, cells.begin());
+    copy(cells.begin() + columns, cells.begin() + 2 * columns, cells.begin() + (height + 1) * columns);
+}
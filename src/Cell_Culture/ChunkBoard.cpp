@@ -0,0 +1,209 @@
+/**
+ * @file ChunkBoard.cpp
+ * @brief Implementation of ChunkBoard, a world of packed cells stepped 64x64
+ *  cells at a time, skipping the chunks where nothing happens.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Cell_Culture/ChunkBoard.h"
+#include <algorithm>
+#include "Cell_Culture/BitBoard.h"
+
+namespace {
+
+    // Adds a one bit input to a four bit counter, 64 cells at a time.
+    inline void addBit(uint64_t count[4], uint64_t input) {
+        for (int b = 0; b < 4; b++) {
+            uint64_t carry = count[b] & input;
+            count[b] ^= input;
+            input = carry;
+        }
+    }
+
+    // Cells whose bit sliced count is one of the set bits of counts.
+    inline uint64_t cellsCounting(const uint64_t count[4], uint16_t counts) {
+        uint64_t cells = 0;
+        for (int n = 0; n <= 8; n++) {
+            if ((counts >> n) & 1) {
+                uint64_t equal = ~0ull;
+                for (int b = 0; b < 4; b++)
+                    equal &= ((n >> b) & 1) ? count[b] : ~count[b];
+                cells |= equal;
+            }
+        }
+        return cells;
+    }
+}
+
+ChunkBoard::ChunkBoard(Dimensions worldSize, TOPOLOGY topology)
+        : worldSize(worldSize), topology(topology), wordsPerRow((max(worldSize.WIDTH, 0) + 63) / 64),
+          chunkRows((max(worldSize.HEIGHT, 0) + 63) / 64),
+          lastWordMask((worldSize.WIDTH % 64) ? (1ull << (worldSize.WIDTH % 64)) - 1 : ~0ull),
+          words(static_cast<size_t>(wordsPerRow) * max(worldSize.HEIGHT, 0) + wordsPerRow, 0), next(words.size(), 0),
+          changedChunks(static_cast<size_t>(wordsPerRow) * chunkRows, 0), activeChunks(changedChunks.size(), 0),
+          rowLiving(max(worldSize.HEIGHT, 0), 0), columnLiving(max(worldSize.WIDTH, 0), 0),
+          lastRule{0, 0, false, false}, evaluateAll(true), livingCells(0) {}
+
+// The spare row after the last one stays empty, the rows around a bounded
+// world.
+const uint64_t* ChunkBoard::getRow(int row) const {
+    if (row < 0 || row >= worldSize.HEIGHT) {
+        if (topology != TORUS)
+            return &words[static_cast<size_t>(worldSize.HEIGHT) * wordsPerRow];
+        row = (row + worldSize.HEIGHT) % worldSize.HEIGHT;
+    }
+    return &words[static_cast<size_t>(row) * wordsPerRow];
+}
+
+// Bit 0 gets the last cell of the word before, or of the row in a torus.
+uint64_t ChunkBoard::getWest(const uint64_t* row, int word) const {
+    uint64_t value = row[word] << 1;
+    if (word > 0)
+        value |= row[word - 1] >> 63;
+    else if (topology == TORUS)
+        value |= getCell(row, worldSize.WIDTH - 1);
+    return value;
+}
+
+// The last cell of the row gets the first one in a torus, the padding after
+// it being empty.
+uint64_t ChunkBoard::getEast(const uint64_t* row, int word) const {
+    uint64_t value = row[word] >> 1;
+    if (word + 1 < wordsPerRow)
+        value |= row[word + 1] << 63;
+    else if (topology == TORUS)
+        value |= getCell(row, 0) << ((worldSize.WIDTH - 1) % 64);
+    return value;
+}
+
+void ChunkBoard::setCells(const uint8_t* cells) {
+    fill(words.begin(), words.end(), 0);
+    fill(rowLiving.begin(), rowLiving.end(), 0);
+    fill(columnLiving.begin(), columnLiving.end(), 0);
+    livingCells = 0;
+    for (int row = 0; row < worldSize.HEIGHT; row++) {
+        for (int column = 0; column < worldSize.WIDTH; column++) {
+            if (cells[row * worldSize.WIDTH + column]) {
+                words[static_cast<size_t>(row) * wordsPerRow + column / 64] |= 1ull << (column % 64);
+                rowLiving[row]++;
+                columnLiving[column]++;
+                livingCells++;
+            }
+        }
+    }
+
+    changes.clear();
+    evaluateAll = true;
+}
+
+void ChunkBoard::storeWord(int row, int word, uint64_t value) {
+    uint64_t& stored = words[static_cast<size_t>(row) * wordsPerRow + word];
+    uint64_t changed = stored ^ value;
+    if (!changed)
+        return;
+
+    livingCells += BitBoard::popcount(value);
+    livingCells -= BitBoard::popcount(stored);
+    stored = value;
+    changedChunks[(row / 64) * wordsPerRow + word] = 1;
+
+    // every changed cell in turn, lowest first
+    for (; changed; changed &= changed - 1) {
+        int column = word * 64 + BitBoard::popcount((changed & (~changed + 1)) - 1);
+        int unit = getCell(&stored - word, column) ? 1 : -1;
+        rowLiving[row] += unit;
+        columnLiving[column] += unit;
+        changes.push_back(row * worldSize.WIDTH + column);
+    }
+}
+
+void ChunkBoard::step(const LaneRule& rule) {
+    if (rule.birthCounts != lastRule.birthCounts || rule.survivalCounts != lastRule.survivalCounts
+        || rule.cardinal != lastRule.cardinal || rule.diagonal != lastRule.diagonal) {
+        lastRule = rule;
+        evaluateAll = true;
+    }
+
+    // the chunks that changed and those around them, wrapping around a torus
+    if (evaluateAll)
+        fill(activeChunks.begin(), activeChunks.end(), 1);
+    else {
+        fill(activeChunks.begin(), activeChunks.end(), 0);
+        bool torus = topology == TORUS;
+        for (int chunkRow = 0; chunkRow < chunkRows; chunkRow++) {
+            for (int chunk = 0; chunk < wordsPerRow; chunk++) {
+                if (!changedChunks[chunkRow * wordsPerRow + chunk])
+                    continue;
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dx = -1; dx <= 1; dx++) {
+                        int y = chunkRow + dy, x = chunk + dx;
+                        if (torus) {
+                            y = (y + chunkRows) % chunkRows;
+                            x = (x + wordsPerRow) % wordsPerRow;
+                        }
+                        else if (y < 0 || y >= chunkRows || x < 0 || x >= wordsPerRow)
+                            continue;
+                        activeChunks[y * wordsPerRow + x] = 1;
+                    }
+                }
+            }
+        }
+    }
+    evaluateAll = false;
+
+    // step the words of the active chunks, from the words of this generation
+    for (int chunkRow = 0; chunkRow < chunkRows; chunkRow++) {
+        int lastRow = min(chunkRow * 64 + 64, worldSize.HEIGHT);
+        for (int word = 0; word < wordsPerRow; word++) {
+            if (!activeChunks[chunkRow * wordsPerRow + word])
+                continue;
+            uint64_t valid = (word + 1 == wordsPerRow) ? lastWordMask : ~0ull;
+
+            for (int row = chunkRow * 64; row < lastRow; row++) {
+                const uint64_t* above = getRow(row - 1);
+                const uint64_t* own = getRow(row);
+                const uint64_t* below = getRow(row + 1);
+
+                uint64_t cardinal[4] = {0, 0, 0, 0}, diagonal[4] = {0, 0, 0, 0};
+                if (rule.cardinal) {
+                    addBit(cardinal, above[word]);
+                    addBit(cardinal, below[word]);
+                    addBit(cardinal, getWest(own, word));
+                    addBit(cardinal, getEast(own, word));
+                }
+                if (rule.diagonal) {
+                    addBit(diagonal, getWest(above, word));
+                    addBit(diagonal, getEast(above, word));
+                    addBit(diagonal, getWest(below, word));
+                    addBit(diagonal, getEast(below, word));
+                }
+
+                // ripple carry addition of the two counts
+                uint64_t count[4], carry = 0;
+                for (int b = 0; b < 4; b++) {
+                    count[b] = cardinal[b] ^ diagonal[b] ^ carry;
+                    carry = (cardinal[b] & diagonal[b]) | (carry & (cardinal[b] ^ diagonal[b]));
+                }
+
+                uint64_t alive = own[word];
+                uint64_t born = ~alive & cellsCounting(count, rule.birthCounts);
+                uint64_t survives = alive & cellsCounting(count, rule.survivalCounts);
+                next[static_cast<size_t>(row) * wordsPerRow + word] = (born | survives) & valid;
+            }
+        }
+    }
+
+    // then store them, noting what changed
+    changes.clear();
+    fill(changedChunks.begin(), changedChunks.end(), 0);
+    for (int chunkRow = 0; chunkRow < chunkRows; chunkRow++) {
+        int lastRow = min(chunkRow * 64 + 64, worldSize.HEIGHT);
+        for (int word = 0; word < wordsPerRow; word++) {
+            if (!activeChunks[chunkRow * wordsPerRow + word])
+                continue;
+            for (int row = chunkRow * 64; row < lastRow; row++)
+                storeWord(row, word, next[static_cast<size_t>(row) * wordsPerRow + word]);
+        }
+    }
+}
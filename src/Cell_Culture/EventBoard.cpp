@@ -0,0 +1,136 @@
+/**
+ * @file EventBoard.cpp
+ * @brief Implementation of EventBoard, a world stepped by visiting only the
+ *  cells around those that changed.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Cell_Culture/EventBoard.h"
+#include <algorithm>
+
+EventBoard::EventBoard(Dimensions worldSize, TOPOLOGY topology)
+        : worldSize(worldSize), topology(topology),
+          alive(static_cast<size_t>(max(worldSize.WIDTH, 0)) * max(worldSize.HEIGHT, 0), 0),
+          counts(alive.size(), 0), queued(alive.size(), 0), rowLiving(max(worldSize.HEIGHT, 0), 0),
+          columnLiving(max(worldSize.WIDTH, 0), 0), lastRule{0, 0, false, false}, evaluateAll(true), livingCells(0) {
+    prepareRule(lastRule);
+}
+
+// Cells inside the edges reach their neighbours by fixed offsets, edge cells
+// wrap around or lose the neighbours outside the world.
+template<class Visit>
+void EventBoard::forEachNeighbour(int index, Visit visit) const {
+    static const int CARDINAL_STEPS[4][2] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+    static const int DIAGONAL_STEPS[4][2] = {{1, -1}, {1, 1}, {-1, 1}, {-1, -1}};
+    int width = worldSize.WIDTH;
+    int height = worldSize.HEIGHT;
+    int x = index % width, y = index / width;
+
+    if (x > 0 && x < width - 1 && y > 0 && y < height - 1) {
+        visit(index - width, false);
+        visit(index + 1, false);
+        visit(index + width, false);
+        visit(index - 1, false);
+        visit(index - width + 1, true);
+        visit(index + width + 1, true);
+        visit(index + width - 1, true);
+        visit(index - width - 1, true);
+        return;
+    }
+
+    for (int diagonal = 0; diagonal < 2; diagonal++) {
+        const int (*steps)[2] = diagonal ? DIAGONAL_STEPS : CARDINAL_STEPS;
+        for (int s = 0; s < 4; s++) {
+            int column = x + steps[s][0], row = y + steps[s][1];
+            if (topology == TORUS) {
+                column = (column + width) % width;
+                row = (row + height) % height;
+            }
+            else if (column < 0 || column >= width || row < 0 || row >= height)
+                continue;
+            visit(row * width + column, diagonal != 0);
+        }
+    }
+}
+
+// The table is only rebuilt, and every cell looked at, when the rule changes.
+void EventBoard::prepareRule(const LaneRule& rule) {
+    if (rule.birthCounts == lastRule.birthCounts && rule.survivalCounts == lastRule.survivalCounts
+        && rule.cardinal == lastRule.cardinal && rule.diagonal == lastRule.diagonal && !evaluateAll)
+        return;
+
+    for (int count = 0; count < 256; count++) {
+        int neighbours = (rule.cardinal ? count & 15 : 0) + (rule.diagonal ? count >> 4 : 0);
+        nextState[0][count] = neighbours <= 8 && ((rule.birthCounts >> neighbours) & 1);
+        nextState[1][count] = neighbours <= 8 && ((rule.survivalCounts >> neighbours) & 1);
+    }
+    lastRule = rule;
+    evaluateAll = true;
+}
+
+void EventBoard::setCells(const uint8_t* cells) {
+    fill(rowLiving.begin(), rowLiving.end(), 0);
+    fill(columnLiving.begin(), columnLiving.end(), 0);
+    livingCells = 0;
+    for (size_t i = 0; i < alive.size(); i++) {
+        alive[i] = cells[i] != 0;
+        rowLiving[i / worldSize.WIDTH] += alive[i];
+        columnLiving[i % worldSize.WIDTH] += alive[i];
+        livingCells += alive[i];
+    }
+
+    fill(counts.begin(), counts.end(), 0);
+    for (int i = 0; i < static_cast<int>(alive.size()); i++) {
+        if (alive[i])
+            forEachNeighbour(i, [this](int neighbour, bool diagonal) { counts[neighbour] += diagonal ? 16 : 1; });
+    }
+
+    changes.clear();
+    evaluateAll = true;
+}
+
+void EventBoard::step(const LaneRule& rule) {
+    prepareRule(rule);
+
+    // find the cells that change, from the counts of this generation
+    changed.clear();
+    if (evaluateAll) {
+        for (int i = 0; i < static_cast<int>(alive.size()); i++) {
+            if (nextState[alive[i]][counts[i]] != alive[i])
+                changed.push_back(i);
+        }
+        evaluateAll = false;
+    }
+    else {
+        candidates.clear();
+        auto enqueue = [this](int cell, bool) {
+            if (!queued[cell]) {
+                queued[cell] = 1;
+                candidates.push_back(cell);
+            }
+        };
+        for (int cell : changes) {
+            enqueue(cell, false);
+            forEachNeighbour(cell, enqueue);
+        }
+        for (int cell : candidates) {
+            queued[cell] = 0;
+            if (nextState[alive[cell]][counts[cell]] != alive[cell])
+                changed.push_back(cell);
+        }
+    }
+
+    // then change them, each telling its neighbours
+    for (int cell : changed) {
+        alive[cell] ^= 1;
+        int unit = alive[cell] ? 1 : -1;
+        livingCells += unit;
+        rowLiving[cell / worldSize.WIDTH] += unit;
+        columnLiving[cell % worldSize.WIDTH] += unit;
+        forEachNeighbour(cell, [this, unit](int neighbour, bool diagonal) {
+            counts[neighbour] = static_cast<uint8_t>(counts[neighbour] + (diagonal ? 16 * unit : unit));
+        });
+    }
+    changes.swap(changed);
+}
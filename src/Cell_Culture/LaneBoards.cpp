@@ -0,0 +1,171 @@
+/**
+ * @file LaneBoards.cpp
+ * @brief Implementation of LaneBoards, 64 worlds of one size stepped
+ *  together, one bit of every word per world.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Cell_Culture/LaneBoards.h"
+#include <algorithm>
+
+namespace {
+
+    // Adds a one bit input to a four bit counter, 64 lanes at a time.
+    inline void addBit(uint64_t count[4], uint64_t input) {
+        for (int b = 0; b < 4; b++) {
+            uint64_t carry = count[b] & input;
+            count[b] ^= input;
+            input = carry;
+        }
+    }
+
+    // Lanes whose bit sliced count is one of the set bits of counts.
+    inline uint64_t lanesCounting(const uint64_t count[4], uint16_t counts) {
+        uint64_t lanes = 0;
+        for (int n = 0; n <= 8; n++) {
+            if ((counts >> n) & 1) {
+                uint64_t equal = ~0ull;
+                for (int b = 0; b < 4; b++)
+                    equal &= ((n >> b) & 1) ? count[b] : ~count[b];
+                lanes |= equal;
+            }
+        }
+        return lanes;
+    }
+
+    // Swaps bit j of word i with bit i of word j, halving the block size
+    // each round (Hacker's Delight 7-3).
+    void transpose(uint64_t words[64]) {
+        uint64_t mask = 0x00000000FFFFFFFFull;
+        for (int width = 32; width != 0; width >>= 1, mask ^= mask << width) {
+            for (int k = 0; k < 64; k = ((k | width) + 1) & ~width) {
+                uint64_t swapped = ((words[k] >> width) ^ words[k | width]) & mask;
+                words[k] ^= swapped << width;
+                words[k | width] ^= swapped;
+            }
+        }
+    }
+}
+
+const int LaneBoards::LANES;
+
+LaneBoards::LaneBoards(Dimensions worldSize, TOPOLOGY topology)
+        : worldSize(worldSize), topology(topology), wordsPerRow((max(worldSize.WIDTH, 0) + 63) / 64),
+          rowStride(64 * wordsPerRow), cells(static_cast<size_t>(rowStride) * max(worldSize.HEIGHT, 0), 0),
+          next(cells.size(), 0) {}
+
+LaneRule LaneBoards::getLaneRule(const ActionTable& table) {
+    LaneRule rule{0, 0, table.cardinalMask != 0, table.diagonalMask != 0};
+    for (int n = 0; n <= 8; n++) {
+        if (table.actions[0][n] == GIVE_CELL_LIFE)
+            rule.birthCounts |= 1 << n;
+        if (table.actions[1][n] != KILL_CELL)
+            rule.survivalCounts |= 1 << n;
+    }
+    return rule;
+}
+
+void LaneBoards::setLane(int lane, const uint64_t* bitmap) {
+    uint64_t bit = 1ull << lane;
+    for (int row = 0; row < worldSize.HEIGHT; row++) {
+        uint64_t* cell = &cells[static_cast<size_t>(row) * rowStride];
+        for (int column = 0; column < worldSize.WIDTH; column++) {
+            bool alive = bitmap && ((bitmap[row * wordsPerRow + column / 64] >> (column % 64)) & 1);
+            cell[column] = alive ? (cell[column] | bit) : (cell[column] & ~bit);
+        }
+    }
+}
+
+// Counts the neighbours of every cell word once per kind of neighbourhood the
+// rules use, then lets each rule decide its lanes.
+void LaneBoards::step(const vector<LaneRule>& rules, const vector<uint64_t>& ruleLanes) {
+    int width = worldSize.WIDTH;
+    int height = worldSize.HEIGHT;
+    bool torus = topology == TORUS;
+
+    bool countCardinal = false, countDiagonal = false;
+    uint64_t steppedLanes = 0;
+    for (size_t r = 0; r < rules.size(); r++) {
+        countCardinal |= rules[r].cardinal;
+        countDiagonal |= rules[r].diagonal;
+        steppedLanes |= ruleLanes[r];
+    }
+
+    const vector<uint64_t> deadRow(rowStride, 0);
+    for (int y = 0; y < height; y++) {
+        const uint64_t* above = (y > 0) ? &cells[static_cast<size_t>(y - 1) * rowStride]
+                                        : (torus ? &cells[static_cast<size_t>(height - 1) * rowStride] : deadRow.data());
+        const uint64_t* below = (y + 1 < height) ? &cells[static_cast<size_t>(y + 1) * rowStride]
+                                                 : (torus ? cells.data() : deadRow.data());
+        const uint64_t* own = &cells[static_cast<size_t>(y) * rowStride];
+        uint64_t* result = &next[static_cast<size_t>(y) * rowStride];
+
+        for (int x = 0; x < width; x++) {
+            int west = (x > 0) ? x - 1 : (torus ? width - 1 : -1);
+            int east = (x + 1 < width) ? x + 1 : (torus ? 0 : -1);
+
+            uint64_t cardinal[4] = {0, 0, 0, 0}, diagonal[4] = {0, 0, 0, 0};
+            if (countCardinal) {
+                addBit(cardinal, above[x]);
+                addBit(cardinal, below[x]);
+                if (west >= 0)
+                    addBit(cardinal, own[west]);
+                if (east >= 0)
+                    addBit(cardinal, own[east]);
+            }
+            if (countDiagonal) {
+                if (west >= 0) {
+                    addBit(diagonal, above[west]);
+                    addBit(diagonal, below[west]);
+                }
+                if (east >= 0) {
+                    addBit(diagonal, above[east]);
+                    addBit(diagonal, below[east]);
+                }
+            }
+
+            uint64_t alive = own[x];
+            uint64_t stepped = 0;
+            for (size_t r = 0; r < rules.size(); r++) {
+                uint64_t count[4] = {0, 0, 0, 0};
+                if (rules[r].cardinal && rules[r].diagonal) {
+                    // ripple carry addition of the two counts
+                    uint64_t carry = 0;
+                    for (int b = 0; b < 4; b++) {
+                        count[b] = cardinal[b] ^ diagonal[b] ^ carry;
+                        carry = (cardinal[b] & diagonal[b]) | (carry & (cardinal[b] ^ diagonal[b]));
+                    }
+                }
+                else {
+                    const uint64_t* only = rules[r].cardinal ? cardinal : diagonal;
+                    if (rules[r].cardinal || rules[r].diagonal)
+                        copy(only, only + 4, count);
+                }
+
+                uint64_t born = ~alive & lanesCounting(count, rules[r].birthCounts);
+                uint64_t survives = alive & lanesCounting(count, rules[r].survivalCounts);
+                stepped |= (born | survives) & ruleLanes[r];
+            }
+            result[x] = stepped | (alive & ~steppedLanes);
+        }
+    }
+    cells.swap(next);
+}
+
+// Transposes 64 cell words at a time into one bitmap word per lane.
+void LaneBoards::readLanes(vector<uint64_t>& bitmaps) const {
+    int bitmapWords = getBitmapWords();
+    bitmaps.resize(static_cast<size_t>(LANES) * bitmapWords);
+
+    uint64_t block[64];
+    for (int row = 0; row < worldSize.HEIGHT; row++) {
+        for (int word = 0; word < wordsPerRow; word++) {
+            const uint64_t* cell = &cells[static_cast<size_t>(row) * rowStride + word * 64];
+            copy(cell, cell + 64, block);
+            transpose(block);
+            for (int lane = 0; lane < LANES; lane++)
+                bitmaps[static_cast<size_t>(lane) * bitmapWords + row * wordsPerRow + word] = block[lane];
+        }
+    }
+}
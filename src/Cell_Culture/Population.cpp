@@ -10,85 +10,467 @@
 
 #include "Cell_Culture/Population.h"
 #include "GoL_Rules/RuleFactory.h"
-#include <random>
-#include <ctime>
+#include <algorithm>
 #include <string>
+#include <vector>
 #include "Support/FileLoader.h"
-#include "Support/Globals.h"
+#include "Support/Random.h"
+#include "Support/WorkStealingPool.h"
 
 // Initializing cell culture and the concrete rules to be used in simulation.
 void Population::initiatePopulation(string evenRuleName, string oddRuleName) {
+    // if empty, same as even rule
+    initiatePopulation(RuleSchedule(evenRuleName, oddRuleName));
+}
+
+// Initializing cell culture and the rules of every entry of the schedule.
+void Population::initiatePopulation(const RuleSchedule& ruleSchedule) {
     // Determine whether the cell culture should be randomized or built from file.
-    if (!fileName.empty())
+    if (!config.fileName.empty())
         buildCellCultureFromFile();
     else
         randomizeCellCulture();
 
-    // create the rules we will use, based on specified rule names
-    if (oddRuleName == "")	// if empty, same as even rule
-        oddRuleName = evenRuleName;
-    this->evenRuleOfExistence = RuleFactory::getInstance().createAndReturnRule(cells, evenRuleName);
-    this->oddRuleOfExistence = RuleFactory::getInstance().createAndReturnRule(cells, oddRuleName);
+    // in a torus the ring around the world mirrors the opposite edges
+    cells.refreshHalo();
+
+    // create the rules we will use, based on the scheduled rule names
+    const vector<ScheduledRule>& entries = ruleSchedule.getEntries();
+    schedule = static_cast<ScheduleSlot*>(arena.allocate(sizeof(ScheduleSlot) * entries.size(),
+                                                         alignof(ScheduleSlot)));
+    // slots count once their rule exists, so a rule that throws leaves the destructor only finished rules
+    for (scheduleLength = 0; scheduleLength < static_cast<int>(entries.size()); scheduleLength++) {
+        ScheduleSlot& slot = schedule[scheduleLength];
+        slot.rule = RuleFactory::getInstance().createAndReturnRule(cells, entries[scheduleLength].ruleName, arena);
+        slot.generations = max(entries[scheduleLength].generations, 1);
+    }
+
+    scheduleIndex = 0;
+    generationsLeft = (scheduleLength > 0) ? schedule[0].generations : 0;
+
+    // the boards run the schedule only if every rule is a table
+    boardRules.clear();
+    for (int i = 0; i < scheduleLength; i++) {
+        ActionTable table;
+        if (!schedule[i].rule->getActionTable(table)) {
+            boardRules.clear();
+            break;
+        }
+        boardRules.push_back(LaneBoards::getLaneRule(table));
+    }
+    eventBoard.reset();
+    chunkBoard.reset();
+    boardEngine = GRID_ENGINE;
+    adaptiveEngine = CHUNK_ENGINE;
+    generationsToSample = 1;
+}
+
+// Randomizing into the same grid, the rules keep their references to it.
+void Population::restart(uint64_t seed, double density) {
+    config.seed = seed;
+    config.density = density;
+    randomizeCellCulture();
+    cells.refreshHalo();
+
+    for (int i = 0; i < scheduleLength; i++)
+        schedule[i].rule->reset();
+    boardEngine = GRID_ENGINE;
+    generationsToSample = 1;
+    generation = 0;
+    scheduleIndex = 0;
+    generationsLeft = (scheduleLength > 0) ? schedule[0].generations : 0;
 }
 
-// Send cells map to FileLoader, which will populate its culture based on file values.
+// The board becomes the pending generation, as a new world is.
+void Population::resume(const uint64_t* bitmap, int wordsPerRow, int generation) {
+    buildCellCulture(bitmap, wordsPerRow);
+    cells.refreshHalo();
+
+    for (int i = 0; i < scheduleLength; i++)
+        schedule[i].rule->reset();
+    boardEngine = GRID_ENGINE;
+    generationsToSample = 1;
+    this->generation = generation;
+
+    // the rule of a generation is found as if every earlier one had been run
+    long long period = 0;
+    for (int i = 0; i < scheduleLength; i++)
+        period += schedule[i].generations;
+    long long offset = (period > 0) ? generation % period : 0;
+    for (scheduleIndex = 0; scheduleIndex < scheduleLength && offset >= schedule[scheduleIndex].generations;
+         scheduleIndex++)
+        offset -= schedule[scheduleIndex].generations;
+    generationsLeft = (scheduleLength > 0) ? schedule[scheduleIndex].generations - static_cast<int>(offset) : 0;
+}
+
+// Rules that keep nothing but the board can be resumed from it.
+bool Population::canResume() const {
+    for (int i = 0; i < scheduleLength; i++) {
+        if (schedule[i].rule->keepsHistory())
+            return false;
+    }
+    return true;
+}
+
+// Send cells grid to FileLoader, which will populate its culture based on file values.
 void Population::buildCellCultureFromFile() {
     FileLoader fileLoader;
-    fileLoader.loadPopulationFromFile(cells);
+    fileLoader.loadPopulationFromFile(config.fileName, cells, config.worldSize);
 }
 
 // Build cell culture based on randomized starting values.
 void Population::randomizeCellCulture() {
-    default_random_engine generator(static_cast<unsigned>(time(0)));
-    uniform_int_distribution<int> random(0, 1);
+    int height = config.worldSize.HEIGHT;
+    int wordsPerRow = (config.worldSize.WIDTH + 63) / 64;
 
-    // allocate and map cells based on worldSize
-    for (int row = 0; row <= WORLD_DIMENSIONS.HEIGHT + 1; row++) {
+    // draw the living cells of every row, one bit per cell
+    vector<uint64_t> livingCells(height * wordsPerRow);
+    WorkStealingPool::getInstance().parallelFor(0, height, 16, [&](int firstRow, int lastRow) {
+        for (int row = firstRow; row < lastRow; row++)
+            randomizeRow(config, row, &livingCells[row * wordsPerRow]);
+    });
 
-        for (int column = 0; column <= WORLD_DIMENSIONS.WIDTH + 1; column++) {
-            // if cell is a rim cell
-            if (column == 0 || row == 0
-                || column == WORLD_DIMENSIONS.WIDTH + 1
-                || row == WORLD_DIMENSIONS.HEIGHT + 1) {
+    buildCellCulture(livingCells.data(), wordsPerRow);
+}
+
+// Every row is its own stream of the seed, the bits past the world are cleared.
+void Population::randomizeRow(const PopulationConfig& config, int row, uint64_t* words) {
+    int width = config.worldSize.WIDTH;
+    uint32_t probability = static_cast<uint32_t>(min(max(config.density, 0.0), 1.0) * 65536 + 0.5);
 
-                cells[Point{column, row}] = Cell(true); // create a cell with rimCell state set to true
+    Xoshiro256 generator(getStreamSeed(config.seed, row));
+    for (int word = 0; word * 64 < width; word++) {
+        words[word] = generator.nextBits(probability);
+        if (width - word * 64 < 64)
+            words[word] &= (1ULL << (width - word * 64)) - 1;
+    }
+}
+
+// Living cells start out dead and given life, as they are committed with the
+// first generation calculated.
+void Population::buildCellCulture(const uint64_t* livingCells, int wordsPerRow) {
+    int width = config.worldSize.WIDTH;
+    int height = config.worldSize.HEIGHT;
+
+    // allocate the grid based on worldSize and write the cells straight into it
+    cells.reset(width + 2, height + 2);
+    const Cell rimCell(true), livingCell(false, GIVE_CELL_LIFE), deadCell(false, IGNORE_CELL);
+
+    for (int row = 0; row <= height + 1; row++) {
+
+        for (int column = 0; column <= width + 1; column++) {
+            // if cell is a rim cell
+            if (column == 0 || row == 0 || column == width + 1 || row == height + 1) {
+                cells[Point{column, row}] = rimCell; // a cell with rimCell state set to true
             }
             else { // If cell is an ordinary cell
-                if (random(generator)) { // Randomly pick alive/dead
-                    cells[Point{column, row}] = Cell(false, GIVE_CELL_LIFE); // create a ordinary living cell
+                uint64_t word = livingCells[(row - 1) * wordsPerRow + (column - 1) / 64];
+                if ((word >> ((column - 1) % 64)) & 1) {
+                    cells[Point{column, row}] = livingCell; // a ordinary living cell
                 }
                 else {
-                    cells[Point{column, row}] = Cell(false, IGNORE_CELL); // else create a ordinary dead cell
+                    cells[Point{column, row}] = deadCell; // else a ordinary dead cell
                 }
             }
         }
     }
 }
 
-// Destructor that frees allocated memory.
+// Destructor that ends the rules' lifetime, their memory goes with the arena.
 Population::~Population() {
-    if (evenRuleOfExistence != nullptr) {
-        delete evenRuleOfExistence;
-    }
-    if (oddRuleOfExistence != nullptr) {
-        delete oddRuleOfExistence;
-    }
+    for (int i = 0; i < scheduleLength; i++)
+        schedule[i].rule->~RuleOfExistence();
 }
 
 // Update the cell population and determine next generational changes based on rules.
 int Population::calculateNewGeneration() {
+    // follow the schedule, moving on to the next slot once this one is used up
+    int slot = scheduleIndex;
+    RuleOfExistence* rule = schedule[slot].rule;
+    if (--generationsLeft == 0) {
+        scheduleIndex = (scheduleIndex + 1 == scheduleLength) ? 0 : scheduleIndex + 1;
+        generationsLeft = schedule[scheduleIndex].generations;
+    }
+
+    ENGINE engine = getEngine();
+    if (engine == EVENT_ENGINE)
+        calculateBoardGeneration(eventBoard, engine, boardRules[slot]);
+    else if (engine == CHUNK_ENGINE)
+        calculateBoardGeneration(chunkBoard, engine, boardRules[slot]);
+    else
+        calculateGridGeneration(rule);
+    generation++;
+
+    if (config.engine == ADAPTIVE_ENGINE && !boardRules.empty() && --generationsToSample == 0)
+        sampleEngine();
+    return generation;
+}
+
+// Update the cell population by letting the rule visit every cell.
+void Population::calculateGridGeneration(RuleOfExistence* rule) {
+    int columns = cells.getColumns();
+    int rows = cells.getRows();
+
+    // the grid changes every cell behind the back of the boards
+    boardEngine = GRID_ENGINE;
 
-    // update the states of cells
-    for (auto it = cells.begin(); it != cells.end(); it++) {
-        it->second.updateState();
+    // updates the states of the cells of a row, the rim never changes and the
+    // halo is copied from the world
+    auto commitRow = [&](int row) {
+        for (int column = 1; column < columns - 1; column++)
+            cells[row * columns + column].updateState();
+        cells.refreshHaloColumns(row);
+    };
+
+    // The world is swept in bands of rows, one band per task. Within a band
+    // row r + 1 is committed right before row r is executed, so the rows
+    // around r hold their new state while the rule only writes next states.
+    // The first and last row of every band are read by two bands, they are
+    // committed up front.
+    int grain = max(1, 16384 / max(columns, 1));
+    auto isBandEdge = [&](int row) {
+        int offset = (row - 1) % grain;
+        return offset == 0 || offset == grain - 1 || row == rows - 2;
+    };
+
+    // Rules that read the cells before the first row is executed get the
+    // whole generation committed first instead.
+    if (rule->needsCommittedGeneration()) {
+        WorkStealingPool::getInstance().parallelFor(1, rows - 1, grain, [&](int firstRow, int lastRow) {
+            for (int row = firstRow; row < lastRow; row++)
+                commitRow(row);
+        });
+        cells.refreshHaloRows();
+        rule->executeRule();
+        return;
     }
 
-    // alternate between even / odd rule
-    if (generation % 2 == 0) {
-        evenRuleOfExistence->executeRule();
+    for (int row = 1; row < rows - 1; row++) {
+        if (isBandEdge(row))
+            commitRow(row);
+    }
+    cells.refreshHaloRows();
+
+    rule->beginGeneration();
+    WorkStealingPool::getInstance().parallelFor(1, rows - 1, grain, [&](int firstRow, int lastRow) {
+        for (int row = firstRow; row < lastRow; row++) {
+            if (row + 1 < rows - 1 && !isBandEdge(row + 1))
+                commitRow(row + 1);
+            rule->executeRows(row, row + 1);
+        }
+    });
+    rule->endGeneration();
+}
+
+// The pending actions already give the newest generation, the cells that are
+// not as it has them are the ones to commit.
+template<class Board>
+void Population::loadBoard(unique_ptr<Board>& board, ENGINE engine) {
+    int width = config.worldSize.WIDTH;
+    int height = config.worldSize.HEIGHT;
+    int columns = cells.getColumns();
+    if (!board)
+        board.reset(new Board(config.worldSize, cells.getTopology()));
+
+    vector<uint8_t> alive(static_cast<size_t>(width) * height);
+    pendingChanges.clear();
+    for (int row = 0; row < height; row++) {
+        for (int column = 0; column < width; column++) {
+            int index = (row + 1) * columns + column + 1;
+            alive[row * width + column] = cells[index].isAliveAfterUpdate();
+            if (alive[row * width + column] != cells[index].isAlive())
+                pendingChanges.push_back(index);
+        }
+    }
+    board->setCells(alive.data());
+    boardEngine = engine;
+}
+
+// Commits the cells that change, steps the board and gives the cells it
+// changed their actions. Every other cell is as its pending action has it.
+template<class Board>
+void Population::calculateBoardGeneration(unique_ptr<Board>& board, ENGINE engine, const LaneRule& rule) {
+    if (boardEngine != engine)
+        loadBoard(board, engine);
+
+    int width = config.worldSize.WIDTH;
+    int columns = cells.getColumns();
+    int rows = cells.getRows();
+    bool edgeRowChanged = false;
+    for (int index : pendingChanges) {
+        cells[index].updateState();
+        int row = index / columns, column = index % columns;
+        if (column == 1 || column == columns - 2)
+            cells.refreshHaloColumns(row);
+        edgeRowChanged |= row == 1 || row == rows - 2;
+    }
+    if (edgeRowChanged)
+        cells.refreshHaloRows();
+
+    board->step(rule);
+    pendingChanges.clear();
+    for (int change : board->getChanges()) {
+        int index = (change / width + 1) * columns + change % width + 1;
+        bool born = board->isAlive(change);
+        cells[index].setNextColor(born ? STATE_COLORS.LIVING : STATE_COLORS.DEAD);
+        cells[index].setNextGenerationAction(born ? GIVE_CELL_LIFE : KILL_CELL);
+        pendingChanges.push_back(index);
+    }
+}
+
+// Nanoseconds per cell the grid visits, per cell a chunk holds, per cell the
+// event board changes and per change a board hands over to the cells,
+// measured on 1024x1024 worlds.
+namespace {
+    const double GRID_CELL_COST = 43;
+    const double CHUNK_CELL_COST = 2.8;
+    const double EVENT_CHANGE_COST = 90;
+    const double CHANGE_COST = 50;
+
+    // First and last index with living cells, an empty range if there are none.
+    void findLiving(const vector<int>& living, int& first, int& size) {
+        int last = static_cast<int>(living.size()) - 1;
+        for (first = 0; first <= last && living[first] == 0; first++);
+        for (; last >= first && living[last] == 0; last--);
+        size = last - first + 1;
+    }
+}
+
+// Counts the newest generation from the board holding it, or from the cells.
+void Population::sampleEngine() {
+    generationsToSample = ENGINE_SAMPLE_INTERVAL;
+    int width = config.worldSize.WIDTH;
+    int height = config.worldSize.HEIGHT;
+
+    uint64_t living = 0, changed = pendingChanges.size();
+    vector<int> rowCounts, columnCounts;
+    const vector<int>* rowLiving = &rowCounts;
+    const vector<int>* columnLiving = &columnCounts;
+    if (boardEngine == EVENT_ENGINE) {
+        living = eventBoard->getLivingCells();
+        rowLiving = &eventBoard->getRowLiving();
+        columnLiving = &eventBoard->getColumnLiving();
+    }
+    else if (boardEngine == CHUNK_ENGINE) {
+        living = chunkBoard->getLivingCells();
+        rowLiving = &chunkBoard->getRowLiving();
+        columnLiving = &chunkBoard->getColumnLiving();
     }
     else {
-        oddRuleOfExistence->executeRule();
+        int columns = cells.getColumns();
+        rowCounts.assign(height, 0);
+        columnCounts.assign(width, 0);
+        changed = 0;
+        for (int row = 0; row < height; row++) {
+            for (int column = 0; column < width; column++) {
+                Cell& cell = cells[(row + 1) * columns + column + 1];
+                bool alive = cell.isAliveAfterUpdate();
+                rowCounts[row] += alive;
+                columnCounts[column] += alive;
+                living += alive;
+                changed += alive != cell.isAlive();
+            }
+        }
+    }
+
+    double area = static_cast<double>(width) * height;
+    engineSample.generation = generation;
+    engineSample.engine = getEngine();
+    engineSample.density = (area > 0) ? living / area : 0;
+    engineSample.activity = (living > 0) ? static_cast<double>(changed) / living : 0;
+    findLiving(*columnLiving, engineSample.boxCorner.x, engineSample.boxSize.WIDTH);
+    findLiving(*rowLiving, engineSample.boxCorner.y, engineSample.boxSize.HEIGHT);
+
+    // the chunks stepped are at most those of the box and the ones around it
+    double cost[ADAPTIVE_ENGINE];
+    cost[GRID_ENGINE] = area * GRID_CELL_COST / max<int>(WorkStealingPool::getInstance().getThreadCount(), 1);
+    double chunks = 0;
+    if (living > 0) {
+        int chunksAcross = (width + 63) / 64, chunksDown = (height + 63) / 64;
+        int left = engineSample.boxCorner.x / 64, top = engineSample.boxCorner.y / 64;
+        int right = (engineSample.boxCorner.x + engineSample.boxSize.WIDTH - 1) / 64;
+        int bottom = (engineSample.boxCorner.y + engineSample.boxSize.HEIGHT - 1) / 64;
+        chunks = static_cast<double>(min(right - left + 3, chunksAcross)) * min(bottom - top + 3, chunksDown);
+    }
+    cost[CHUNK_ENGINE] = chunks * 4096 * CHUNK_CELL_COST + changed * CHANGE_COST;
+    cost[EVENT_ENGINE] = changed * (EVENT_CHANGE_COST + CHANGE_COST);
+
+    ENGINE best = adaptiveEngine;
+    for (ENGINE engine : { GRID_ENGINE, CHUNK_ENGINE, EVENT_ENGINE }) {
+        if (cost[engine] < cost[best])
+            best = engine;
+    }
+    if (cost[best] <= cost[adaptiveEngine] / 2)
+        adaptiveEngine = best;
+}
+
+// Nothing is converted here, the next generation loads the board it needs.
+void Population::setEngine(ENGINE engine) {
+    config.engine = engine;
+    if (engine == ADAPTIVE_ENGINE) {
+        adaptiveEngine = (boardEngine != GRID_ENGINE) ? boardEngine : CHUNK_ENGINE;
+        generationsToSample = 1;
+    }
+}
+
+// Packs each row of the part inside the world, a bit per cell.
+void Population::readRegion(int left, int top, int width, int height, uint64_t* bitmap, int wordsPerRow) {
+    fill(bitmap, bitmap + max(height, 0) * max(wordsPerRow, 0), 0);
+
+    int firstColumn = max(left, 0), lastColumn = min(left + width, config.worldSize.WIDTH);
+    int firstRow = max(top, 0), lastRow = min(top + height, config.worldSize.HEIGHT);
+    int columns = cells.getColumns();
+    for (int row = firstRow; row < lastRow; row++) {
+        uint64_t* words = bitmap + (row - top) * wordsPerRow;
+        Cell* cell = &cells[(row + 1) * columns + firstColumn + 1];
+        for (int x = firstColumn - left; x < lastColumn - left; x++, cell++)
+            words[x / 64] |= static_cast<uint64_t>(cell->isAlive()) << (x % 64);
+    }
+}
+
+// Same as the bitmap, a byte per cell.
+void Population::readRegion(int left, int top, int width, int height, uint8_t* bytes) {
+    fill(bytes, bytes + max(width, 0) * max(height, 0), 0);
+
+    int firstColumn = max(left, 0), lastColumn = min(left + width, config.worldSize.WIDTH);
+    int firstRow = max(top, 0), lastRow = min(top + height, config.worldSize.HEIGHT);
+    int columns = cells.getColumns();
+    for (int row = firstRow; row < lastRow; row++) {
+        uint8_t* rowBytes = bytes + (row - top) * width;
+        Cell* cell = &cells[(row + 1) * columns + firstColumn + 1];
+        for (int x = firstColumn - left; x < lastColumn - left; x++, cell++)
+            rowBytes[x] = cell->isAlive();
     }
-    return ++generation;
-}
\ No newline at end of file
+}
+
+// Replaces the cells that are not as stamped with fresh living or dead ones,
+// and has those that are keep their state through the pending generation.
+void Population::writeRegion(int left, int top, int width, int height, const uint64_t* bitmap, int wordsPerRow) {
+    const Cell livingCell(false, GIVE_CELL_LIFE), deadCell(false, IGNORE_CELL);
+
+    int firstColumn = max(left, 0), lastColumn = min(left + width, config.worldSize.WIDTH);
+    int firstRow = max(top, 0), lastRow = min(top + height, config.worldSize.HEIGHT);
+    int columns = cells.getColumns();
+    bool changed = false;
+    for (int row = firstRow; row < lastRow; row++) {
+        const uint64_t* words = bitmap + (row - top) * wordsPerRow;
+        Cell* cell = &cells[(row + 1) * columns + firstColumn + 1];
+        for (int x = firstColumn - left; x < lastColumn - left; x++, cell++) {
+            bool alive = (words[x / 64] >> (x % 64)) & 1;
+            if (cell->isAlive() != alive) {
+                *cell = alive ? livingCell : deadCell;
+                changed = true;
+            }
+            else if (cell->isAliveAfterUpdate() != alive) {
+                cell->setNextColor(alive ? STATE_COLORS.LIVING : STATE_COLORS.DEAD);
+                cell->setNextGenerationAction(IGNORE_CELL);
+                changed = true;
+            }
+        }
+    }
+
+    if (changed) {
+        cells.refreshHalo();
+        boardEngine = GRID_ENGINE;
+    }
+}
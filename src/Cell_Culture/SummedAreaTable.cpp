@@ -0,0 +1,215 @@
+/**
+ * @file SummedAreaTable.cpp
+ * @brief Implementation of SummedAreaTable, counts of living cells in any
+ *  rectangle of the world in constant time.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Cell_Culture/SummedAreaTable.h"
+#include <algorithm>
+#include "Support/WorkStealingPool.h"
+
+// Adds up each row on its own, then the rows column by column.
+void SummedAreaTable::integrate(vector<int32_t>& table, int width, int height) {
+    int stride = width + 1;
+    WorkStealingPool& pool = WorkStealingPool::getInstance();
+
+    pool.parallelFor(1, height + 1, max(1, 16384 / stride), [&](int firstRow, int lastRow) {
+        for (int row = firstRow; row < lastRow; row++) {
+            int32_t* line = &table[row * stride];
+            for (int column = 1; column <= width; column++)
+                line[column] += line[column - 1];
+        }
+    });
+
+    pool.parallelFor(1, stride, 1024, [&](int firstColumn, int lastColumn) {
+        for (int row = 1; row <= height; row++) {
+            int32_t* line = &table[row * stride];
+            const int32_t* above = line - stride;
+            for (int column = firstColumn; column < lastColumn; column++)
+                line[column] += above[column];
+        }
+    });
+}
+
+void SummedAreaTable::build(CellGrid& cells) {
+    width = max(cells.getColumns() - 2, 0);
+    height = max(cells.getRows() - 2, 0);
+    topology = cells.getTopology();
+
+    int stride = width + 1;
+    sums.assign(stride * (height + 1), 0);
+    WorkStealingPool::getInstance().parallelFor(0, height, max(1, 16384 / stride), [&](int firstRow, int lastRow) {
+        for (int row = firstRow; row < lastRow; row++) {
+            int32_t* line = &sums[(row + 1) * stride + 1];
+            int cellIndex = (row + 1) * cells.getColumns() + 1;
+            for (int column = 0; column < width; column++)
+                line[column] = cells[cellIndex + column].isAlive();
+        }
+    });
+
+    integrate(sums, width, height);
+}
+
+// Each diagonal is summed from the top row down. In a TORUS it continues
+// across the left and right edges, in a BOUNDED world it starts over there.
+void SummedAreaTable::buildDiamonds(CellGrid& cells, int radius) {
+    build(cells);
+    radius = max(radius, 0);
+    diamonds.assign(width * height, 0);
+    if (width == 0 || height == 0)
+        return;
+
+    WorkStealingPool& pool = WorkStealingPool::getInstance();
+    for (int direction = 0; direction < 2; direction++) {
+        vector<int32_t>& diagonal = diagonalSums[direction];
+        diagonal.assign(width * height, 0);
+        int step = direction == 0 ? 1 : -1;
+
+        pool.parallelFor(0, width, max(1, 16384 / height), [&](int firstColumn, int lastColumn) {
+            for (int start = firstColumn; start < lastColumn; start++) {
+                int column = start, previous = -1;
+                for (int row = 0; row < height; row++) {
+                    int32_t alive = cells[(row + 1) * cells.getColumns() + column + 1].isAlive();
+                    diagonal[row * width + column] = alive + (previous >= 0 ? diagonal[previous] : 0);
+                    previous = row * width + column;
+
+                    column += step;
+                    if (column < 0 || column >= width) {
+                        column = (column + width) % width;
+                        if (topology == BOUNDED)
+                            previous = -1;
+                    }
+                }
+            }
+        });
+    }
+
+    // Rows of a diamond, relative to its centre. In a TORUS each row of the
+    // world is one of them at most, and the middle ones, whose cells reach
+    // the whole width, do not change as the diamond moves.
+    int firstRow = -radius, lastRow = radius, fullRows = 0;
+    if (topology == TORUS) {
+        firstRow = -min(radius, (height - 1) / 2);
+        lastRow = min(radius, height / 2);
+        fullRows = max(radius - width / 2 + 1, 0);
+    }
+    int upperRows = max(min(-1, -fullRows) - firstRow + 1, 0);
+    int lowerFirst = fullRows;
+    int lowerRows = max(lastRow - lowerFirst + 1, 0);
+
+    pool.parallelFor(0, height, max(1, 16384 / width), [&](int firstY, int lastY) {
+        for (int y = firstY; y < lastY; y++) {
+            int32_t* line = &diamonds[y * width];
+            int total = 0;
+            int top = topology == TORUS ? firstRow : max(firstRow, -y);
+            int bottom = topology == TORUS ? lastRow : min(lastRow, height - 1 - y);
+            for (int row = top; row <= bottom; row++) {
+                int reach = radius - abs(row);
+                total += sum(-reach, y + row, reach, y + row);
+            }
+            line[0] = total;
+
+            // one step right gains the cells right of each row and loses its
+            // leftmost ones, on a diagonal above the centre and one below it
+            for (int x = 0; x + 1 < width; x++) {
+                total += diagonalSum(0, x + 1 + radius + firstRow, y + firstRow, upperRows)
+                         + diagonalSum(1, x + 1 + radius - lowerFirst, y + lowerFirst, lowerRows)
+                         - diagonalSum(1, x - radius - firstRow, y + firstRow, upperRows)
+                         - diagonalSum(0, x - radius + lowerFirst, y + lowerFirst, lowerRows);
+                line[x + 1] = total;
+            }
+        }
+    });
+}
+
+// Wraps the start into the world and splits the cells at the bottom edge of a
+// torus, or clips them to a bounded world.
+int SummedAreaTable::diagonalSum(int direction, int column, int row, int length) const {
+    if (length <= 0)
+        return 0;
+
+    int step = direction == 0 ? 1 : -1;
+    const vector<int32_t>& diagonal = diagonalSums[direction];
+    if (topology == TORUS) {
+        column = ((column % width) + width) % width;
+        row = ((row % height) + height) % height;
+        if (row + length > height) {
+            int above = height - row;
+            return diagonalSum(direction, column, row, above)
+                   + diagonalSum(direction, column + step * above, 0, length - above);
+        }
+
+        int last = row + length - 1;
+        int total = diagonal[last * width + ((column + step * (length - 1)) % width + width) % width];
+        if (row > 0)
+            total -= diagonal[(row - 1) * width + ((column - step) % width + width) % width];
+        return total;
+    }
+
+    // steps first..last of the diagonal lie inside the world
+    int first = max(0, -row), last = min(length - 1, height - 1 - row);
+    if (step > 0) {
+        first = max(first, -column);
+        last = min(last, width - 1 - column);
+    }
+    else {
+        first = max(first, column - (width - 1));
+        last = min(last, column);
+    }
+    if (first > last)
+        return 0;
+
+    int total = diagonal[(row + last) * width + column + step * last];
+    int before = column + step * (first - 1);
+    if (row + first > 0 && before >= 0 && before < width)
+        total -= diagonal[(row + first - 1) * width + before];
+    return total;
+}
+
+// Wraps or clips the range to the world.
+int SummedAreaTable::splitRange(int first, int last, int size, int ranges[2][2]) const {
+    if (topology == TORUS) {
+        if (last - first + 1 >= size) {
+            ranges[0][0] = 0;
+            ranges[0][1] = size - 1;
+            return 1;
+        }
+
+        int length = last - first;
+        first = ((first % size) + size) % size;
+        last = (first + length) % size;
+        if (first <= last) {
+            ranges[0][0] = first;
+            ranges[0][1] = last;
+            return 1;
+        }
+        ranges[0][0] = first;
+        ranges[0][1] = size - 1;
+        ranges[1][0] = 0;
+        ranges[1][1] = last;
+        return 2;
+    }
+
+    ranges[0][0] = max(first, 0);
+    ranges[0][1] = min(last, size - 1);
+    return ranges[0][0] <= ranges[0][1] ? 1 : 0;
+}
+
+// Up to four rectangles when wrapping around both edges of a torus.
+int SummedAreaTable::sum(int left, int top, int right, int bottom) const {
+    if (width == 0 || height == 0 || right < left || bottom < top)
+        return 0;
+
+    int columns[2][2], rows[2][2];
+    int columnRanges = splitRange(left, right, width, columns);
+    int rowRanges = splitRange(top, bottom, height, rows);
+
+    int total = 0;
+    for (int i = 0; i < rowRanges; i++) {
+        for (int j = 0; j < columnRanges; j++)
+            total += boxSum(sums, width + 1, columns[j][0], rows[i][0], columns[j][1], rows[i][1]);
+    }
+    return total;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file Census.cpp
+ * @brief Implementation of Census, class that identifies and counts the objects
+ *  left on a board.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Experiments/Census.h"
+#include <algorithm>
+#include <climits>
+
+namespace {
+
+    /*
+    * Known objects, drawn with 1 for living cells. Oscillators and spaceships
+    * are listed once per phase that differs by more than a rotation.
+    */
+    const vector<pair<string, vector<string>>> KNOWN_OBJECTS{
+        { "block",     { "11", "11" } },
+        { "beehive",   { "0110", "1001", "0110" } },
+        { "loaf",      { "0110", "1001", "0101", "0010" } },
+        { "boat",      { "110", "101", "010" } },
+        { "ship",      { "110", "101", "011" } },
+        { "tub",       { "010", "101", "010" } },
+        { "pond",      { "0110", "1001", "1001", "0110" } },
+        { "barge",     { "0100", "1010", "0101", "0010" } },
+        { "long_boat", { "1100", "1010", "0101", "0010" } },
+        { "blinker",   { "111" } },
+        { "toad",      { "0111", "1110" } },
+        { "toad",      { "0010", "1001", "1001", "0100" } },
+        { "beacon",    { "1100", "1100", "0011", "0011" } },
+        { "beacon",    { "1100", "1000", "0001", "0011" } },
+        { "glider",    { "010", "001", "111" } },
+        { "glider",    { "101", "011", "010" } }
+    };
+
+    // Converts a drawing into the positions of its living cells.
+    vector<Point> drawingToObject(const vector<string>& drawing) {
+        vector<Point> object;
+        for (int row = 0; row < static_cast<int>(drawing.size()); row++) {
+            for (int column = 0; column < static_cast<int>(drawing[row].size()); column++) {
+                if (drawing[row][column] == '1')
+                    object.push_back(Point{column, row});
+            }
+        }
+        return object;
+    }
+
+    // Maps object codes to names, built once on first use.
+    const map<string, string>& getKnownCodes() {
+        static const map<string, string> knownCodes = [] {
+            map<string, string> codes;
+            for (const auto& known : KNOWN_OBJECTS)
+                codes[Census::getObjectCode(drawingToObject(known.second))] = known.first;
+            return codes;
+        }();
+        return knownCodes;
+    }
+}
+
+// Writes the object in all eight orientations and keeps the smallest.
+string Census::getObjectCode(const vector<Point>& object) {
+    string smallest;
+
+    for (int orientation = 0; orientation < 8; orientation++) {
+        vector<Point> transformed;
+        int minX = INT_MAX, minY = INT_MAX, maxX = INT_MIN, maxY = INT_MIN;
+
+        for (const Point& point : object) {
+            int x = point.x, y = point.y;
+            if (orientation & 1)    // mirror
+                x = -x;
+            if (orientation & 2)    // flip
+                y = -y;
+            if (orientation & 4)    // transpose
+                swap(x, y);
+
+            transformed.push_back(Point{x, y});
+            minX = min(minX, x);
+            minY = min(minY, y);
+            maxX = max(maxX, x);
+            maxY = max(maxY, y);
+        }
+
+        int width = maxX - minX + 1;
+        int height = maxY - minY + 1;
+        string bitmap(height * (width + 1) - 1, '0');
+        for (int row = 1; row < height; row++)
+            bitmap[row * (width + 1) - 1] = '/';
+        for (const Point& point : transformed)
+            bitmap[(point.y - minY) * (width + 1) + point.x - minX] = '1';
+
+        string code = to_string(width) + "x" + to_string(height) + ":" + bitmap;
+        if (smallest.empty() || code < smallest)
+            smallest = code;
+    }
+
+    return smallest;
+}
+
+// Names the object if it is a known one.
+string Census::classifyObject(const vector<Point>& object) {
+    string code = getObjectCode(object);
+    const map<string, string>& knownCodes = getKnownCodes();
+
+    auto known = knownCodes.find(code);
+    if (known != knownCodes.end())
+        return known->second;
+
+    return "unknown_" + code;
+}
+
+void Census::takeCensus(Population& population) {
+    int width = population.getWorldSize().WIDTH;
+    int height = population.getWorldSize().HEIGHT;
+
+    vector<uint8_t> alive(width * height);
+    population.readRegion(0, 0, width, height, alive.data());
+    countObjects(alive, width, height, population.getTopology() == TORUS);
+}
+
+void Census::takeCensus(const uint64_t* bitmap, int wordsPerRow, Dimensions worldSize, TOPOLOGY topology) {
+    int width = worldSize.WIDTH;
+    int height = worldSize.HEIGHT;
+
+    vector<uint8_t> alive(width * height);
+    for (int row = 0; row < height; row++) {
+        for (int column = 0; column < width; column++)
+            alive[row * width + column] = (bitmap[row * wordsPerRow + column / 64] >> (column % 64)) & 1;
+    }
+    countObjects(alive, width, height, topology == TORUS);
+}
+
+// Groups the living cells into objects and counts them.
+void Census::countObjects(vector<uint8_t>& alive, int width, int height, bool wraps) {
+    // Flood fill each object, clearing its cells as they are visited. Positions
+    // are tracked unwrapped, so objects crossing the edge of a torus stay whole.
+    for (int start = 0; start < width * height; start++) {
+        if (!alive[start])
+            continue;
+
+        vector<Point> object;
+        vector<Point> stack{ Point{start % width, start / width} };
+        alive[start] = false;
+
+        while (!stack.empty()) {
+            Point point = stack.back();
+            stack.pop_back();
+            object.push_back(point);
+
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int x = point.x + dx;
+                    int y = point.y + dy;
+                    int column = wraps ? ((x % width) + width) % width : x;
+                    int row = wraps ? ((y % height) + height) % height : y;
+                    if (column < 0 || row < 0 || column >= width || row >= height || !alive[row * width + column])
+                        continue;
+
+                    alive[row * width + column] = false;
+                    stack.push_back(Point{x, y});
+                }
+            }
+        }
+
+        addObjects(classifyObject(object));
+    }
+}
+
+// Adds the counts of another census.
+void Census::merge(const Census& other) {
+    for (const auto& count : other.objectCounts)
+        objectCounts[count.first] += count.second;
+}
+
+// Sums the counts of all objects.
+int Census::getTotalObjects() const {
+    int total = 0;
+    for (const auto& count : objectCounts)
+        total += count.second;
+    return total;
+}
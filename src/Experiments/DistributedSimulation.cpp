@@ -0,0 +1,392 @@
+/**
+ * @file DistributedSimulation.cpp
+ * @brief Implementation of DistributedSimulation, class that splits one world
+ *  over several worker processes.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Experiments/DistributedSimulation.h"
+#include <cerrno>
+#include <csignal>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "Cell_Culture/CellGrid.h"
+#include "GoL_Rules/RuleFactory.h"
+#include "Support/Random.h"
+
+namespace {
+
+    // What a worker tells the coordinator after every generation, followed by
+    // its strip at checkpoints.
+    struct WorkerReport {
+        int32_t generation;
+        int32_t hasStrip;
+        uint64_t livingCells;
+    };
+
+    // Halo row on its way out to and in from one neighbour.
+    struct HaloTransfer {
+        int socket;
+        const char* out;
+        size_t outLeft;
+        char* in;
+        size_t inLeft;
+    };
+
+    bool writeAll(int socket, const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t written = send(socket, bytes, size, MSG_NOSIGNAL);
+            if (written <= 0)
+                return false;
+            bytes += written;
+            size -= written;
+        }
+        return true;
+    }
+
+    bool readAll(int socket, void* data, size_t size) {
+        char* bytes = static_cast<char*>(data);
+        while (size > 0) {
+            ssize_t read = recv(socket, bytes, size, 0);
+            if (read <= 0)
+                return false;
+            bytes += read;
+            size -= read;
+        }
+        return true;
+    }
+
+    // Sends and receives on all sockets at once, so that no worker waits for
+    // its neighbour to read before it reads itself.
+    bool exchange(HaloTransfer* transfers, int count) {
+        while (true) {
+            pollfd sockets[2];
+            int waiting = 0;
+            for (int i = 0; i < count; i++) {
+                sockets[i].fd = transfers[i].socket;
+                sockets[i].events = (transfers[i].outLeft > 0 ? POLLOUT : 0) | (transfers[i].inLeft > 0 ? POLLIN : 0);
+                sockets[i].revents = 0;
+                waiting += sockets[i].events != 0;
+            }
+            if (waiting == 0)
+                return true;
+            if (poll(sockets, count, -1) < 0)
+                return false;
+
+            for (int i = 0; i < count; i++) {
+                HaloTransfer& transfer = transfers[i];
+                if (sockets[i].revents & (POLLERR | POLLNVAL))
+                    return false;
+                if ((sockets[i].revents & POLLOUT) && transfer.outLeft > 0) {
+                    ssize_t written = send(transfer.socket, transfer.out, transfer.outLeft,
+                                           MSG_DONTWAIT | MSG_NOSIGNAL);
+                    if (written < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+                        return false;
+                    if (written > 0) {
+                        transfer.out += written;
+                        transfer.outLeft -= written;
+                    }
+                }
+                if ((sockets[i].revents & (POLLIN | POLLHUP)) && transfer.inLeft > 0) {
+                    ssize_t read = recv(transfer.socket, transfer.in, transfer.inLeft, MSG_DONTWAIT);
+                    if (read == 0 || (read < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+                        return false;
+                    if (read > 0) {
+                        transfer.in += read;
+                        transfer.inLeft -= read;
+                    }
+                }
+            }
+        }
+    }
+
+    // Packs the living cells of a row of the world, 64 to a word.
+    void packRow(CellGrid& cells, int row, vector<uint64_t>& words) {
+        fill(words.begin(), words.end(), 0);
+        Cell* cell = &cells[row * cells.getColumns() + 1];
+        for (int column = 0; column < cells.getColumns() - 2; column++, cell++)
+            words[column / 64] |= static_cast<uint64_t>(cell->isAlive()) << (column % 64);
+    }
+
+    // Writes packed cells into a halo row, leaving its halo columns alone.
+    void unpackRow(const vector<uint64_t>& words, CellGrid& cells, int row) {
+        const Cell livingCell(false, GIVE_CELL_LIFE), deadCell(false, IGNORE_CELL);
+        Cell* cell = &cells[row * cells.getColumns() + 1];
+        for (int column = 0; column < cells.getColumns() - 2; column++, cell++)
+            *cell = ((words[column / 64] >> (column % 64)) & 1) ? livingCell : deadCell;
+    }
+}
+
+// prefix, generation with six digits and extension.
+string DistributedSimulation::getCheckpointName(int generation) const {
+    ostringstream name;
+    name << checkpointPrefix << setw(6) << setfill('0') << generation << ".txt";
+    return name.str();
+}
+
+// The rows are shared out as evenly as possible.
+void DistributedSimulation::getStrip(int worker, int nrOfWorkers, int height, int& firstRow, int& lastRow) {
+    firstRow = static_cast<int>(static_cast<int64_t>(worker) * height / nrOfWorkers);
+    lastRow = static_cast<int>(static_cast<int64_t>(worker + 1) * height / nrOfWorkers);
+}
+
+// A rule is distributable if it can be turned into an ActionTable.
+bool DistributedSimulation::canDistribute(const RuleSchedule& ruleSchedule, string& rejectedRule) {
+    CellGrid cells;
+    cells.reset(3, 3);
+
+    for (const ScheduledRule& entry : ruleSchedule.getEntries()) {
+        bool tabulated = false;
+        try {
+            RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, entry.ruleName);
+            ActionTable table;
+            tabulated = rule->getActionTable(table);
+            delete rule;
+        }
+        catch (ios_base::failure& e) {}
+
+        if (!tabulated) {
+            rejectedRule = entry.ruleName;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DistributedSimulation::run() {
+    stats.clear();
+    string rejectedRule;
+    if (ruleSchedule.empty() || worldSize.WIDTH < 1 || worldSize.HEIGHT < 1
+        || !canDistribute(ruleSchedule, rejectedRule))
+        return false;
+
+    // link i joins the bottom of worker i to the top of the worker below it
+    bool torus = topology == TORUS;
+    int nrOfLinks = torus ? (nrOfWorkers > 1 ? nrOfWorkers : 0) : nrOfWorkers - 1;
+    vector<int> coordinators(nrOfWorkers, -1), workerSockets(nrOfWorkers, -1), links(2 * nrOfLinks, -1);
+    vector<pid_t> workers;
+
+    auto closeAll = [](vector<int>& sockets) {
+        for (int& socket : sockets) {
+            if (socket >= 0)
+                close(socket);
+            socket = -1;
+        }
+    };
+
+    bool started = true;
+    for (int i = 0; i < nrOfWorkers && started; i++) {
+        int pair[2];
+        started = socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == 0;
+        if (started) {
+            coordinators[i] = pair[0];
+            workerSockets[i] = pair[1];
+        }
+    }
+    for (int i = 0; i < nrOfLinks && started; i++)
+        started = socketpair(AF_UNIX, SOCK_STREAM, 0, &links[2 * i]) == 0;
+
+    for (int worker = 0; worker < nrOfWorkers && started; worker++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            // the worker keeps its own sockets only, so a dead neighbour is noticed
+            int coordinator = workerSockets[worker];
+            int below = (worker < nrOfLinks) ? links[2 * worker] : -1;
+            int above = -1;
+            if (worker > 0)
+                above = links[2 * (worker - 1) + 1];
+            else if (nrOfLinks == nrOfWorkers)
+                above = links[2 * (nrOfWorkers - 1) + 1];
+
+            for (int socket : coordinators)
+                close(socket);
+            for (int i = 0; i < nrOfWorkers; i++) {
+                if (i != worker)
+                    close(workerSockets[i]);
+            }
+            for (int socket : links) {
+                if (socket != above && socket != below)
+                    close(socket);
+            }
+
+            // the worker leaves without the exit handlers of the coordinator
+            _exit(runWorker(worker, coordinator, above, below) ? 0 : 1);
+        }
+        started = pid > 0;
+        if (started)
+            workers.push_back(pid);
+    }
+
+    closeAll(workerSockets);
+    closeAll(links);
+
+    bool completed = started && collectReports(coordinators);
+    closeAll(coordinators);
+
+    for (pid_t worker : workers) {
+        if (!completed)
+            kill(worker, SIGTERM);
+        int status;
+        waitpid(worker, &status, 0);
+        completed = completed && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    return completed;
+}
+
+// Steps the strip and swaps edge rows with the neighbours every generation.
+bool DistributedSimulation::runWorker(int worker, int coordinator, int above, int below) {
+    int firstRow, lastRow;
+    getStrip(worker, nrOfWorkers, worldSize.HEIGHT, firstRow, lastRow);
+    int width = worldSize.WIDTH, height = lastRow - firstRow;
+    int columns = width + 2;
+    int wordsPerRow = (width + 63) / 64;
+
+    // the rows are drawn from the same streams as in Population::randomizeCellCulture
+    CellGrid cells;
+    cells.setTopology(topology);
+    cells.reset(columns, height + 2);
+    uint32_t probability = static_cast<uint32_t>(min(max(density, 0.0), 1.0) * 65536 + 0.5);
+    const Cell rimCell(true), livingCell(false, GIVE_CELL_LIFE), deadCell(false, IGNORE_CELL);
+    vector<uint64_t> words(wordsPerRow);
+
+    for (int row = 0; row <= height + 1; row++) {
+        if (row > 0 && row <= height) {
+            Xoshiro256 generator(getStreamSeed(seed, firstRow + row - 1));
+            for (int word = 0; word < wordsPerRow; word++)
+                words[word] = generator.nextBits(probability);
+        }
+        for (int column = 0; column < columns; column++) {
+            if (column == 0 || row == 0 || column == width + 1 || row == height + 1)
+                cells[row * columns + column] = rimCell;
+            else
+                cells[row * columns + column] = ((words[(column - 1) / 64] >> ((column - 1) % 64)) & 1)
+                                                ? livingCell : deadCell;
+        }
+    }
+
+    // one rule per entry of the schedule, followed as by Population
+    const vector<ScheduledRule>& entries = ruleSchedule.getEntries();
+    vector<RuleOfExistence*> rules;
+    for (const ScheduledRule& entry : entries)
+        rules.push_back(RuleFactory::getInstance().createAndReturnRule(cells, entry.ruleName));
+    int scheduleIndex = 0;
+    int generationsLeft = max(entries[0].generations, 1);
+
+    vector<uint64_t> sendAbove(wordsPerRow), sendBelow(wordsPerRow);
+    vector<uint64_t> receiveAbove(wordsPerRow), receiveBelow(wordsPerRow);
+    size_t rowBytes = wordsPerRow * sizeof(uint64_t);
+    bool connected = true;
+
+    for (int generation = 1; generation <= maxGenerations && connected; generation++) {
+        // fill the halo rows with the edge rows of the neighbours
+        HaloTransfer transfers[2];
+        int nrOfTransfers = 0;
+        if (above >= 0) {
+            packRow(cells, 1, sendAbove);
+            transfers[nrOfTransfers++] = HaloTransfer{ above, reinterpret_cast<const char*>(sendAbove.data()),
+                                                       rowBytes, reinterpret_cast<char*>(receiveAbove.data()),
+                                                       rowBytes };
+        }
+        if (below >= 0) {
+            packRow(cells, height, sendBelow);
+            transfers[nrOfTransfers++] = HaloTransfer{ below, reinterpret_cast<const char*>(sendBelow.data()),
+                                                       rowBytes, reinterpret_cast<char*>(receiveBelow.data()),
+                                                       rowBytes };
+        }
+        connected = exchange(transfers, nrOfTransfers);
+        if (!connected)
+            break;
+
+        if (above >= 0)
+            unpackRow(receiveAbove, cells, 0);
+        if (below >= 0)
+            unpackRow(receiveBelow, cells, height + 1);
+        if (topology == TORUS && nrOfWorkers == 1) {
+            cells.refreshHalo();
+        }
+        else {
+            for (int row = 0; row <= height + 1; row++)
+                cells.refreshHaloColumns(row);
+        }
+
+        RuleOfExistence* rule = rules[scheduleIndex];
+        if (--generationsLeft == 0) {
+            scheduleIndex = (scheduleIndex + 1 == static_cast<int>(rules.size())) ? 0 : scheduleIndex + 1;
+            generationsLeft = max(entries[scheduleIndex].generations, 1);
+        }
+
+        // the worker is a single thread, the workers are the parallelism
+        rule->beginGeneration();
+        rule->executeRows(1, height + 1);
+        rule->endGeneration();
+
+        WorkerReport report{ generation, isCheckpoint(generation), 0 };
+        for (int row = 1; row <= height; row++) {
+            for (int column = 1; column <= width; column++) {
+                Cell& cell = cells[row * columns + column];
+                cell.updateState();
+                report.livingCells += cell.isAlive();
+            }
+        }
+
+        connected = writeAll(coordinator, &report, sizeof(report));
+        for (int row = 1; row <= height && connected && report.hasStrip; row++) {
+            packRow(cells, row, words);
+            connected = writeAll(coordinator, words.data(), rowBytes);
+        }
+    }
+
+    for (RuleOfExistence* rule : rules)
+        delete rule;
+    return connected;
+}
+
+// Sums the reports of each generation and writes the strips of checkpoints
+// one after the other.
+bool DistributedSimulation::collectReports(const vector<int>& coordinators) {
+    int width = worldSize.WIDTH;
+    int wordsPerRow = (width + 63) / 64;
+    vector<uint64_t> words(wordsPerRow);
+    string line(width, '0');
+
+    for (int generation = 1; generation <= maxGenerations; generation++) {
+        ofstream checkpoint;
+        if (isCheckpoint(generation)) {
+            checkpoint.open(getCheckpointName(generation));
+            checkpoint << width << "x" << worldSize.HEIGHT << "\n";
+        }
+
+        DistributedStats generationStats{ generation, 0 };
+        for (int worker = 0; worker < nrOfWorkers; worker++) {
+            WorkerReport report;
+            if (!readAll(coordinators[worker], &report, sizeof(report)) || report.generation != generation)
+                return false;
+            generationStats.livingCells += report.livingCells;
+
+            int firstRow, lastRow;
+            getStrip(worker, nrOfWorkers, worldSize.HEIGHT, firstRow, lastRow);
+            for (int row = firstRow; row < lastRow && report.hasStrip; row++) {
+                if (!readAll(coordinators[worker], words.data(), words.size() * sizeof(uint64_t)))
+                    return false;
+                for (int column = 0; column < width; column++)
+                    line[column] = ((words[column / 64] >> (column % 64)) & 1) ? '1' : '0';
+                checkpoint << line << "\n";
+            }
+        }
+        stats.push_back(generationStats);
+
+        if (isCheckpoint(generation)) {
+            checkpoint.close();
+            if (checkpoint.fail())
+                return false;
+        }
+    }
+    return true;
+}
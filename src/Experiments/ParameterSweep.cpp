@@ -0,0 +1,319 @@
+/**
+ * @file ParameterSweep.cpp
+ * @brief Implementation of ParameterSweep, class that runs every combination
+ *  of rules, densities and world sizes of a spec file and collects their
+ *  census.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Experiments/ParameterSweep.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include "Cell_Culture/Population.h"
+#include "GoL_Rules/RuleFactory.h"
+#include "Support/WorkStealingPool.h"
+
+namespace {
+
+    const uint64_t MAX_RUNS = 1 << 20;
+
+    // Reads a whole word as a number, nothing may follow it.
+    template<class T>
+    bool readNumber(const string& word, T& value) {
+        istringstream stream(word);
+        return (stream >> value) && stream.peek() == EOF;
+    }
+
+    // Reads "value" or "first..last" or "first..last:step" into values.
+    template<class T>
+    bool readValues(const string& word, T defaultStep, vector<T>& values) {
+        size_t dots = word.find("..");
+        if (dots == string::npos) {
+            T value;
+            if (!readNumber(word, value))
+                return false;
+            values.push_back(value);
+            return true;
+        }
+
+        size_t colon = word.find(':', dots);
+        T first, last, step = defaultStep;
+        if (!readNumber(word.substr(0, dots), first)
+            || !readNumber(word.substr(dots + 2, colon - dots - 2), last)
+            || (colon != string::npos && !readNumber(word.substr(colon + 1), step))
+            || step <= 0 || last < first)
+            return false;
+
+        // Counted rather than accumulated, so 0.1..0.9:0.1 ends at 0.9.
+        double count = floor(static_cast<double>(last - first) / step + 1e-9) + 1;
+        if (count > MAX_RUNS)
+            return false;
+        for (int i = 0; i < static_cast<int>(count); i++)
+            values.push_back(static_cast<T>(first + i * step));
+        return true;
+    }
+
+    // Rounds away the error of first + i * step, 0.30000000000000004 being 0.3.
+    double roundDensity(double density) {
+        return round(density * 1e12) / 1e12;
+    }
+
+    // Cell generations of a run, at least one per cell.
+    uint64_t getWork(const SweepRun& run) {
+        return static_cast<uint64_t>(run.config.worldSize.WIDTH) * run.config.worldSize.HEIGHT
+               * max(run.generations, 1);
+    }
+}
+
+ParameterSweep::ParameterSweep()
+        : rules{"conway"}, densities{0.5}, sizes{Dimensions{80, 24}}, seeds{0}, generations{500},
+          topologies{BOUNDED}, outputFile("sweep.csv") {}
+
+// Every line is a parameter name and its values, later lines win.
+bool ParameterSweep::parse(const string& text, string& error) {
+    ParameterSweep spec;
+    istringstream lines(text);
+    string line;
+    int lineNumber = 0;
+
+    while (getline(lines, line)) {
+        lineNumber++;
+        line = line.substr(0, line.find('#'));
+        istringstream words(line);
+        string name, word;
+        if (!(words >> name))
+            continue;
+
+        vector<string> values;
+        while (words >> word)
+            values.push_back(word);
+        if (values.empty()) {
+            error = "line " + to_string(lineNumber) + ": " + name + " has no values";
+            return false;
+        }
+
+        bool good = true;
+        if (name == "rules") {
+            spec.rules.clear();
+            for (const string& value : values) {
+                if (value == "all") {
+                    for (const string& ruleName : RuleFactory::getRuleNames())
+                        spec.rules.push_back(ruleName);
+                    continue;
+                }
+                RuleSchedule ruleSchedule;
+                good = good && ruleSchedule.parse(value);
+                for (const ScheduledRule& entry : ruleSchedule.getEntries()) {
+                    if (good && !RuleFactory::getInstance().canCreateRule(entry.ruleName)) {
+                        error = "line " + to_string(lineNumber) + ": unknown rule " + entry.ruleName;
+                        return false;
+                    }
+                }
+                spec.rules.push_back(value);
+            }
+        }
+        else if (name == "densities") {
+            spec.densities.clear();
+            for (const string& value : values)
+                good = good && readValues(value, 0.1, spec.densities);
+            for (double& density : spec.densities) {
+                density = roundDensity(density);
+                good = good && density >= 0 && density <= 1;
+            }
+        }
+        else if (name == "sizes") {
+            spec.sizes.clear();
+            for (const string& value : values) {
+                size_t separator = value.find('x');
+                Dimensions size{0, 0};
+                good = good && separator != string::npos && readNumber(value.substr(0, separator), size.WIDTH)
+                       && readNumber(value.substr(separator + 1), size.HEIGHT) && size.WIDTH > 0
+                       && size.HEIGHT > 0;
+                spec.sizes.push_back(size);
+            }
+        }
+        else if (name == "seeds") {
+            spec.seeds.clear();
+            for (const string& value : values)
+                good = good && readValues<uint64_t>(value, 1, spec.seeds);
+        }
+        else if (name == "generations") {
+            spec.generations.clear();
+            for (const string& value : values)
+                good = good && readValues(value, 1, spec.generations);
+            for (int count : spec.generations)
+                good = good && count >= 0;
+        }
+        else if (name == "topologies") {
+            spec.topologies.clear();
+            for (const string& value : values) {
+                good = good && (value == "bounded" || value == "torus");
+                spec.topologies.push_back(value == "torus" ? TORUS : BOUNDED);
+            }
+        }
+        else if (name == "output") {
+            good = values.size() == 1;
+            spec.outputFile = values.front();
+        }
+        else {
+            error = "line " + to_string(lineNumber) + ": unknown parameter " + name;
+            return false;
+        }
+
+        if (!good) {
+            error = "line " + to_string(lineNumber) + ": bad value for " + name;
+            return false;
+        }
+    }
+
+    uint64_t combinations = 1;
+    for (uint64_t count : {spec.rules.size(), spec.densities.size(), spec.sizes.size(), spec.seeds.size(),
+                           spec.generations.size(), spec.topologies.size()}) {
+        combinations *= count;
+        if (combinations > MAX_RUNS) {
+            error = "more than " + to_string(MAX_RUNS) + " runs";
+            return false;
+        }
+    }
+
+    *this = spec;
+    return true;
+}
+
+bool ParameterSweep::loadFromFile(const string& fileName, string& error) {
+    ifstream file(fileName);
+    if (!file) {
+        error = "could not open " + fileName;
+        return false;
+    }
+
+    stringstream text;
+    text << file.rdbuf();
+    return parse(text.str(), error);
+}
+
+// Rules vary slowest and topologies fastest, as in the spec.
+vector<SweepRun> ParameterSweep::expand() const {
+    vector<SweepRun> expanded;
+    for (const string& ruleText : rules) {
+        RuleSchedule ruleSchedule;
+        ruleSchedule.parse(ruleText);
+        for (const Dimensions& size : sizes) {
+            for (double density : densities) {
+                for (uint64_t seed : seeds) {
+                    for (int count : generations) {
+                        for (TOPOLOGY topology : topologies) {
+                            SweepRun run;
+                            run.rules = ruleText;
+                            run.ruleSchedule = ruleSchedule;
+                            run.config.worldSize = size;
+                            run.config.seed = seed;
+                            run.config.density = density;
+                            run.config.topology = topology;
+                            run.generations = count;
+                            run.livingCells = 0;
+                            run.failed = false;
+                            expanded.push_back(run);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return expanded;
+}
+
+// The caller and a task per worker take the runs largest first from a shared
+// index, whichever order the pool runs its tasks in.
+void ParameterSweep::runSweep() {
+    runs = expand();
+    if (runs.empty())
+        return;
+
+    // Shared by the caller and the tasks, tasks that start late find no runs
+    // left and only touch this state.
+    struct SweepOrder {
+        vector<SweepRun*> runs;
+        atomic<size_t> next;
+        atomic<size_t> done;
+    };
+    shared_ptr<SweepOrder> order = make_shared<SweepOrder>();
+    for (SweepRun& run : runs)
+        order->runs.push_back(&run);
+    stable_sort(order->runs.begin(), order->runs.end(), [](const SweepRun* a, const SweepRun* b) {
+        return getWork(*a) > getWork(*b);
+    });
+    order->next = 0;
+    order->done = 0;
+
+    auto runNext = [order]() {
+        size_t index;
+        while ((index = order->next++) < order->runs.size()) {
+            simulate(*order->runs[index]);
+            order->done++;
+        }
+    };
+
+    WorkStealingPool& pool = WorkStealingPool::getInstance();
+    size_t tasks = min<size_t>(pool.getThreadCount(), runs.size() - 1);
+    for (size_t i = 0; i < tasks; i++)
+        pool.submit(runNext);
+    runNext();
+
+    // only the runs of this sweep, the pool may be running other tasks
+    while (order->done < runs.size())
+        this_thread::yield();
+}
+
+// The cells show a generation once the next one is calculated, so one more is
+// calculated to census the last generation. A run that throws, a rule file
+// removed since parse() or a world too large to allocate, is marked failed
+// rather than taking down the worker that ran it.
+void ParameterSweep::simulate(SweepRun& run) {
+    try {
+        Population population(run.config);
+        population.initiatePopulation(run.ruleSchedule);
+        for (int generation = 0; generation <= run.generations; generation++)
+            population.calculateNewGeneration();
+
+        Dimensions worldSize = population.getWorldSize();
+        vector<uint8_t> alive(worldSize.WIDTH * worldSize.HEIGHT);
+        population.readRegion(0, 0, worldSize.WIDTH, worldSize.HEIGHT, alive.data());
+        run.livingCells = count(alive.begin(), alive.end(), 1);
+        run.census.takeCensus(population);
+        run.failed = false;
+    }
+    catch (exception&) {
+        run.livingCells = 0;
+        run.census = Census();
+        run.failed = true;
+    }
+}
+
+void ParameterSweep::writeCsv(ostream& output) const {
+    output << "rules,width,height,topology,density,seed,generations,living_cells,objects,census,status\n";
+    for (const SweepRun& run : runs) {
+        output << '"' << run.rules << "\"," << run.config.worldSize.WIDTH << ',' << run.config.worldSize.HEIGHT << ','
+               << (run.config.topology == TORUS ? "torus" : "bounded") << ',' << run.config.density << ','
+               << run.config.seed << ',' << run.generations << ',' << run.livingCells << ','
+               << run.census.getTotalObjects() << ",\"";
+
+        const char* separator = "";
+        for (const auto& objectCount : run.census.getObjectCounts()) {
+            output << separator << objectCount.first << '=' << objectCount.second;
+            separator = ";";
+        }
+        output << "\"," << (run.failed ? "failed" : "ok") << '\n';
+    }
+}
+
+bool ParameterSweep::writeCsv() const {
+    ofstream file(outputFile);
+    if (!file)
+        return false;
+    writeCsv(file);
+    return static_cast<bool>(file);
+}
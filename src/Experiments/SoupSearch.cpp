@@ -0,0 +1,278 @@
+/**
+ * @file SoupSearch.cpp
+ * @brief Implementation of SoupSearch, class that runs batches of random soups
+ *  and takes the census of what they settle into.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Experiments/SoupSearch.h"
+#include "GoL_Rules/RuleFactory.h"
+#include "Support/Random.h"
+#include "Support/WorkStealingPool.h"
+#include <algorithm>
+#include <ios>
+#include <memory>
+#include <unordered_map>
+
+namespace {
+
+    // Hashes the living cells within the world. bitmap is reused from one
+    // generation to the next.
+    uint64_t hashLivingCells(Population& population, vector<uint64_t>& bitmap) {
+        Dimensions worldSize = population.getWorldSize();
+        int wordsPerRow = (worldSize.WIDTH + 63) / 64;
+        bitmap.resize(wordsPerRow * worldSize.HEIGHT);
+        population.readRegion(0, 0, worldSize.WIDTH, worldSize.HEIGHT, bitmap.data(), wordsPerRow);
+        return SoupSearch::hashBitmap(bitmap.data(), static_cast<int>(bitmap.size()));
+    }
+
+    /**
+     * @brief A soup running in a lane.
+     */
+    struct LaneSoup {
+        int index;                              /*!< Index of the soup, -1 if the lane is idle */
+        SoupResult result;
+        unordered_map<uint64_t, int> seenStates;
+        int entry;                              /*!< Schedule entry of the next generation */
+        int generationsLeft;                    /*!< Generations the entry still applies to */
+        bool fresh;                             /*!< First generation not yet hashed */
+    };
+}
+
+// Each soup is its own stream of the base seed.
+uint64_t SoupSearch::getSoupSeed(uint64_t baseSeed, int index) {
+    return getStreamSeed(baseSeed, index);
+}
+
+// Every word goes through the splitmix64 finalizer together with the hash so
+// far, which is a bijection, so every bit of a word reaches every bit of the
+// hash.
+uint64_t SoupSearch::hashBitmap(const uint64_t* bitmap, int words) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (int word = 0; word < words; word++) {
+        uint64_t state = hash ^ bitmap[word];
+        hash = splitMix64(state);
+    }
+    return hash;
+}
+
+// Rules with an action table are told apart by their birth and survival counts.
+bool SoupSearch::getLaneRules(const RuleSchedule& ruleSchedule, vector<LaneRule>& rules, vector<int>& entryRules) {
+    rules.clear();
+    entryRules.clear();
+    CellGrid cells;
+    cells.reset(3, 3);
+
+    for (const ScheduledRule& entry : ruleSchedule.getEntries()) {
+        ActionTable table;
+        bool tabulated = false;
+        try {
+            unique_ptr<RuleOfExistence> rule(RuleFactory::getInstance().createAndReturnRule(cells, entry.ruleName));
+            tabulated = rule->getActionTable(table);
+        }
+        catch (ios_base::failure&) {}
+        if (!tabulated)
+            return false;
+
+        LaneRule laneRule = LaneBoards::getLaneRule(table);
+        auto same = find_if(rules.begin(), rules.end(), [&laneRule](const LaneRule& other) {
+            return other.birthCounts == laneRule.birthCounts && other.survivalCounts == laneRule.survivalCounts
+                   && other.cardinal == laneRule.cardinal && other.diagonal == laneRule.diagonal;
+        });
+        entryRules.push_back(static_cast<int>(same - rules.begin()));
+        if (same == rules.end())
+            rules.push_back(laneRule);
+    }
+    return !rules.empty();
+}
+
+// The caller and a task per worker take the soups, or in lanes the shares of
+// soups, from a shared index and the caller waits for the last one. Soups in
+// lanes are split into one share per thread, each filling at least the 64
+// lanes.
+void SoupSearch::runSearch() {
+    results.assign(nrOfSoups, SoupResult{0, false, 0, 0});
+
+    WorkStealingPool& pool = WorkStealingPool::getInstance();
+    vector<LaneRule> rules;
+    vector<int> entryRules;
+    if (laneParallel && maxGenerations > 0 && config.worldSize.WIDTH > 0 && config.worldSize.HEIGHT > 0
+        && getLaneRules(ruleSchedule, rules, entryRules)) {
+        int threads = max<int>(pool.getThreadCount(), 1);
+        int share = max(LaneBoards::LANES, (nrOfSoups + threads - 1) / threads);
+        runShares((nrOfSoups + share - 1) / share, [this, share, rules, entryRules](int index) {
+            runLaneSoups(index * share, min(index * share + share, nrOfSoups), rules, entryRules);
+        });
+    }
+    else
+        runShares(nrOfSoups, [this](int index) { runSoup(index); });
+}
+
+// Tasks that start late find no shares left and only touch the counter.
+void SoupSearch::runShares(int shares, const function<void(int)>& run) {
+    if (shares <= 0)
+        return;
+
+    struct ShareCounter {
+        atomic<int> next;
+        atomic<int> done;
+    };
+    shared_ptr<ShareCounter> counter = make_shared<ShareCounter>();
+    counter->next = 0;
+    counter->done = 0;
+
+    const function<void(int)>* work = &run;
+    auto runNext = [counter, work, shares]() {
+        int index;
+        while ((index = counter->next++) < shares) {
+            (*work)(index);
+            counter->done++;
+        }
+    };
+
+    WorkStealingPool& pool = WorkStealingPool::getInstance();
+    int tasks = min<int>(pool.getThreadCount(), shares - 1);
+    for (int i = 0; i < tasks; i++)
+        pool.submit(runNext);
+    runNext();
+
+    // only the shares of this search, the pool may be running other tasks
+    while (counter->done < shares)
+        this_thread::yield();
+}
+
+// Simulates a soup until its state repeats, then counts its objects.
+void SoupSearch::runSoup(int index) {
+    SoupResult result{getSoupSeed(config.seed, index), false, 0, 0};
+
+    PopulationConfig soupConfig = config;
+    soupConfig.seed = result.seed;
+    Population population(soupConfig);
+    population.initiatePopulation(ruleSchedule);
+
+    // Generation at which each state was first seen. The first generation is
+    // skipped, as the board only shows the new state one generation later.
+    unordered_map<uint64_t, int> seenStates;
+    vector<uint64_t> bitmap;
+    while (result.generations < maxGenerations) {
+        result.generations = population.calculateNewGeneration();
+
+        uint64_t hash = hashLivingCells(population, bitmap);
+        auto seen = seenStates.find(hash);
+        if (seen != seenStates.end()) {
+            result.stabilized = true;
+            result.period = result.generations - seen->second;
+            break;
+        }
+        seenStates[hash] = result.generations;
+    }
+
+    Census soupCensus;
+    soupCensus.takeCensus(population);
+    recordSoup(index, result, soupCensus);
+}
+
+// A lane holds the generation the Population of its soup would have
+// committed, so the generations are counted and hashed as in runSoup().
+void SoupSearch::runLaneSoups(int firstSoup, int lastSoup, const vector<LaneRule>& rules,
+                              const vector<int>& entryRules) {
+    const vector<ScheduledRule>& entries = ruleSchedule.getEntries();
+    LaneBoards boards(config.worldSize, config.topology);
+    int wordsPerRow = boards.getWordsPerRow();
+    int bitmapWords = boards.getBitmapWords();
+    vector<uint64_t> bitmap(bitmapWords), bitmaps;
+    vector<LaneSoup> lanes(LaneBoards::LANES);
+    int nextSoup = firstSoup;
+
+    // puts the next soup into a lane, or leaves it idle and empty
+    auto startSoup = [&](int lane) {
+        LaneSoup& soup = lanes[lane];
+        soup.seenStates.clear();
+        if (nextSoup == lastSoup) {
+            soup.index = -1;
+            boards.setLane(lane, nullptr);
+            return;
+        }
+
+        soup.index = nextSoup++;
+        soup.result = SoupResult{getSoupSeed(config.seed, soup.index), false, 0, 0};
+        soup.entry = 0;
+        soup.generationsLeft = max(entries[0].generations, 1);
+        soup.fresh = true;
+
+        PopulationConfig soupConfig = config;
+        soupConfig.seed = soup.result.seed;
+        for (int row = 0; row < config.worldSize.HEIGHT; row++)
+            Population::randomizeRow(soupConfig, row, &bitmap[row * wordsPerRow]);
+        boards.setLane(lane, bitmap.data());
+    };
+
+    for (int lane = 0; lane < LaneBoards::LANES; lane++)
+        startSoup(lane);
+
+    vector<uint64_t> ruleLanes(rules.size());
+    bool running = true;
+    while (running) {
+        boards.readLanes(bitmaps);
+        fill(ruleLanes.begin(), ruleLanes.end(), 0);
+        running = false;
+
+        for (int lane = 0; lane < LaneBoards::LANES; lane++) {
+            LaneSoup& soup = lanes[lane];
+            if (soup.index < 0)
+                continue;
+
+            const uint64_t* laneBitmap = &bitmaps[static_cast<size_t>(lane) * bitmapWords];
+            soup.result.generations++;
+            soup.fresh = false;
+            uint64_t hash = hashBitmap(laneBitmap, bitmapWords);
+            auto seen = soup.seenStates.find(hash);
+            if (seen != soup.seenStates.end()) {
+                soup.result.stabilized = true;
+                soup.result.period = soup.result.generations - seen->second;
+            }
+            else {
+                soup.seenStates[hash] = soup.result.generations;
+            }
+
+            if (soup.result.stabilized || soup.result.generations == maxGenerations) {
+                Census soupCensus;
+                soupCensus.takeCensus(laneBitmap, wordsPerRow, config.worldSize, config.topology);
+                recordSoup(soup.index, soup.result, soupCensus);
+                startSoup(lane);
+            }
+
+            // a new soup is hashed before its first step
+            if (soup.index >= 0) {
+                running = true;
+                if (soup.fresh)
+                    continue;
+                ruleLanes[entryRules[soup.entry]] |= 1ull << lane;
+                if (--soup.generationsLeft == 0) {
+                    soup.entry = (soup.entry + 1 == static_cast<int>(entries.size())) ? 0 : soup.entry + 1;
+                    soup.generationsLeft = max(entries[soup.entry].generations, 1);
+                }
+            }
+        }
+
+        if (running)
+            boards.step(rules, ruleLanes);
+    }
+}
+
+void SoupSearch::recordSoup(int index, const SoupResult& result, const Census& soupCensus) {
+    lock_guard<mutex> guard(resultLock);
+    census.merge(soupCensus);
+    results[index] = result;
+}
+
+// Counts the soups that became periodic.
+int SoupSearch::getStabilizedSoups() {
+    int stabilized = 0;
+    for (const SoupResult& result : results) {
+        if (result.stabilized)
+            stabilized++;
+    }
+    return stabilized;
+}
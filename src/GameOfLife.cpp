@@ -12,11 +12,16 @@
 #include <chrono>
 #include "GoL_Rules/RuleFactory.h"
 
-GameOfLife::GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName)
-        : nrOfGenerations(nrOfGenerations), screenPrinter(ScreenPrinter::getInstance()) {
+GameOfLife::GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName,
+                       const PopulationConfig& config)
+        : GameOfLife(nrOfGenerations, RuleSchedule(evenRuleName, oddRuleName), config) {}
+
+GameOfLife::GameOfLife(int nrOfGenerations, const RuleSchedule& ruleSchedule, const PopulationConfig& config)
+        : population(config), nrOfGenerations(nrOfGenerations), screenPrinter(ScreenPrinter::getInstance()),
+          imageExporter(nullptr), liveView(nullptr) {
 
     // initiate population
-    population.initiatePopulation(evenRuleName, oddRuleName);
+    population.initiatePopulation(ruleSchedule);
 }
 
 /*
@@ -30,11 +35,20 @@ void GameOfLife::runSimulation() {
 
     // Print generation zero
     screenPrinter.printBoard(population);
+    if (imageExporter)
+        imageExporter->exportFrame(population, 0);
+    if (liveView)
+        liveView->publish(population, 0);
 
     // For each generation
-    while (population.calculateNewGeneration() < nrOfGenerations) {
+    int generation;
+    while ((generation = population.calculateNewGeneration()) < nrOfGenerations) {
         // Print the calculated generation
         screenPrinter.printBoard(population);
+        if (imageExporter)
+            imageExporter->exportFrame(population, generation);
+        if (liveView)
+            liveView->publish(population, generation);
 
         this_thread::sleep_for(std::chrono::milliseconds(100));
     }
@@ -7,9 +7,14 @@
  */
 
 #include "GoL_Rules/RuleFactory.h"
+#include <ios>
 #include "GoL_Rules/RuleOfExistence_Conway.h"
 #include "GoL_Rules/RuleOfExistence_VonNeumann.h"
 #include "GoL_Rules/RuleOfExistence_Erik.h"
+#include "GoL_Rules/RuleOfExistence_LargerThanLife.h"
+#include "GoL_Rules/RuleOfExistence_Generations.h"
+#include "GoL_Rules/RuleOfExistence_RuleMap.h"
+#include "GoL_Rules/RuleOfExistence_Lookup.h"
 
 // Singleton factory receiver.
 RuleFactory& RuleFactory::getInstance() {
@@ -17,13 +22,95 @@ RuleFactory& RuleFactory::getInstance() {
     return ruleFactory;
 }
 
+namespace {
+
+    // Constructs rules on the heap, the memory going with a throwing constructor.
+    struct HeapRules {
+        template<class Rule, class... Args>
+        RuleOfExistence* make(Args&&... args) { return new Rule(forward<Args>(args)...); }
+    };
+
+    // Constructs rules in an arena, which keeps the memory of a throwing
+    // constructor until the arena goes.
+    struct ArenaRules {
+        MonotonicArena& arena;
+
+        template<class Rule, class... Args>
+        RuleOfExistence* make(Args&&... args) {
+            return new (arena.allocate(sizeof(Rule), alignof(Rule))) Rule(forward<Args>(args)...);
+        }
+    };
+
+    // Constructs the named rule with the given construction policy.
+    template<class Rules>
+    RuleOfExistence* createRule(CellGrid& cells, const string& ruleName, Rules rules) {
+        if (ruleName == "von_neumann")
+            return rules.template make<RuleOfExistence_VonNeumann>(cells);
+        else if (ruleName == "erik")
+            return rules.template make<RuleOfExistence_Erik>(cells);
+        else if (ruleName.compare(0, 4, "map:") == 0)
+            return rules.template make<RuleOfExistence_RuleMap>(cells, ruleName.substr(4));
+        else if (ruleName.compare(0, 7, "lookup:") == 0)
+            return rules.template make<RuleOfExistence_Lookup>(cells, ruleName.substr(7));
+
+        LargerThanLifeLimits limits;
+        if (RuleOfExistence_LargerThanLife::parseRuleName(ruleName, limits))
+            return rules.template make<RuleOfExistence_LargerThanLife>(cells, limits, ruleName);
+
+        int states;
+        uint16_t birthCounts, survivalCounts;
+        if (RuleOfExistence_Generations::parseRuleName(ruleName, states, birthCounts, survivalCounts))
+            return rules.template make<RuleOfExistence_Generations>(cells, states, birthCounts, survivalCounts,
+                                                                    ruleName);
+
+        // defaults to Conway's rule
+        return rules.template make<RuleOfExistence_Conway>(cells);
+    }
+}
+
 // Creates and returns specified RuleOfExistence.
-RuleOfExistence* RuleFactory::createAndReturnRule(map<Point, Cell>& cells, string ruleName) {
-    if (ruleName == "von_neumann")
-        return new RuleOfExistence_VonNeumann(cells);
-    else if (ruleName == "erik")
-        return new RuleOfExistence_Erik(cells);
-
-    // defaults to Conway's rule
-    return new RuleOfExistence_Conway(cells);
-}
\ No newline at end of file
+RuleOfExistence* RuleFactory::createAndReturnRule(CellGrid& cells, string ruleName) {
+    return createRule(cells, ruleName, HeapRules());
+}
+
+// Creates specified RuleOfExistence in the arena.
+RuleOfExistence* RuleFactory::createAndReturnRule(CellGrid& cells, string ruleName, MonotonicArena& arena) {
+    return createRule(cells, ruleName, ArenaRules{arena});
+}
+
+// Named rules, in the order they were added.
+vector<string> RuleFactory::getRuleNames() {
+    return {"conway", "von_neumann", "erik", "bosco", "brians_brain", "star_wars"};
+}
+
+// The names createRule() tells apart before falling back to Conway's rule.
+bool RuleFactory::isRuleName(const string& ruleName) {
+    if (ruleName == "conway" || ruleName == "von_neumann" || ruleName == "erik")
+        return true;
+    if (ruleName.compare(0, 4, "map:") == 0)
+        return ruleName.size() > 4;
+    if (ruleName.compare(0, 7, "lookup:") == 0)
+        return isRuleName(ruleName.substr(7));
+
+    LargerThanLifeLimits limits;
+    int states;
+    uint16_t birthCounts, survivalCounts;
+    return RuleOfExistence_LargerThanLife::parseRuleName(ruleName, limits)
+           || RuleOfExistence_Generations::parseRuleName(ruleName, states, birthCounts, survivalCounts);
+}
+
+// Rules that can not be built throw ios_base::failure.
+bool RuleFactory::canCreateRule(const string& ruleName) {
+    if (!isRuleName(ruleName))
+        return false;
+
+    CellGrid cells;
+    cells.reset(3, 3);
+    try {
+        delete createAndReturnRule(cells, ruleName);
+        return true;
+    }
+    catch (ios_base::failure&) {
+        return false;
+    }
+}
@@ -7,28 +7,48 @@
   */
 
 #include "GoL_Rules/RuleOfExistence.h"
+#include <algorithm>
+#include "Support/WorkStealingPool.h"
+
+// Executes all rows of the world between the hooks of the concrete rule.
+void RuleOfExistence::executeRule() {
+    if (offsetColumns != cells.getColumns())
+        computeNeighbourOffsets();
+
+    beginGeneration();
+    WorkStealingPool::getInstance().parallelFor(1, cells.getRows() - 1, max(1, 16384 / max(cells.getColumns(), 1)),
+                                                [this](int firstRow, int lastRow) { executeRows(firstRow, lastRow); });
+    endGeneration();
+}
 
 
-// Determines the amount of alive neighbouring cells to current cell, using directions specified by the rule.
-int RuleOfExistence::countAliveNeighbours(Point currentPoint) {
-    // get current cell position
-    int column = currentPoint.x;
-    int row = currentPoint.y;
-
-    int aliveNeighbours = 0;
+// Turns each direction into the difference of the linear indices of two cells.
+void RuleOfExistence::computeNeighbourOffsets() {
+    offsetColumns = cells.getColumns();
+    neighbourCount = 0;
+    for (auto direction : DIRECTIONS)
+        neighbourOffsets[neighbourCount++] = direction.VERTICAL * offsetColumns + direction.HORIZONTAL;
+}
 
-    Point targetPoint;
-    // check neighbouring cells in all directions relevant for the rule
+// Tabulates getAction, the directions must be all cardinal and/or all diagonal ones.
+bool RuleOfExistence::getActionTable(ActionTable& table) {
+    int cardinal = 0, diagonal = 0;
     for (auto direction : DIRECTIONS) {
-        targetPoint.x = column + direction.HORIZONTAL;	// target cell's column
-        targetPoint.y = row + direction.VERTICAL;		// target cell's row
-
-        // is the neighbouring cell alive
-        if (cells.at(targetPoint).isAlive())
-            aliveNeighbours++;
+        if (direction.HORIZONTAL == 0 || direction.VERTICAL == 0)
+            cardinal++;
+        else
+            diagonal++;
     }
-
-    return aliveNeighbours;
+    if ((cardinal != 0 && cardinal != 4) || (diagonal != 0 && diagonal != 4))
+        return false;
+
+    table.cardinalMask = (cardinal == 4) ? -1 : 0;
+    table.diagonalMask = (diagonal == 4) ? -1 : 0;
+    for (int aliveNeighbours = 0; aliveNeighbours <= 8; aliveNeighbours++) {
+        table.actions[0][aliveNeighbours] = getAction(aliveNeighbours, false);
+        table.actions[1][aliveNeighbours] = getAction(aliveNeighbours, true);
+    }
+    return true;
 }
 
 // Determines what action should be taken regarding the current cell, based on alive neighbouring cells.
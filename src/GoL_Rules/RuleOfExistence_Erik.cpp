@@ -8,39 +8,68 @@
 
 #include "GoL_Rules/RuleOfExistence_Erik.h"
 
-// Execute the rule specific for Erik.
-void RuleOfExistence_Erik::executeRule() {
-    for (auto it = cells.begin(); it != cells.end(); it++) {
-
-        // referens current cell
-        Cell& cell = it->second;
-
-        // Ignore cells that is part of the rim
-        if (cell.isRimCell())
-            continue;
-
-        // get amount of alive neighbouring cells
-        int aliveNeighbours = countAliveNeighbours(it->first);
-
-        // determine action for cell
-        ACTION action = getAction(aliveNeighbours, cell.isAlive());
-
-        if (action == KILL_CELL)
-            cell.setNextColor(STATE_COLORS.DEAD);
-
-        else if (action == GIVE_CELL_LIFE)
-            cell.setNextColor(STATE_COLORS.LIVING);
-
+// Cells are visited column by column in the order that decides which cell
+// becomes prime elder, the previous elder splits that order in two.
+void RuleOfExistence_Erik::beginGeneration() {
+    elderPosition = (primeElder >= 0) ? getPosition(primeElder) : -1;
+    oldestBefore = ElderCandidate{-1, 0};
+    oldestAfter = ElderCandidate{-1, 0};
+}
 
+// Execute the rule specific for Erik.
+void RuleOfExistence_Erik::executeRows(int firstRow, int lastRow) {
+    int columns = cells.getColumns();
+    ElderCandidate before{-1, 0}, after{-1, 0};
+
+    // Only the world itself is visited, the rim or halo around it is left alone.
+    for (int row = firstRow; row < lastRow; row++) {
+        for (int column = 1; column < columns - 1; column++) {
+            int index = row * columns + column;
+
+            // referens current cell
+            Cell& cell = cells[index];
+
+            // get amount of alive neighbouring cells
+            int aliveNeighbours = countAliveNeighbours(index);
+
+            // determine action for cell
+            ACTION action = getAction(aliveNeighbours, cell.isAlive());
+
+            if (action == KILL_CELL)
+                cell.setNextColor(STATE_COLORS.DEAD);
+
+            else if (action == GIVE_CELL_LIFE)
+                cell.setNextColor(STATE_COLORS.LIVING);
+
+            // With age comes experience. Cells older than 5 generations recieves a cyan color.
+            // If the cell is older than 9 generations, it gets the value 'E' (for Erik) showing
+            // its total awesomeness.
+            erikfyCell(cell, action);
+
+            // Surviving cells with an 'E' may become prime elder
+            if (action != KILL_CELL && cell.getAge() > 9) {
+                int position = getPosition(index);
+                if (position < elderPosition)
+                    keepOldest(before, cell.getAge(), position);
+                else if (position > elderPosition)
+                    keepOldest(after, cell.getAge(), position);
+            }
+
+            // the cell will know what to do, based on this action
+            cell.setNextGenerationAction(action);
+        }
+    }
 
-        // With age comes experience. Cells older than 5 generations recieves a cyan color.
-        // If the cell is older than 9 generations, it gets the value 'E' (for Erik) showing
-        // its total awesomeness.
-        erikfyCell(cell, action);
+    lock_guard<mutex> guard(candidateLock);
+    if (before.age >= 0)
+        keepOldest(oldestBefore, before.age, before.position);
+    if (after.age >= 0)
+        keepOldest(oldestAfter, after.age, after.position);
+}
 
-        // the cell will know what to do, based on this action
-        cell.setNextGenerationAction(action);
-    }
+// All rows are done, only one elder remains.
+void RuleOfExistence_Erik::endGeneration() {
+    electPrimeElder(oldestBefore, oldestAfter);
 }
 
 /*
@@ -59,33 +88,53 @@ void RuleOfExistence_Erik::erikfyCell(Cell& cell, ACTION action) {
             cell.setNextColor(STATE_COLORS.OLD);
 
         // A very old cell will get a value of 'E'
-        if (cellAge > 9) {
+        if (cellAge > 9)
             cell.setNextCellValue(usedCellValue);
-
-            // Determine prime elder, an extremely rare case where a cell has survived longer than any other.
-            if (primeElder == nullptr || cell.getAge() > primeElder->getAge())
-                setPrimeElder(&cell);
-        }
     }
 
         // An old cell dies, reset its value
     else if (cell.getCellValue() == usedCellValue) {
         cell.setNextCellValue('#');
-
-        // if the cell is a prime elder, nullify pointer
-        if(&cell == primeElder)
-            primeElder = nullptr;
     }
 }
 
 /*
-Sets the prime elder, a very rare occasion of a cell surviving longer than any other. Only one cell
-can be elder at a time.
+Determines the prime elder, an extremely rare case where a cell has survived longer than any other.
+Only one cell can be elder at a time.
 */
-void RuleOfExistence_Erik::setPrimeElder(Cell* newElder) {
-    if (primeElder != nullptr)
-        primeElder->setNextColor(STATE_COLORS.OLD);
+void RuleOfExistence_Erik::electPrimeElder(ElderCandidate before, ElderCandidate after) {
+    ElderCandidate elected{-1, 0};
+
+    if (primeElder < 0) {
+        elected = after;
+    }
+    else {
+        Cell& previous = cells[primeElder];
+        int previousAge = previous.getAge();
+        ACTION action = getAction(countAliveNeighbours(primeElder), previous.isAlive());
+
+        if (before.age > previousAge) {
+            // replaced before its own turn, which may still have changed its color
+            elected = before;
+            keepOldest(elected, after.age, after.position);
+            if ((action == IGNORE_CELL || action == DO_NOTHING) && previousAge <= 4)
+                previous.setNextColor(STATE_COLORS.OLD);
+        }
+        else if (action == KILL_CELL && previous.getCellValue() == usedCellValue) {
+            // the elder died, any cell after it may take its place
+            primeElder = -1;
+            elected = after;
+        }
+        else if (after.age > previousAge) {
+            // replaced after its own turn
+            elected = after;
+            previous.setNextColor(STATE_COLORS.OLD);
+        }
+    }
 
-    primeElder = newElder;
-    primeElder->setNextColor(STATE_COLORS.ELDER);
-}
\ No newline at end of file
+    if (elected.age >= 0) {
+        int rows = cells.getRows();
+        primeElder = (elected.position % rows) * cells.getColumns() + elected.position / rows;
+        cells[primeElder].setNextColor(STATE_COLORS.ELDER);
+    }
+}
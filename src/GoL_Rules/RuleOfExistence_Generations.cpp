@@ -0,0 +1,254 @@
+/**
+  * @file RuleOfExistence_Generations.cpp
+  * @brief Implementation of the Generations rule class.
+  * @date 2018-11-04
+  * @version 0.1
+  */
+
+#include "GoL_Rules/RuleOfExistence_Generations.h"
+#include <algorithm>
+#include <sstream>
+#include "Support/WorkStealingPool.h"
+
+namespace {
+
+    // Reads a list of neighbour counts such as "345", each 0 to 8.
+    bool parseCounts(const string& text, uint16_t& counts) {
+        counts = 0;
+        for (char digit : text) {
+            if (digit < '0' || digit > '8')
+                return false;
+            counts |= 1 << (digit - '0');
+        }
+        return true;
+    }
+
+    // Adds a one bit input to a four bit counter, 64 lanes at a time.
+    inline void addBit(uint64_t count[4], uint64_t input) {
+        for (int b = 0; b < 4; b++) {
+            uint64_t carry = count[b] & input;
+            count[b] ^= input;
+            input = carry;
+        }
+    }
+
+    // Lanes in which the bit sliced value equals value.
+    inline uint64_t lanesEqual(const uint64_t planes[4], int value) {
+        uint64_t equal = ~0ull;
+        for (int b = 0; b < 4; b++)
+            equal &= ((value >> b) & 1) ? planes[b] : ~planes[b];
+        return equal;
+    }
+}
+
+RuleOfExistence_Generations::RuleOfExistence_Generations(CellGrid& cells, int states, uint16_t birthCounts,
+                                                         uint16_t survivalCounts, string ruleName)
+        : RuleOfExistence({ 0, 0, 0 }, cells, ALL_DIRECTIONS, ruleName), states(min(max(states, 2), 16)),
+          bits(1), birthCounts(birthCounts), survivalCounts(survivalCounts), width(0), height(0), wordsPerRow(0) {
+    while ((1 << bits) < this->states)
+        bits++;
+}
+
+// Reads "S/B/C" or "Bb/Ss/Cc", with survival and birth swapping places.
+bool RuleOfExistence_Generations::parseRuleName(const string& ruleName, int& states, uint16_t& birthCounts,
+                                                uint16_t& survivalCounts) {
+    if (ruleName == "brians_brain")
+        return parseRuleName("/2/3", states, birthCounts, survivalCounts);
+    if (ruleName == "star_wars")
+        return parseRuleName("345/2/4", states, birthCounts, survivalCounts);
+
+    vector<string> fields;
+    istringstream text(ruleName);
+    string field;
+    while (getline(text, field, '/'))
+        fields.push_back(field);
+    if (ruleName.empty() || ruleName.back() == '/' || fields.size() != 3)
+        return false;
+
+    string survival = fields[0], birth = fields[1], stateCount = fields[2];
+    if (!fields[0].empty() && fields[0][0] == 'B') {
+        if (fields[1].empty() || fields[1][0] != 'S' || fields[2].empty() || fields[2][0] != 'C')
+            return false;
+        birth = fields[0].substr(1);
+        survival = fields[1].substr(1);
+        stateCount = fields[2].substr(1);
+    }
+
+    if (stateCount.empty() || stateCount.size() > 2 || stateCount.find_first_not_of("0123456789") != string::npos)
+        return false;
+    states = stoi(stateCount);
+
+    return states >= 2 && states <= 16 && parseCounts(birth, birthCounts) && parseCounts(survival, survivalCounts);
+}
+
+// Wraps the row on a torus, rows outside a bounded world are empty.
+uint64_t RuleOfExistence_Generations::livingCells(int row, int word) const {
+    if (row < 0 || row >= height) {
+        if (cells.getTopology() != TORUS)
+            return 0;
+        row = (row + height) % height;
+    }
+
+    const uint64_t* state = &planes[(row * wordsPerRow + word) * bits];
+    uint64_t living = state[0];
+    for (int b = 1; b < bits; b++)
+        living &= ~state[b];
+    return living;
+}
+
+// Dying cells fade through the palette, the longer they are dying.
+COLOR RuleOfExistence_Generations::getStateColor(int state) const {
+    if (state == 0)
+        return STATE_COLORS.DEAD;
+    if (state == 1)
+        return STATE_COLORS.LIVING;
+    return DYING_COLORS[(state - 2) * 4 / (states - 2)];
+}
+
+int RuleOfExistence_Generations::getState(int column, int row) const {
+    if (column < 0 || row < 0 || column >= width || row >= height)
+        return 0;
+
+    const uint64_t* state = &planes[(row * wordsPerRow + column / 64) * bits];
+    int value = 0;
+    for (int b = 0; b < bits; b++)
+        value |= ((state[b] >> (column % 64)) & 1) << b;
+    return value;
+}
+
+// Every cell is dead until beginGeneration finds it alive.
+void RuleOfExistence_Generations::reset() {
+    fill(planes.begin(), planes.end(), 0);
+    fill(nextPlanes.begin(), nextPlanes.end(), 0);
+}
+
+// Living cells are in state 1, cells another rule killed are dead.
+void RuleOfExistence_Generations::beginGeneration() {
+    int columns = cells.getColumns();
+    if (width != columns - 2 || height != cells.getRows() - 2) {
+        width = max(columns - 2, 0);
+        height = max(cells.getRows() - 2, 0);
+        wordsPerRow = (width + 63) / 64;
+        planes.assign(height * wordsPerRow * bits, 0);
+        nextPlanes.assign(planes.size(), 0);
+    }
+
+    WorkStealingPool::getInstance().parallelFor(0, height, 16, [&](int firstRow, int lastRow) {
+        for (int row = firstRow; row < lastRow; row++) {
+            for (int word = 0; word < wordsPerRow; word++) {
+                uint64_t living = 0;
+                int firstColumn = word * 64;
+                int lastColumn = min(firstColumn + 64, width);
+                Cell* cell = &cells[(row + 1) * columns + firstColumn + 1];
+                for (int column = firstColumn; column < lastColumn; column++, cell++)
+                    living |= static_cast<uint64_t>(cell->isAlive()) << (column - firstColumn);
+
+                uint64_t* state = &planes[(row * wordsPerRow + word) * bits];
+                uint64_t wasLiving = state[0];
+                for (int b = 1; b < bits; b++) {
+                    wasLiving &= ~state[b];
+                    state[b] &= ~living;
+                }
+                state[0] = (state[0] & ~(wasLiving & ~living)) | living;
+            }
+        }
+    });
+}
+
+// Execute the rule specific for Generations.
+void RuleOfExistence_Generations::executeRows(int firstRow, int lastRow) {
+    bool torus = cells.getTopology() == TORUS;
+    int lastBit = (width - 1) % 64;
+    uint64_t lastWordMask = (width % 64 == 0) ? ~0ull : (1ull << (width % 64)) - 1;
+
+    for (int row = firstRow; row < lastRow; row++) {
+        int y = row - 1;
+        for (int word = 0; word < wordsPerRow; word++) {
+            uint64_t count[4] = { 0, 0, 0, 0 };
+
+            // living cells of the rows above, at and below y, shifted so each
+            // lane holds its west, own or east neighbour
+            for (int dy = -1; dy <= 1; dy++) {
+                uint64_t living = livingCells(y + dy, word);
+                uint64_t previous, next;
+                if (word > 0)
+                    previous = livingCells(y + dy, word - 1) >> 63;
+                else
+                    previous = torus ? (livingCells(y + dy, wordsPerRow - 1) >> lastBit) & 1 : 0;
+                if (word + 1 < wordsPerRow)
+                    next = livingCells(y + dy, word + 1) << 63;
+                else
+                    next = torus ? (livingCells(y + dy, 0) & 1) << lastBit : 0;
+
+                addBit(count, (living << 1) | previous);
+                addBit(count, (living >> 1) | next);
+                if (dy != 0)
+                    addBit(count, living);
+            }
+
+            uint64_t born = 0, survives = 0;
+            for (int n = 0; n <= 8; n++) {
+                if (((birthCounts | survivalCounts) >> n) & 1) {
+                    uint64_t lanes = lanesEqual(count, n);
+                    if ((birthCounts >> n) & 1)
+                        born |= lanes;
+                    if ((survivalCounts >> n) & 1)
+                        survives |= lanes;
+                }
+            }
+
+            // dead cells may be born, living cells live on or start dying and
+            // dying cells move on to the next state, the last one wrapping to 0
+            const uint64_t* state = &planes[(row - 1) * wordsPerRow * bits + word * bits];
+            uint64_t* nextState = &nextPlanes[(row - 1) * wordsPerRow * bits + word * bits];
+            uint64_t current[4] = { 0, 0, 0, 0 };
+            copy(state, state + bits, current);
+
+            uint64_t dead = ~(current[0] | current[1] | current[2] | current[3]);
+            uint64_t living = current[0] & ~(current[1] | current[2] | current[3]);
+            uint64_t staysAlive = living & survives;
+            uint64_t advancing = ~dead & ~staysAlive;
+
+            uint64_t incremented[4];
+            uint64_t carry = ~0ull;
+            for (int b = 0; b < 4; b++) {
+                incremented[b] = current[b] ^ carry;
+                carry &= current[b];
+            }
+            uint64_t wraps = lanesEqual(incremented, states);
+            uint64_t valid = (word + 1 == wordsPerRow) ? lastWordMask : ~0ull;
+
+            for (int b = 0; b < bits; b++) {
+                uint64_t plane = advancing & incremented[b] & ~wraps;
+                if (b == 0)
+                    plane |= (dead & born) | staysAlive;
+                nextState[b] = plane & valid;
+            }
+
+            // tell the cells what their new state means to them
+            int firstColumn = word * 64;
+            int lastColumn = min(firstColumn + 64, width);
+            Cell* cell = &cells[row * cells.getColumns() + firstColumn + 1];
+            for (int column = firstColumn; column < lastColumn; column++, cell++) {
+                int lane = column - firstColumn;
+                int oldState = 0, newState = 0;
+                for (int b = 0; b < bits; b++) {
+                    oldState |= ((state[b] >> lane) & 1) << b;
+                    newState |= ((nextState[b] >> lane) & 1) << b;
+                }
+
+                ACTION action;
+                if (newState == 1)
+                    action = (oldState == 1) ? IGNORE_CELL : GIVE_CELL_LIFE;
+                else
+                    action = (oldState == 1) ? KILL_CELL : DO_NOTHING;
+
+                if (action != IGNORE_CELL)
+                    cell->setNextColor(getStateColor(newState));
+
+                // the cell will know what to do, based on this action
+                cell->setNextGenerationAction(action);
+            }
+        }
+    }
+}
@@ -0,0 +1,130 @@
+/**
+  * @file RuleOfExistence_LargerThanLife.cpp
+  * @brief Implementation of the Larger than Life rule class.
+  * @date 2018-11-04
+  * @version 0.1
+  */
+
+#include "GoL_Rules/RuleOfExistence_LargerThanLife.h"
+#include <cstdlib>
+#include <sstream>
+
+namespace {
+
+    // Reads a whole non-negative number.
+    bool parseNumber(const string& text, int& number) {
+        if (text.empty() || text.size() > 6 || text.find_first_not_of("0123456789") != string::npos)
+            return false;
+        number = atoi(text.c_str());
+        return true;
+    }
+
+    // Reads "a..b", or "a" meaning "a..a".
+    bool parseRange(const string& text, int& first, int& last) {
+        size_t dots = text.find("..");
+        if (dots == string::npos)
+            return parseNumber(text, first) && parseNumber(text, last);
+        return parseNumber(text.substr(0, dots), first) && parseNumber(text.substr(dots + 2), last)
+               && first <= last;
+    }
+}
+
+// Reads the comma separated fields of a Golly rule name, R, S and B are required.
+bool RuleOfExistence_LargerThanLife::parseRuleName(const string& ruleName, LargerThanLifeLimits& limits) {
+    if (ruleName == "bosco")
+        return parseRuleName("R5,C0,M1,S34..58,B34..45,NM", limits);
+
+    limits = LargerThanLifeLimits{ 0, MOORE, false, 0, 0, 0, 0 };
+    bool hasSurvival = false, hasBirth = false;
+
+    istringstream fields(ruleName);
+    string field;
+    while (getline(fields, field, ',')) {
+        if (field.size() < 2)
+            return false;
+
+        string value = field.substr(1);
+        int states;
+        switch (field[0]) {
+            case 'R':
+                if (!parseNumber(value, limits.radius) || limits.radius < 1 || limits.radius > 500)
+                    return false;
+                break;
+            case 'C':
+                // only cells that are either dead or alive are supported
+                if (!parseNumber(value, states) || states > 2)
+                    return false;
+                break;
+            case 'M':
+                if (value != "0" && value != "1")
+                    return false;
+                limits.countsCell = (value == "1");
+                break;
+            case 'S':
+                hasSurvival = parseRange(value, limits.survivalMin, limits.survivalMax);
+                if (!hasSurvival)
+                    return false;
+                break;
+            case 'B':
+                hasBirth = parseRange(value, limits.birthMin, limits.birthMax);
+                if (!hasBirth)
+                    return false;
+                break;
+            case 'N':
+                if (value != "M" && value != "N")
+                    return false;
+                limits.shape = (value == "M") ? MOORE : VON_NEUMANN;
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return limits.radius > 0 && hasSurvival && hasBirth;
+}
+
+// The table only holds what the shape of the neighbourhood needs.
+void RuleOfExistence_LargerThanLife::beginGeneration() {
+    if (LIMITS.shape == MOORE)
+        livingCells.build(cells);
+    else
+        livingCells.buildDiamonds(cells, LIMITS.radius);
+}
+
+// Execute the rule specific for Larger than Life.
+void RuleOfExistence_LargerThanLife::executeRows(int firstRow, int lastRow) {
+    int radius = LIMITS.radius;
+
+    // Only the world itself is visited, the rim or halo around it is left alone
+    for (int row = firstRow; row < lastRow; row++) {
+        for (int column = 1; column < cells.getColumns() - 1; column++) {
+            Cell& cell = cells[row * cells.getColumns() + column];
+            bool isAlive = cell.isAlive();
+
+            // the table has no rim, world positions start at zero
+            int x = column - 1, y = row - 1;
+            int aliveNeighbours = (LIMITS.shape == MOORE)
+                                  ? livingCells.sum(x - radius, y - radius, x + radius, y + radius)
+                                  : livingCells.sumDiamond(x, y);
+            if (!LIMITS.countsCell)
+                aliveNeighbours -= isAlive;
+
+            ACTION action;
+            if (isAlive)
+                action = (aliveNeighbours >= LIMITS.survivalMin && aliveNeighbours <= LIMITS.survivalMax)
+                         ? IGNORE_CELL : KILL_CELL;
+            else
+                action = (aliveNeighbours >= LIMITS.birthMin && aliveNeighbours <= LIMITS.birthMax)
+                         ? GIVE_CELL_LIFE : DO_NOTHING;
+
+            if (action == KILL_CELL)
+                cell.setNextColor(STATE_COLORS.DEAD);
+
+            else if (action == GIVE_CELL_LIFE)
+                cell.setNextColor(STATE_COLORS.LIVING);
+
+            // the cell will know what to do, based on this action
+            cell.setNextGenerationAction(action);
+        }
+    }
+}
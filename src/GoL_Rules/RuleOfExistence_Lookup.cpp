@@ -0,0 +1,132 @@
+/**
+  * @file RuleOfExistence_Lookup.cpp
+  * @brief Implementation of the lookup rule class.
+  * @date 2018-11-04
+  * @version 0.1
+  */
+
+#include "GoL_Rules/RuleOfExistence_Lookup.h"
+#include <iostream>
+#include "GoL_Rules/RuleFactory.h"
+#include "GoL_Rules/RuleOfExistence_Generations.h"
+
+namespace {
+
+    // Four cells of a packed row, starting at bit.
+    inline int readNibble(const uint64_t* row, int bit) {
+        int shift = bit % 64;
+        uint64_t bits = row[bit / 64] >> shift;
+        if (shift > 60)
+            bits |= row[bit / 64 + 1] << (64 - shift);
+        return static_cast<int>(bits & 0xF);
+    }
+
+    // Gives the cell the action the rules of existence give a cell becoming next.
+    inline void setNextState(Cell& cell, bool alive, bool next) {
+        if (next && !alive) {
+            cell.setNextColor(STATE_COLORS.LIVING);
+            cell.setNextGenerationAction(GIVE_CELL_LIFE);
+        }
+        else if (!next && alive) {
+            cell.setNextColor(STATE_COLORS.DEAD);
+            cell.setNextGenerationAction(KILL_CELL);
+        }
+        else
+            cell.setNextGenerationAction(alive ? IGNORE_CELL : DO_NOTHING);
+    }
+}
+
+// Tabulates the rule that is run, which is only needed while constructing.
+RuleOfExistence_Lookup::RuleOfExistence_Lookup(CellGrid& cells, string innerRuleName)
+        : RuleOfExistence({ 2,3,3 }, cells, ALL_DIRECTIONS, "lookup:" + innerRuleName), nextBlocks(65536) {
+    bool tabulated = false;
+    int states;
+    uint16_t birthCounts, survivalCounts;
+    if (RuleOfExistence_Generations::parseRuleName(innerRuleName, states, birthCounts, survivalCounts)) {
+        // two states are alive and dead, counting all eight neighbours
+        tabulated = states == 2;
+        table.cardinalMask = table.diagonalMask = -1;
+        for (int n = 0; n <= 8; n++) {
+            table.actions[0][n] = ((birthCounts >> n) & 1) ? GIVE_CELL_LIFE : DO_NOTHING;
+            table.actions[1][n] = ((survivalCounts >> n) & 1) ? IGNORE_CELL : KILL_CELL;
+        }
+    }
+    else if (innerRuleName.compare(0, 7, "lookup:") != 0) {
+        RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, innerRuleName);
+        tabulated = rule->getActionTable(table);
+        delete rule;
+    }
+
+    if (!tabulated) {
+        cout << "Rule " << innerRuleName << " can not be looked up. Closing application." << endl;
+        throw ios_base::failure("");
+    }
+    tabulateBlocks();
+}
+
+// Counts the neighbours of the four middle cells of every block.
+void RuleOfExistence_Lookup::tabulateBlocks() {
+    for (int block = 0; block < 65536; block++) {
+        auto isAlive = [block](int x, int y) { return (block >> (4 * y + x)) & 1; };
+
+        int next = 0;
+        for (int y = 1; y <= 2; y++) {
+            for (int x = 1; x <= 2; x++) {
+                int cardinal = isAlive(x, y - 1) + isAlive(x + 1, y) + isAlive(x, y + 1) + isAlive(x - 1, y);
+                int diagonal = isAlive(x + 1, y - 1) + isAlive(x + 1, y + 1) + isAlive(x - 1, y + 1)
+                               + isAlive(x - 1, y - 1);
+                int alive = isAlive(x, y);
+                ACTION action = table.actions[alive][(cardinal & table.cardinalMask) + (diagonal & table.diagonalMask)];
+                if (action == GIVE_CELL_LIFE || (action != KILL_CELL && alive))
+                    next |= 1 << (2 * (y - 1) + (x - 1));
+            }
+        }
+        nextBlocks[block] = static_cast<uint8_t>(next);
+    }
+}
+
+// Packs the rows around the given ones, then steps them two rows and two
+// columns at a time.
+void RuleOfExistence_Lookup::executeRows(int firstRow, int lastRow) {
+    int columns = cells.getColumns();
+
+    // rows firstRow - 1 to lastRow, rim or halo included, with a spare word
+    // for blocks reaching past the last column and an empty row at the end
+    int wordsPerRow = (columns + 1) / 64 + 2;
+    int packedRows = lastRow - firstRow + 2;
+    vector<uint64_t> packed(static_cast<size_t>(packedRows + 1) * wordsPerRow, 0);
+    for (int i = 0; i < packedRows; i++) {
+        uint64_t* words = &packed[static_cast<size_t>(i) * wordsPerRow];
+        Cell* cell = &cells[(firstRow - 1 + i) * columns];
+        for (int column = 0; column < columns; column++)
+            words[column / 64] |= static_cast<uint64_t>(cell[column].isAlive()) << (column % 64);
+    }
+    const uint64_t* emptyRow = &packed[static_cast<size_t>(packedRows) * wordsPerRow];
+
+    for (int row = firstRow; row < lastRow; row += 2) {
+        const uint64_t* above = &packed[static_cast<size_t>(row - firstRow) * wordsPerRow];
+        const uint64_t* upper = above + wordsPerRow;
+        const uint64_t* lower = upper + wordsPerRow;
+        bool pair = row + 1 < lastRow;
+        const uint64_t* below = pair ? lower + wordsPerRow : emptyRow;
+
+        Cell* upperCells = &cells[row * columns];
+        Cell* lowerCells = upperCells + columns;
+        for (int column = 1; column < columns - 1; column += 2) {
+            int block = readNibble(above, column - 1) | readNibble(upper, column - 1) << 4
+                        | readNibble(lower, column - 1) << 8 | readNibble(below, column - 1) << 12;
+            int next = nextBlocks[block];
+            bool second = column + 1 < columns - 1;
+
+            // the middle cells are bits 5, 6, 9 and 10 of the block
+            setNextState(upperCells[column], (block >> 5) & 1, next & 1);
+            if (second)
+                setNextState(upperCells[column + 1], (block >> 6) & 1, (next >> 1) & 1);
+            if (pair) {
+                setNextState(lowerCells[column], (block >> 9) & 1, (next >> 2) & 1);
+                if (second)
+                    setNextState(lowerCells[column + 1], (block >> 10) & 1, (next >> 3) & 1);
+            }
+        }
+    }
+}
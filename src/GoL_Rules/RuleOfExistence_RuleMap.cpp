@@ -0,0 +1,92 @@
+/**
+  * @file RuleOfExistence_RuleMap.cpp
+  * @brief Implementation of the rule map rule class.
+  * @date 2018-11-04
+  * @version 0.1
+  */
+
+#include "GoL_Rules/RuleOfExistence_RuleMap.h"
+#include <iostream>
+#include "GoL_Rules/RuleFactory.h"
+#include "Support/FileLoader.h"
+
+// Loads the map and tabulates each of its rules.
+RuleOfExistence_RuleMap::RuleOfExistence_RuleMap(CellGrid& cells, string mapFileName)
+        : RuleOfExistence({ 2,3,3 }, cells, ALL_DIRECTIONS, "map:" + mapFileName), mapSize{ 0, 0 },
+          mappedColumns(0), mappedRows(0) {
+    vector<string> ruleNames;
+    FileLoader fileLoader;
+    fileLoader.loadRuleMapFromFile(mapFileName, ruleNames, mapSize, mapIds);
+
+    tables.resize(ruleNames.size());
+    for (size_t i = 0; i < ruleNames.size(); i++) {
+        // maps can not be nested, a map naming itself would never be done loading
+        bool tabulated = false;
+        if (ruleNames[i].compare(0, 4, "map:") != 0) {
+            RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, ruleNames[i]);
+            tabulated = rule->getActionTable(tables[i]);
+            delete rule;
+        }
+
+        if (!tabulated) {
+            cout << "Rule " << ruleNames[i] << " can not be used in a rule map. Closing application." << endl;
+            throw ios_base::failure("");
+        }
+    }
+}
+
+// Each world cell takes the map cell covering the same fraction of the world.
+void RuleOfExistence_RuleMap::stretchMap() {
+    mappedColumns = cells.getColumns();
+    mappedRows = cells.getRows();
+    int width = mappedColumns - 2, height = mappedRows - 2;
+
+    ruleIds.assign(mappedColumns * mappedRows, 0);
+    for (int row = 0; row < height; row++) {
+        const uint8_t* mapRow = &mapIds[(row * mapSize.HEIGHT / height) * mapSize.WIDTH];
+        uint8_t* ruleRow = &ruleIds[(row + 1) * mappedColumns + 1];
+        for (int column = 0; column < width; column++)
+            ruleRow[column] = mapRow[column * mapSize.WIDTH / width];
+    }
+}
+
+void RuleOfExistence_RuleMap::beginGeneration() {
+    if (mappedColumns != cells.getColumns() || mappedRows != cells.getRows())
+        stretchMap();
+    if (offsetColumns != cells.getColumns())
+        computeNeighbourOffsets();
+}
+
+// Execute the rule of the region of every cell.
+void RuleOfExistence_RuleMap::executeRows(int firstRow, int lastRow) {
+    // Only the world itself is visited, the rim or halo around it is left alone
+    for (int row = firstRow; row < lastRow; row++) {
+        for (int column = 1; column < cells.getColumns() - 1; column++) {
+            int index = row * cells.getColumns() + column;
+
+            // referens current cell
+            Cell& cell = cells[index];
+
+            // ALL_DIRECTIONS lists the cardinal directions before the diagonal ones
+            int cardinalNeighbours = 0, diagonalNeighbours = 0;
+            for (int i = 0; i < 4; i++) {
+                cardinalNeighbours += cells[index + neighbourOffsets[i]].isAlive();
+                diagonalNeighbours += cells[index + neighbourOffsets[i + 4]].isAlive();
+            }
+
+            // look up the action in the table of the rule of the cell
+            const ActionTable& table = tables[ruleIds[index]];
+            int aliveNeighbours = (cardinalNeighbours & table.cardinalMask) + (diagonalNeighbours & table.diagonalMask);
+            ACTION action = table.actions[cell.isAlive()][aliveNeighbours];
+
+            if (action == KILL_CELL)
+                cell.setNextColor(STATE_COLORS.DEAD);
+
+            else if (action == GIVE_CELL_LIFE)
+                cell.setNextColor(STATE_COLORS.LIVING);
+
+            // the cell will know what to do, based on this action
+            cell.setNextGenerationAction(action);
+        }
+    }
+}
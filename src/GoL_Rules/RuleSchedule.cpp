@@ -0,0 +1,87 @@
+/**
+ * @file RuleSchedule.cpp
+ * @brief Implementation of RuleSchedule, the order in which rules are applied
+ *  to the generations.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "GoL_Rules/RuleSchedule.h"
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+    // Removes spaces and tabs around text.
+    string trim(const string& text) {
+        size_t first = text.find_first_not_of(" \t\r");
+        if (first == string::npos)
+            return "";
+        return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+    }
+}
+
+RuleSchedule::RuleSchedule(string evenRuleName, string oddRuleName) {
+    add(evenRuleName);
+    add(oddRuleName.empty() ? evenRuleName : oddRuleName);
+}
+
+void RuleSchedule::add(string ruleName, int generations) {
+    entries.push_back(ScheduledRule{ ruleName, generations });
+}
+
+// Splits the text into lines, drops comments and splits lines at semicolons.
+bool RuleSchedule::parse(const string& text) {
+    entries.clear();
+
+    istringstream lines(text);
+    string line;
+    while (getline(lines, line)) {
+        istringstream fields(line.substr(0, line.find('#')));
+        string field;
+        while (getline(fields, field, ';')) {
+            field = trim(field);
+            if (field.empty())
+                continue;
+
+            size_t star = field.rfind('*');
+            string ruleName = trim(field.substr(0, star));
+            int generations = 1;
+            if (star != string::npos) {
+                string count = trim(field.substr(star + 1));
+                if (count.empty() || count.size() > 9 || count.find_first_not_of("0123456789") != string::npos) {
+                    entries.clear();
+                    return false;
+                }
+                generations = stoi(count);
+            }
+
+            if (ruleName.empty() || generations < 1) {
+                entries.clear();
+                return false;
+            }
+            add(ruleName, generations);
+        }
+    }
+
+    return !entries.empty();
+}
+
+bool RuleSchedule::loadFromFile(const string& fileName) {
+    ifstream file(fileName);
+    if (!file) {
+        entries.clear();
+        return false;
+    }
+
+    stringstream text;
+    text << file.rdbuf();
+    return parse(text.str());
+}
+
+long long RuleSchedule::getPeriod() const {
+    long long period = 0;
+    for (const auto& entry : entries)
+        period += entry.generations;
+    return period;
+}
@@ -9,29 +9,29 @@
 #include "GoL_Rules/RuleOfExistence_VonNeumann.h"
 
 // Execute the rule specific for Von Neumann.
-void RuleOfExistence_VonNeumann::executeRule() {
-    for (auto it = cells.begin(); it != cells.end(); it++) {
+void RuleOfExistence_VonNeumann::executeRows(int firstRow, int lastRow) {
+    // Only the world itself is visited, the rim or halo around it is left alone
+    for (int row = firstRow; row < lastRow; row++) {
+        for (int column = 1; column < cells.getColumns() - 1; column++) {
+            int index = row * cells.getColumns() + column;
 
-        // referens current cell
-        Cell& cell = it->second;
+            // referens current cell
+            Cell& cell = cells[index];
 
-        // Ignore cells that is part of the rim
-        if (cell.isRimCell())
-            continue;
+            // get amount of alive neighbouring cells
+            int aliveNeighbours = countAliveNeighbours(index);
 
-        // get amount of alive neighbouring cells
-        int aliveNeighbours = countAliveNeighbours(it->first);
+            // determine action for cell
+            ACTION action = getAction(aliveNeighbours, cell.isAlive());
 
-        // determine action for cell
-        ACTION action = getAction(aliveNeighbours, cell.isAlive());
+            if (action == KILL_CELL)
+                cell.setNextColor(STATE_COLORS.DEAD);
 
-        if (action == KILL_CELL)
-            cell.setNextColor(STATE_COLORS.DEAD);
+            else if (action == GIVE_CELL_LIFE)
+                cell.setNextColor(STATE_COLORS.LIVING);
 
-        else if (action == GIVE_CELL_LIFE)
-            cell.setNextColor(STATE_COLORS.LIVING);
-
-        // the cell will know what to do, based on this action
-        cell.setNextGenerationAction(action);
+            // the cell will know what to do, based on this action
+            cell.setNextGenerationAction(action);
+        }
     }
 }
\ No newline at end of file
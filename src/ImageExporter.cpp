@@ -0,0 +1,287 @@
+/**
+ * @file ImageExporter.cpp
+ * @brief Implementation of ImageExporter, class that writes generations to
+ *  image files.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "ImageExporter.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+    // RGB values of the terminal colors, in the order of the COLOR enum.
+    const uint8_t PALETTE[][3] = {
+        {  0,   0,   0},    // BLACK
+        {205,  49,  49},    // RED
+        { 13, 188, 121},    // GREEN
+        {229, 229,  16},    // YELLOW
+        { 36, 114, 200},    // BLUE
+        {188,  63, 188},    // MAGENTA
+        { 17, 168, 205},    // CYAN
+        {229, 229, 229}     // WHITE
+    };
+
+    // Length codes 257 to 285 of deflate: smallest length and extra bits.
+    const int LENGTH_BASE[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const int LENGTH_EXTRA[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+    // Writes a deflate bit stream, least significant bit first.
+    class BitWriter {
+    private:
+        string& out;
+        uint32_t buffer;
+        int count;
+
+    public:
+        explicit BitWriter(string& out) : out(out), buffer(0), count(0) {}
+
+        void writeBits(uint32_t bits, int length) {
+            buffer |= bits << count;
+            count += length;
+            while (count >= 8) {
+                out += static_cast<char>(buffer & 0xFF);
+                buffer >>= 8;
+                count -= 8;
+            }
+        }
+
+        // Huffman codes are stored most significant bit first.
+        void writeCode(uint32_t code, int length) {
+            uint32_t reversed = 0;
+            for (int i = 0; i < length; i++)
+                reversed |= ((code >> i) & 1) << (length - 1 - i);
+            writeBits(reversed, length);
+        }
+
+        void writeLiteral(int literal) {
+            if (literal < 144)
+                writeCode(0x30 + literal, 8);
+            else
+                writeCode(0x190 + literal - 144, 9);
+        }
+
+        void writeSymbol(int symbol) {
+            if (symbol < 280)
+                writeCode(symbol - 256, 7);
+            else
+                writeCode(0xC0 + symbol - 280, 8);
+        }
+
+        // A match of length bytes at distance one, i.e. a run of the last byte.
+        void writeRun(int length) {
+            int index = 28;
+            while (LENGTH_BASE[index] > length)
+                index--;
+            writeSymbol(257 + index);
+            writeBits(length - LENGTH_BASE[index], LENGTH_EXTRA[index]);
+            writeCode(0, 5);
+        }
+
+        void flush() {
+            if (count > 0)
+                out += static_cast<char>(buffer & 0xFF);
+            buffer = 0;
+            count = 0;
+        }
+    };
+
+    // zlib stream of a single fixed Huffman block, runs of bytes as matches.
+    string compress(const string& data) {
+        string out("\x78\x01", 2);
+        BitWriter writer(out);
+        writer.writeBits(1, 1);     // last block
+        writer.writeBits(1, 2);     // fixed Huffman codes
+
+        size_t i = 0;
+        while (i < data.size()) {
+            if (i > 0) {
+                size_t run = 0;
+                while (run < 258 && i + run < data.size() && data[i + run] == data[i - 1])
+                    run++;
+                if (run >= 3) {
+                    writer.writeRun(static_cast<int>(run));
+                    i += run;
+                    continue;
+                }
+            }
+            writer.writeLiteral(static_cast<uint8_t>(data[i]));
+            i++;
+        }
+        writer.writeSymbol(256);    // end of block
+        writer.flush();
+
+        uint32_t a = 1, b = 0;
+        for (char byte : data) {
+            a = (a + static_cast<uint8_t>(byte)) % 65521;
+            b = (b + a) % 65521;
+        }
+        uint32_t adler = (b << 16) | a;
+        for (int shift = 24; shift >= 0; shift -= 8)
+            out += static_cast<char>((adler >> shift) & 0xFF);
+        return out;
+    }
+
+    uint32_t crc32(const string& data) {
+        static const vector<uint32_t> table = [] {
+            vector<uint32_t> entries(256);
+            for (uint32_t n = 0; n < 256; n++) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                entries[n] = c;
+            }
+            return entries;
+        }();
+
+        uint32_t crc = 0xFFFFFFFFu;
+        for (char byte : data)
+            crc = table[(crc ^ static_cast<uint8_t>(byte)) & 0xFF] ^ (crc >> 8);
+        return crc ^ 0xFFFFFFFFu;
+    }
+
+    void appendUint32(string& out, uint32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8)
+            out += static_cast<char>((value >> shift) & 0xFF);
+    }
+
+    void appendChunk(string& png, const string& type, const string& data) {
+        appendUint32(png, static_cast<uint32_t>(data.size()));
+        png += type;
+        png += data;
+        appendUint32(png, crc32(type + data));
+    }
+}
+
+// Starts the workers, which wait for frames.
+ImageExporter::ImageExporter(string prefix, IMAGE_FORMAT format, int scale, int interval, size_t queueCapacity,
+                             unsigned workerCount)
+        : prefix(prefix), format(format), scale(max(scale, 1)), interval(max(interval, 1)), frames(queueCapacity),
+          failedFrames(0), finished(false) {
+    for (unsigned i = 0; i < max(workerCount, 1u); i++)
+        workers.emplace_back(&ImageExporter::workerLoop, this);
+}
+
+ImageExporter::~ImageExporter() {
+    finish();
+}
+
+// Closes the queue, the workers write what is left before they return.
+void ImageExporter::finish() {
+    if (finished)
+        return;
+    finished = true;
+
+    frames.close();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+// Copies the colors of the world, the rim or halo is left out.
+void ImageExporter::exportFrame(Population& population, int generation) {
+    if (finished || generation % interval != 0)
+        return;
+
+    CellGrid& cells = population.getCells();
+    Frame frame{generation, cells.getColumns() - 2, cells.getRows() - 2, {}};
+    frame.colors.resize(frame.width * frame.height);
+
+    for (int row = 0; row < frame.height; row++) {
+        int rowStart = (row + 1) * cells.getColumns() + 1;
+        for (int column = 0; column < frame.width; column++)
+            frame.colors[row * frame.width + column] = static_cast<uint8_t>(cells[rowStart + column].getColor());
+    }
+
+    frames.push(move(frame));
+}
+
+void ImageExporter::workerLoop() {
+    Frame frame;
+    while (frames.pop(frame)) {
+        if (!writeFrame(frame))
+            failedFrames++;
+    }
+}
+
+// Every cell becomes scale x scale pixels of its color.
+bool ImageExporter::writeFrame(const Frame& frame) {
+    int width = frame.width * scale;
+    int height = frame.height * scale;
+    vector<uint8_t> pixels(width * height * 3);
+
+    for (int row = 0; row < frame.height; row++) {
+        uint8_t* firstLine = pixels.data() + row * scale * width * 3;
+        for (int column = 0; column < frame.width; column++) {
+            uint8_t rgb[3];
+            getRGB(static_cast<COLOR>(frame.colors[row * frame.width + column]), rgb);
+            for (int x = 0; x < scale; x++)
+                copy(rgb, rgb + 3, firstLine + (column * scale + x) * 3);
+        }
+        for (int y = 1; y < scale; y++)
+            copy(firstLine, firstLine + width * 3, firstLine + y * width * 3);
+    }
+
+    string image = (format == PNG) ? encodePNG(pixels, width, height) : encodePPM(pixels, width, height);
+
+    ofstream file(getFileName(frame.generation), ios::binary);
+    file.write(image.data(), image.size());
+    return static_cast<bool>(file);
+}
+
+// prefix, generation with six digits and extension.
+string ImageExporter::getFileName(int generation) const {
+    ostringstream name;
+    name << prefix << setw(6) << setfill('0') << generation << (format == PNG ? ".png" : ".ppm");
+    return name.str();
+}
+
+void ImageExporter::getRGB(COLOR color, uint8_t rgb[3]) {
+    int index = (color >= BLACK && color <= WHITE) ? color : BLACK;
+    copy(PALETTE[index], PALETTE[index] + 3, rgb);
+}
+
+// Header followed by the raw pixels.
+string ImageExporter::encodePPM(const vector<uint8_t>& pixels, int width, int height) {
+    string image = "P6\n" + to_string(width) + " " + to_string(height) + "\n255\n";
+    image.append(pixels.begin(), pixels.end());
+    return image;
+}
+
+// Signature, header, compressed rows and end marker.
+string ImageExporter::encodePNG(const vector<uint8_t>& pixels, int width, int height) {
+    string header;
+    appendUint32(header, width);
+    appendUint32(header, height);
+    header += string("\x08\x02\x00\x00\x00", 5);   // 8 bits RGB, no interlace
+
+    // Rows repeating the previous one, as scaled cells do, use the Up filter
+    // and become all zeros. Others use the Sub filter, each byte minus the
+    // same byte of the previous pixel.
+    int stride = width * 3;
+    string rows;
+    rows.reserve((stride + 1) * height);
+    for (int y = 0; y < height; y++) {
+        const uint8_t* line = pixels.data() + y * stride;
+        if (y > 0 && equal(line, line + stride, line - stride)) {
+            rows += '\x02';
+            rows.append(stride, '\0');
+            continue;
+        }
+
+        rows += '\x01';
+        for (int x = 0; x < stride; x++)
+            rows += static_cast<char>(x < 3 ? line[x] : static_cast<uint8_t>(line[x] - line[x - 3]));
+    }
+
+    string png("\x89PNG\r\n\x1a\n", 8);
+    appendChunk(png, "IHDR", header);
+    appendChunk(png, "IDAT", compress(rows));
+    appendChunk(png, "IEND", "");
+    return png;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file RunCache.cpp
+ * @brief Implementation of RunCache, boards of finished simulations kept on
+ *  disk by the content of the run.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Library/RunCache.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+    const char RUN_CACHE_MAGIC[9] = "GOLCACHE";
+    const uint32_t RUN_CACHE_VERSION = 1;
+    const size_t BLOCK_SIZE = 64;
+
+    /**
+     * @brief Start of a cache entry, followed by the rule schedule.
+     */
+    struct EntryHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t topology;
+        uint64_t rulesLength;
+    };
+
+    /**
+     * @brief Fields of a LiveViewSlot, with a plain sequence as nothing
+     *  writes an entry in place.
+     */
+    struct EntrySlot {
+        uint64_t sequence;
+        uint64_t generation;
+        uint32_t width;
+        uint32_t height;
+        uint64_t wordsPerRow;
+        uint64_t livingCells;
+    };
+
+    // Tells the temporary files of concurrent writers apart.
+    atomic<uint64_t> temporaryFiles(0);
+
+    size_t alignToBlock(size_t size) { return (size + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1); }
+
+    // Every entry written out, the same for equal schedules however written:
+    // neighbouring entries of one rule are joined, and a schedule of a single
+    // rule is that rule once.
+    string getScheduleText(const RuleSchedule& ruleSchedule) {
+        vector<ScheduledRule> entries;
+        for (const ScheduledRule& entry : ruleSchedule.getEntries()) {
+            if (!entries.empty() && entries.back().ruleName == entry.ruleName)
+                entries.back().generations += max(entry.generations, 1);
+            else
+                entries.push_back(ScheduledRule{entry.ruleName, max(entry.generations, 1)});
+        }
+        if (entries.size() == 1)
+            entries.front().generations = 1;
+
+        string text;
+        for (const ScheduledRule& entry : entries)
+            text += entry.ruleName + "*" + to_string(entry.generations) + ";";
+        return text;
+    }
+
+    void hashBytes(uint64_t& hash, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    // Reads an entry, checking that it belongs to the run.
+    bool readEntry(const string& path, Dimensions worldSize, TOPOLOGY topology, const string& rules,
+                   CachedBoard& entry) {
+        ifstream file(path, ios::binary);
+        EntryHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+            || memcmp(header.magic, RUN_CACHE_MAGIC, sizeof(header.magic)) != 0
+            || header.version != RUN_CACHE_VERSION || header.topology != static_cast<uint32_t>(topology)
+            || header.rulesLength != rules.size())
+            return false;
+
+        string storedRules(rules.size(), '\0');
+        file.seekg(BLOCK_SIZE);
+        if (!file.read(&storedRules[0], storedRules.size()) || storedRules != rules)
+            return false;
+
+        EntrySlot slot;
+        size_t slotOffset = BLOCK_SIZE + alignToBlock(rules.size());
+        file.seekg(slotOffset);
+        if (!file.read(reinterpret_cast<char*>(&slot), sizeof(slot))
+            || static_cast<int>(slot.width) != worldSize.WIDTH || static_cast<int>(slot.height) != worldSize.HEIGHT
+            || slot.wordsPerRow != static_cast<uint64_t>((worldSize.WIDTH + 63) / 64))
+            return false;
+
+        entry.generation = slot.generation;
+        entry.worldSize = worldSize;
+        entry.wordsPerRow = slot.wordsPerRow;
+        entry.livingCells = slot.livingCells;
+        entry.board.resize(slot.wordsPerRow * slot.height);
+        file.seekg(slotOffset + BLOCK_SIZE);
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(entry.board.data()),
+                                           entry.board.size() * sizeof(uint64_t)));
+    }
+}
+
+// FNV-1a over the size, topology, rules and board.
+string RunCache::getRunKey(const vector<uint64_t>& board, Dimensions worldSize, TOPOLOGY topology,
+                           const RuleSchedule& ruleSchedule) {
+    uint64_t hash = 14695981039346656037ULL;
+    int32_t fields[3] = {worldSize.WIDTH, worldSize.HEIGHT, static_cast<int32_t>(topology)};
+    hashBytes(hash, fields, sizeof(fields));
+    string rules = getScheduleText(ruleSchedule);
+    hashBytes(hash, rules.data(), rules.size());
+    hashBytes(hash, board.data(), board.size() * sizeof(uint64_t));
+
+    char key[17];
+    snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+    return key;
+}
+
+bool RunCache::store(const string& runKey, TOPOLOGY topology, const RuleSchedule& ruleSchedule,
+                     const CachedBoard& entry) {
+    string runDirectory = directory + "/" + runKey;
+    if ((mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST)
+        || (mkdir(runDirectory.c_str(), 0755) != 0 && errno != EEXIST))
+        return false;
+
+    // header, rules and slot each start a block, the board starts the block after the slot
+    string rules = getScheduleText(ruleSchedule);
+    size_t slotOffset = BLOCK_SIZE + alignToBlock(rules.size());
+    vector<char> bytes(slotOffset + BLOCK_SIZE + entry.board.size() * sizeof(uint64_t), 0);
+
+    EntryHeader header;
+    memcpy(header.magic, RUN_CACHE_MAGIC, sizeof(header.magic));
+    header.version = RUN_CACHE_VERSION;
+    header.topology = static_cast<uint32_t>(topology);
+    header.rulesLength = rules.size();
+    memcpy(bytes.data(), &header, sizeof(header));
+    memcpy(bytes.data() + BLOCK_SIZE, rules.data(), rules.size());
+
+    EntrySlot slot{0, entry.generation, static_cast<uint32_t>(entry.worldSize.WIDTH),
+                   static_cast<uint32_t>(entry.worldSize.HEIGHT), entry.wordsPerRow, entry.livingCells};
+    memcpy(bytes.data() + slotOffset, &slot, sizeof(slot));
+    memcpy(bytes.data() + slotOffset + BLOCK_SIZE, entry.board.data(), entry.board.size() * sizeof(uint64_t));
+
+    string path = runDirectory + "/" + to_string(entry.generation) + ".gol";
+    string temporary = path + "." + to_string(getpid()) + "." + to_string(temporaryFiles++) + ".tmp";
+    {
+        ofstream file(temporary, ios::binary);
+        if (!file.write(bytes.data(), bytes.size()) || !file.flush()) {
+            unlink(temporary.c_str());
+            return false;
+        }
+    }
+    if (rename(temporary.c_str(), path.c_str()) != 0) {
+        unlink(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+// The file names give the generations, only the latest in range is read.
+bool RunCache::findLatest(const string& runKey, Dimensions worldSize, TOPOLOGY topology,
+                          const RuleSchedule& ruleSchedule, uint64_t first, uint64_t last,
+                          CachedBoard& entry) const {
+    string runDirectory = directory + "/" + runKey;
+    DIR* run = opendir(runDirectory.c_str());
+    if (!run)
+        return false;
+
+    vector<uint64_t> generations;
+    while (dirent* file = readdir(run)) {
+        string name = file->d_name;
+        size_t digits = name.find_first_not_of("0123456789");
+        if (digits == 0 || digits > 19 || digits == string::npos || name.substr(digits) != ".gol")
+            continue;
+        uint64_t generation = stoull(name.substr(0, digits));
+        if (generation >= first && generation <= last)
+            generations.push_back(generation);
+    }
+    closedir(run);
+
+    // a damaged or foreign entry is passed over for the next older one
+    sort(generations.rbegin(), generations.rend());
+    string rules = getScheduleText(ruleSchedule);
+    for (uint64_t generation : generations) {
+        if (readEntry(runDirectory + "/" + to_string(generation) + ".gol", worldSize, topology, rules, entry)
+            && entry.generation == generation)
+            return true;
+    }
+    return false;
+}
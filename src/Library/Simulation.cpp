@@ -0,0 +1,122 @@
+/**
+ * @file Simulation.cpp
+ * @brief Implementation of Simulation, the C++ side of libgameoflife.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Library/Simulation.h"
+#include <algorithm>
+#include <stdexcept>
+
+Simulation::Simulation(const PopulationConfig& config, const RuleSchedule& ruleSchedule)
+        : population(config), ruleSchedule(ruleSchedule), generation(0), cache(nullptr), cacheInterval(0) {
+    if (config.fileName.empty() && (config.worldSize.WIDTH < 1 || config.worldSize.HEIGHT < 1))
+        throw invalid_argument("empty world");
+    if (ruleSchedule.empty())
+        throw invalid_argument("no rules");
+
+    population.initiatePopulation(ruleSchedule);
+}
+
+void Simulation::step(int generations) {
+    // the run is keyed by its first board
+    if (cache && generations > 0 && (generation == 0 || !runKey.empty()) && population.canResume()) {
+        stepCached(generations);
+        return;
+    }
+
+    for (int i = 0; i < generations; i++)
+        population.calculateNewGeneration();
+    generation += max(generations, 0);
+}
+
+// Jumps to the latest stored generation up to the target, then simulates the
+// rest, storing the generations on the way.
+void Simulation::stepCached(int generations) {
+    uint64_t target = generation + generations;
+    Dimensions worldSize = getWorldSize();
+    TOPOLOGY topology = population.getTopology();
+    vector<uint64_t> board;
+
+    if (runKey.empty()) {
+        readBoard(board);
+        runKey = RunCache::getRunKey(board, worldSize, topology, ruleSchedule);
+    }
+
+    CachedBoard entry;
+    if (cache->findLatest(runKey, worldSize, topology, ruleSchedule, generation + 1, target, entry)) {
+        population.resume(entry.board.data(), static_cast<int>(entry.wordsPerRow), static_cast<int>(entry.generation));
+        generation = entry.generation;
+    }
+
+    while (generation < target) {
+        uint64_t next = target;
+        if (cacheInterval > 0)
+            next = min(target, (generation / cacheInterval + 1) * cacheInterval);
+        for (; generation < next; generation++)
+            population.calculateNewGeneration();
+
+        entry.generation = generation;
+        entry.worldSize = worldSize;
+        entry.wordsPerRow = (worldSize.WIDTH + 63) / 64;
+        entry.livingCells = readBoard(entry.board);
+        cache->store(runKey, topology, ruleSchedule, entry);
+    }
+}
+
+// Packs the cells with their pending actions, 64 to a word.
+uint64_t Simulation::readBoard(vector<uint64_t>& board) {
+    Dimensions worldSize = getWorldSize();
+    int wordsPerRow = (worldSize.WIDTH + 63) / 64;
+    board.assign(static_cast<size_t>(wordsPerRow) * worldSize.HEIGHT, 0);
+
+    CellGrid& grid = population.getCells();
+    int columns = grid.getColumns();
+    uint64_t livingCells = 0;
+    for (int row = 0; row < worldSize.HEIGHT; row++) {
+        Cell* cell = &grid[(row + 1) * columns + 1];
+        uint64_t* words = &board[static_cast<size_t>(row) * wordsPerRow];
+        for (int column = 0; column < worldSize.WIDTH; column++, cell++) {
+            if (cell->isAliveAfterUpdate()) {
+                words[column / 64] |= 1ULL << (column % 64);
+                livingCells++;
+            }
+        }
+    }
+    return livingCells;
+}
+
+bool Simulation::isAlive(int column, int row) {
+    return population.getCellAtPosition(Point{column + 1, row + 1}).isAliveAfterUpdate();
+}
+
+// Reads the cells row by row straight from the grid, skipping the rim.
+bool Simulation::readRegion(int column, int row, int width, int height, uint8_t* cells) {
+    Dimensions worldSize = getWorldSize();
+    if (column < 0 || row < 0 || width < 0 || height < 0
+        || width > worldSize.WIDTH - column || height > worldSize.HEIGHT - row)
+        return false;
+
+    CellGrid& grid = population.getCells();
+    int columns = grid.getColumns();
+    for (int y = 0; y < height; y++) {
+        Cell* cell = &grid[(row + y + 1) * columns + column + 1];
+        for (int x = 0; x < width; x++, cell++)
+            *cells++ = cell->isAliveAfterUpdate();
+    }
+    return true;
+}
+
+uint64_t Simulation::countLivingCells() {
+    Dimensions worldSize = getWorldSize();
+    CellGrid& grid = population.getCells();
+    int columns = grid.getColumns();
+    uint64_t livingCells = 0;
+    for (int row = 1; row <= worldSize.HEIGHT; row++) {
+        Cell* cell = &grid[row * columns + 1];
+        for (int column = 0; column < worldSize.WIDTH; column++, cell++)
+            livingCells += cell->isAliveAfterUpdate();
+    }
+    return livingCells;
+}
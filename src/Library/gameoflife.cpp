@@ -0,0 +1,151 @@
+/**
+ * @file gameoflife.cpp
+ * @brief Implementation of the C interface of libgameoflife.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Library/gameoflife.h"
+#include <ios>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include "GoL_Rules/RuleFactory.h"
+#include "Library/Simulation.h"
+
+struct gol_simulation {
+    Simulation simulation;
+    unique_ptr<RunCache> cache;
+
+    gol_simulation(const PopulationConfig& config, const RuleSchedule& ruleSchedule)
+            : simulation(config, ruleSchedule) {}
+};
+
+namespace {
+
+    // Creates a simulation, turning what it throws into a status as no
+    // exception may cross the interface.
+    int32_t createSimulation(const char* rules, const PopulationConfig& config, gol_simulation** simulation) {
+        if (!simulation)
+            return GOL_ERROR_ARGUMENT;
+        *simulation = nullptr;
+
+        // a misspelt rule would run as Conway's rule, a bad map or lookup throw
+        RuleSchedule ruleSchedule;
+        if (!ruleSchedule.parse(rules ? rules : "conway"))
+            return GOL_ERROR_RULES;
+        for (const ScheduledRule& entry : ruleSchedule.getEntries()) {
+            if (!RuleFactory::getInstance().canCreateRule(entry.ruleName))
+                return GOL_ERROR_RULES;
+        }
+
+        try {
+            *simulation = new gol_simulation(config, ruleSchedule);
+            return GOL_OK;
+        }
+        catch (invalid_argument&) {
+            return GOL_ERROR_ARGUMENT;
+        }
+        catch (ios_base::failure&) {
+            return GOL_ERROR_FILE;
+        }
+        catch (...) {
+            return GOL_ERROR_INTERNAL;
+        }
+    }
+}
+
+int32_t gol_api_version(void) {
+    return GOL_API_VERSION;
+}
+
+const char* gol_status_message(int32_t status) {
+    switch (status) {
+        case GOL_OK:
+            return "ok";
+        case GOL_ERROR_ARGUMENT:
+            return "invalid argument";
+        case GOL_ERROR_RULES:
+            return "invalid rule schedule";
+        case GOL_ERROR_FILE:
+            return "population file could not be read";
+        case GOL_ERROR_INTERNAL:
+            return "internal error";
+        default:
+            return "unknown status";
+    }
+}
+
+int32_t gol_create(const char* rules, int32_t width, int32_t height, uint64_t seed, double density, int32_t torus,
+                   gol_simulation** simulation) {
+    PopulationConfig config;
+    config.worldSize = {width, height};
+    config.seed = seed;
+    config.density = density;
+    config.topology = torus ? TORUS : BOUNDED;
+    return createSimulation(rules, config, simulation);
+}
+
+int32_t gol_load(const char* rules, const char* file_name, int32_t torus, gol_simulation** simulation) {
+    if (!file_name || !*file_name) {
+        if (simulation)
+            *simulation = nullptr;
+        return GOL_ERROR_ARGUMENT;
+    }
+
+    PopulationConfig config;
+    config.fileName = file_name;
+    config.topology = torus ? TORUS : BOUNDED;
+    return createSimulation(rules, config, simulation);
+}
+
+int32_t gol_step(gol_simulation* simulation, int32_t generations) {
+    if (!simulation || generations < 0)
+        return GOL_ERROR_ARGUMENT;
+
+    try {
+        simulation->simulation.step(generations);
+        return GOL_OK;
+    }
+    catch (...) {
+        return GOL_ERROR_INTERNAL;
+    }
+}
+
+int32_t gol_set_cache(gol_simulation* simulation, const char* directory, uint64_t interval) {
+    if (!simulation || (directory && !*directory))
+        return GOL_ERROR_ARGUMENT;
+
+    try {
+        simulation->simulation.setCache(nullptr);
+        simulation->cache.reset(directory ? new RunCache(directory) : nullptr);
+        simulation->simulation.setCache(simulation->cache.get(), interval);
+        return GOL_OK;
+    }
+    catch (...) {
+        return GOL_ERROR_INTERNAL;
+    }
+}
+
+int32_t gol_query_region(gol_simulation* simulation, int32_t x, int32_t y, int32_t width, int32_t height,
+                         uint8_t* cells) {
+    if (!simulation || (!cells && width > 0 && height > 0))
+        return GOL_ERROR_ARGUMENT;
+    return simulation->simulation.readRegion(x, y, width, height, cells) ? GOL_OK : GOL_ERROR_ARGUMENT;
+}
+
+int32_t gol_get_stats(gol_simulation* simulation, gol_stats* stats) {
+    if (!simulation || !stats)
+        return GOL_ERROR_ARGUMENT;
+
+    Dimensions worldSize = simulation->simulation.getWorldSize();
+    stats->generation = simulation->simulation.getGeneration();
+    stats->living_cells = simulation->simulation.countLivingCells();
+    stats->width = worldSize.WIDTH;
+    stats->height = worldSize.HEIGHT;
+    return GOL_OK;
+}
+
+void gol_destroy(gol_simulation* simulation) {
+    delete simulation;
+}
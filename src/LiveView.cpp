@@ -0,0 +1,164 @@
+/**
+ * @file LiveView.cpp
+ * @brief Implementation of LiveView and LiveViewReader, the board in shared
+ *  memory.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "LiveView.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Cell_Culture/BitBoard.h"
+
+namespace {
+
+    const char LIVE_VIEW_MAGIC[8] = "GOLVIEW";
+    const uint32_t LIVE_VIEW_VERSION = 1;
+    const uint64_t NO_SLOT = ~0ull;
+
+    // Slots and boards start on their own cache lines.
+    size_t alignToCacheLine(size_t size) { return (size + 63) & ~static_cast<size_t>(63); }
+
+    size_t getHeaderSize() { return alignToCacheLine(sizeof(LiveViewHeader)); }
+    size_t getBoardOffset() { return alignToCacheLine(sizeof(LiveViewSlot)); }
+}
+
+LiveView::LiveView(string name, Dimensions worldSize)
+        : name(name), width(max(worldSize.WIDTH, 0)), height(max(worldSize.HEIGHT, 0)),
+          wordsPerRow((width + 63) / 64), segment(nullptr) {
+    uint64_t boardWords = wordsPerRow * height;
+    size_t slotSize = getBoardOffset() + alignToCacheLine(boardWords * sizeof(uint64_t));
+    segmentSize = getHeaderSize() + LIVE_VIEW_SLOTS * slotSize;
+
+    shm_unlink(name.c_str());
+    int file = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (file < 0)
+        return;
+    if (ftruncate(file, segmentSize) == 0) {
+        void* mapped = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (mapped != MAP_FAILED)
+            segment = static_cast<char*>(mapped);
+    }
+    close(file);
+    if (!segment) {
+        shm_unlink(name.c_str());
+        return;
+    }
+
+    // the segment starts out zeroed, only what is not zero is filled in
+    LiveViewHeader* header = getHeader();
+    memcpy(header->magic, LIVE_VIEW_MAGIC, sizeof(header->magic));
+    header->version = LIVE_VIEW_VERSION;
+    header->slotCount = LIVE_VIEW_SLOTS;
+    header->slotSize = slotSize;
+    header->boardWords = boardWords;
+    header->latest.store(NO_SLOT, memory_order_release);
+}
+
+LiveView::~LiveView() {
+    if (segment) {
+        munmap(segment, segmentSize);
+        shm_unlink(name.c_str());
+    }
+}
+
+LiveViewSlot* LiveView::getSlot(int slot) {
+    return reinterpret_cast<LiveViewSlot*>(segment + getHeaderSize() + slot * getHeader()->slotSize);
+}
+
+// Writes the slot readers are not directed to and then directs them to it.
+void LiveView::publish(Population& population, int generation) {
+    if (!segment)
+        return;
+
+    LiveViewHeader* header = getHeader();
+    uint64_t latest = header->latest.load(memory_order_relaxed);
+    int slotIndex = (latest == NO_SLOT) ? 0 : static_cast<int>((latest + 1) % LIVE_VIEW_SLOTS);
+    LiveViewSlot* slot = getSlot(slotIndex);
+    uint64_t* board = reinterpret_cast<uint64_t*>(reinterpret_cast<char*>(slot) + getBoardOffset());
+
+    uint64_t sequence = slot->sequence.load(memory_order_relaxed);
+    slot->sequence.store(sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    // pack the rows straight into the segment, then count the cells
+    population.readRegion(0, 0, width, height, board, static_cast<int>(wordsPerRow));
+    uint64_t livingCells = 0;
+    for (uint64_t word = 0; word < wordsPerRow * height; word++)
+        livingCells += BitBoard::popcount(board[word]);
+
+    slot->generation = generation;
+    slot->width = width;
+    slot->height = height;
+    slot->wordsPerRow = wordsPerRow;
+    slot->livingCells = livingCells;
+
+    slot->sequence.store(sequence + 2, memory_order_release);
+    header->latest.store(slotIndex, memory_order_release);
+}
+
+LiveViewReader::LiveViewReader(string name) : segmentSize(0), segment(nullptr) {
+    int file = shm_open(name.c_str(), O_RDONLY, 0);
+    if (file < 0)
+        return;
+
+    struct stat status;
+    if (fstat(file, &status) == 0 && static_cast<size_t>(status.st_size) >= getHeaderSize()) {
+        segmentSize = status.st_size;
+        void* mapped = mmap(nullptr, segmentSize, PROT_READ, MAP_SHARED, file, 0);
+        if (mapped != MAP_FAILED)
+            segment = static_cast<const char*>(mapped);
+    }
+    close(file);
+
+    // only segments of this layout are read
+    if (segment && (memcmp(getHeader()->magic, LIVE_VIEW_MAGIC, sizeof(LIVE_VIEW_MAGIC)) != 0
+                    || getHeader()->version != LIVE_VIEW_VERSION
+                    || getHeaderSize() + getHeader()->slotCount * getHeader()->slotSize > segmentSize)) {
+        munmap(const_cast<char*>(segment), segmentSize);
+        segment = nullptr;
+    }
+}
+
+LiveViewReader::~LiveViewReader() {
+    if (segment)
+        munmap(const_cast<char*>(segment), segmentSize);
+}
+
+const LiveViewSlot* LiveViewReader::getSlot(int slot) const {
+    return reinterpret_cast<const LiveViewSlot*>(segment + getHeaderSize() + slot * getHeader()->slotSize);
+}
+
+bool LiveViewReader::beginRead(LiveViewSnapshot& snapshot) const {
+    if (!segment)
+        return false;
+
+    uint64_t latest = getHeader()->latest.load(memory_order_acquire);
+    if (latest >= getHeader()->slotCount)
+        return false;
+
+    const LiveViewSlot* slot = getSlot(static_cast<int>(latest));
+    snapshot.sequence = slot->sequence.load(memory_order_acquire);
+    if (snapshot.sequence & 1)
+        return false;
+
+    snapshot.slot = static_cast<int>(latest);
+    snapshot.generation = slot->generation;
+    snapshot.width = slot->width;
+    snapshot.height = slot->height;
+    snapshot.wordsPerRow = slot->wordsPerRow;
+    snapshot.livingCells = slot->livingCells;
+    snapshot.board = reinterpret_cast<const uint64_t*>(reinterpret_cast<const char*>(slot) + getBoardOffset());
+    return true;
+}
+
+// Whatever was read must have been read before the sequence is checked again.
+bool LiveViewReader::endRead(const LiveViewSnapshot& snapshot) const {
+    atomic_thread_fence(memory_order_acquire);
+    return getSlot(snapshot.slot)->sequence.load(memory_order_relaxed) == snapshot.sequence;
+}
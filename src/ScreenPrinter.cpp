@@ -8,6 +8,7 @@
  */
 
 #include "ScreenPrinter.h"
+#include <algorithm>
 #include <iostream>
 
 using namespace std;
@@ -15,37 +16,48 @@ using namespace std;
 // Prints the population to screen
 void ScreenPrinter::printBoard(Population& population) {
 
-    // TODO change to dimension
-    int windowHeight = WORLD_DIMENSIONS.HEIGHT + 1;
-    int windowWidth = WORLD_DIMENSIONS.WIDTH + 1;
-
     terminal.showCursor(false);	// hide cursor
+    Dimensions worldSize = population.getWorldSize();
+
+    if (!viewport.showsCells(worldSize)) {
+        // Zoomed out, one line of glyphs per screen row
+        vector<string> lines = viewport.render(population);
+        for (int row = 0; row < static_cast<int>(lines.size()); row++) {
+            terminal.setCursor(1, row + 1);
+            cout << lines[row];
+        }
+        return;
+    }
+
+    // Only the cells under the viewport, the rim or halo around the world is
+    // not printed
+    Point origin = viewport.getClampedOrigin(worldSize);
+    int windowHeight = min(worldSize.HEIGHT - origin.y, viewport.getScreen().HEIGHT);
+    int windowWidth = min(worldSize.WIDTH - origin.x, viewport.getScreen().WIDTH);
 
-    // Each row
-    for (int row = 0; row <= windowHeight; row++) {
+    // Each row, walked cell after cell from its first cell in the window
+    CellGrid& cells = population.getCells();
+    for (int row = 1; row <= windowHeight; row++) {
+        Cell* rowCells = &cells[(origin.y + row) * cells.getColumns() + origin.x];
         // Each column
-        for (int column = 0; column <= windowWidth; column++) {
+        for (int column = 1; column <= windowWidth; column++) {
             // Get cell att position [column,row]
-            Cell cell = population.getCellAtPosition(Point{column, row});
+            Cell& cell = rowCells[column];
 
             // set cursor to relevant point
             terminal.setCursor(column, row);
 
-            // If cell isn't a rim cell
-            if (!cell.isRimCell()) {
-
-                // Get cell color
-                COLOR cellColor = cell.getColor();
+            // Get cell color
+            COLOR cellColor = cell.getColor();
 
-                // Change terminal color
-                terminal.pushColor(TerminalColor(cellColor, STATE_COLORS.DEAD));
+            // Change terminal color
+            terminal.pushColor(TerminalColor(cellColor, STATE_COLORS.DEAD));
 
-                // Write cell to screen
-                cout << cell.getCellValue();
+            // Write cell to screen
+            cout << cell.getCellValue();
 
-                // Reset color
-                terminal.popColor();
-            }
+            // Reset color
+            terminal.popColor();
         }
     }
 }
@@ -56,15 +68,63 @@ void ScreenPrinter::printHelpScreen() {
          << "-er <Even rulename> [default=conway]" << endl
          << "\tconway" << endl
          << "\tvon_neumann" << endl
-         << "\terik" << endl << endl
+         << "\terik" << endl
+         << "\tbosco" << endl
+         << "\tR<radius>,C0,M<0|1>,S<min>..<max>,B<min>..<max>,N<M|N>" << endl
+         << "\tbrians_brain" << endl
+         << "\tstar_wars" << endl
+         << "\t<survival>/<birth>/<states>" << endl << endl
          << "-or <Odd rulename> [default=same as even]" << endl
          << "\tconway" << endl
          << "\tvon_neumann" << endl
-         << "\terik" << endl << endl
+         << "\terik" << endl
+         << "\tbosco" << endl
+         << "\tR<radius>,C0,M<0|1>,S<min>..<max>,B<min>..<max>,N<M|N>" << endl
+         << "\tbrians_brain" << endl
+         << "\tstar_wars" << endl
+         << "\t<survival>/<birth>/<states>" << endl << endl
          << "-g <Amount of generations> [default=500]" << endl << endl
          << "-s <World dimensions> [default=80x24]" << endl << endl
          << "-f <Filename for initial state> [default=random state]" << endl
-         << "\tfilename overrides -s argument" << endl;
+         << "\tfilename overrides -s argument" << endl << endl
+         << "--soups <Amount of random soups> [default=0]" << endl
+         << "\tsearches soups of -s size for -g generations each" << endl << endl
+         << "--seed <Seed for random state> [default=current time]" << endl << endl
+         << "--density <Fraction of living cells in random state> [default=0.5]" << endl << endl
+         << "--topology <Edges of the world> [default=bounded]" << endl
+         << "\tbounded" << endl
+         << "\ttorus" << endl << endl
+         << "--engine <How generations are calculated> [default=adaptive]" << endl
+         << "\tgrid" << endl
+         << "\tchunk" << endl
+         << "\tevent" << endl
+         << "\tadaptive" << endl << endl
+         << "--viewport <Screen size in characters> [default=80x24]" << endl << endl
+         << "--zoom <Cells per dot when zoomed out> [default=fit world to screen]" << endl << endl
+         << "--pan <Top left cell shown, as column,row> [default=0,0]" << endl << endl
+         << "--glyphs <Glyphs for the cells> [default=braille]" << endl
+         << "\tcells" << endl
+         << "\thalfblock" << endl
+         << "\tbraille" << endl << endl
+         << "--export <Path image files start with> [default=no images]" << endl << endl
+         << "--export-format <Format of the images> [default=png]" << endl
+         << "\tpng" << endl
+         << "\tppm" << endl << endl
+         << "--export-every <Generations between images> [default=1]" << endl << endl
+         << "--export-scale <Pixels per cell side> [default=1]" << endl << endl
+         << "--schedule <rule*generations;rule*generations...> [default=even;odd]" << endl
+         << "\tapplies each rule for its generations, then starts over" << endl << endl
+         << "--schedule-file <Filename of rule schedule>" << endl << endl
+         << "--rule-map <Filename of rule map>" << endl
+         << "\tapplies the rule of each region of the map, overrides -er and -or" << endl << endl
+         << "--workers <Amount of worker processes> [default=run in this process]" << endl
+         << "\tsplits the world into strips, one per process" << endl << endl
+         << "--checkpoint <Path checkpoint files start with> [default=no checkpoints]" << endl << endl
+         << "--checkpoint-every <Generations between checkpoints> [default=last only]" << endl << endl
+         << "--live-view <Shared memory name, e.g. /gameoflife> [default=not published]" << endl
+         << "\tpublishes every generation for other processes to read" << endl << endl
+         << "--sweep <Filename of sweep spec>" << endl
+         << "\truns every combination of rules, densities and sizes, writes one CSV" << endl;
 }
 
 // print message, som information to the user (i.e. error messages)
@@ -0,0 +1,437 @@
+/**
+ * @file SimulationServer.cpp
+ * @brief Implementation of SimulationServer, running simulation jobs sent
+ *  over a Unix domain socket.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Server/SimulationServer.h"
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <poll.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "Library/Simulation.h"
+#include "Support/WorkStealingPool.h"
+
+namespace {
+
+    const int MAX_WORLD_SIDE = 1 << 16;
+    const int MAX_GENERATIONS = 1 << 24;
+
+    /**
+     * @brief A simulation a worker thread keeps for the next job of the same
+     *  world and rules.
+     */
+    struct WarmSimulation {
+        string key;
+        unique_ptr<Simulation> simulation;
+    };
+
+    // Each worker keeps its most recently used simulations, newest last.
+    const size_t WARM_SIMULATIONS = 4;
+    thread_local vector<WarmSimulation> warmSimulations;
+
+    // Jobs that may share a simulation have the same key.
+    string getWarmKey(const ServerJob& job) {
+        return to_string(job.config.worldSize.WIDTH) + "x" + to_string(job.config.worldSize.HEIGHT)
+               + (job.config.topology == TORUS ? " torus " : " bounded ") + job.rules;
+    }
+
+    // Takes a kept simulation of the job's world out and restarts it, or
+    // creates a new one. Out of the list, no other job on the thread can
+    // restart or drop it while it runs.
+    WarmSimulation takeSimulation(const ServerJob& job) {
+        WarmSimulation warm;
+        warm.key = getWarmKey(job);
+        for (size_t i = 0; i < warmSimulations.size(); i++) {
+            if (warmSimulations[i].key == warm.key) {
+                warm = move(warmSimulations[i]);
+                warmSimulations.erase(warmSimulations.begin() + i);
+                warm.simulation->restart(job.config.seed, job.config.density);
+                return warm;
+            }
+        }
+
+        warm.simulation.reset(new Simulation(job.config, job.ruleSchedule));
+        return warm;
+    }
+
+    // Keeps a simulation as the newest, dropping the oldest if there are too many.
+    void keepSimulation(WarmSimulation warm) {
+        if (warmSimulations.size() == WARM_SIMULATIONS)
+            warmSimulations.erase(warmSimulations.begin());
+        warmSimulations.push_back(move(warm));
+    }
+
+    bool setNonBlocking(int socket) {
+        int flags = fcntl(socket, F_GETFL, 0);
+        return flags >= 0 && fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+
+    // Cell generations of a job, at least one per cell.
+    uint64_t getWork(const ServerJob& job) {
+        return static_cast<uint64_t>(job.config.worldSize.WIDTH) * job.config.worldSize.HEIGHT
+               * max(job.generations, 1);
+    }
+}
+
+SimulationServer::SimulationServer(string socketPath, uint64_t batchWork)
+        : socketPath(socketPath), batchWork(batchWork), listener(-1), wakeRead(-1), wakeWrite(-1), stopping(false),
+          cacheInterval(0), maxCells(DEFAULT_MAX_CELLS), maxWork(DEFAULT_MAX_WORK), runningTasks(0) {}
+
+SimulationServer::~SimulationServer() {
+    closeAll();
+}
+
+void SimulationServer::setCache(const string& directory, uint64_t interval) {
+    cache.reset(new RunCache(directory));
+    cacheInterval = interval;
+}
+
+void SimulationServer::setJobLimits(uint64_t cells, uint64_t work) {
+    maxCells = cells;
+    maxWork = work;
+}
+
+bool SimulationServer::start() {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+        return false;
+    strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    int wake[2];
+    if (pipe(wake) != 0)
+        return false;
+    wakeRead = wake[0];
+    wakeWrite = wake[1];
+    setNonBlocking(wakeRead);
+    setNonBlocking(wakeWrite);
+
+    unlink(socketPath.c_str());
+    listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0 || !setNonBlocking(listener)
+        || bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, 64) != 0) {
+        closeAll();
+        return false;
+    }
+    return true;
+}
+
+void SimulationServer::stop() {
+    stopping = true;
+    if (wakeWrite >= 0) {
+        char wake = 0;
+        ssize_t written = write(wakeWrite, &wake, 1);
+        (void) written;
+    }
+}
+
+// fields are key=value, in any order, after the word run
+bool SimulationServer::parseJob(const string& line, ServerJob& job, string& error, uint64_t maxCells,
+                                uint64_t maxWork) {
+    job.id = "-";
+    istringstream words(line);
+    string command;
+    words >> command;
+    if (command != "run") {
+        error = "unknown request";
+        return false;
+    }
+
+    job.config = PopulationConfig();
+    job.config.seed = static_cast<uint64_t>(time(0));
+    job.rules = "conway";
+    job.generations = 100;
+
+    string field;
+    while (words >> field) {
+        size_t equals = field.find('=');
+        if (equals == string::npos) {
+            error = "malformed field " + field;
+            return false;
+        }
+        string key = field.substr(0, equals);
+        string value = field.substr(equals + 1);
+
+        istringstream valueStream(value);
+        bool good = true;
+        if (key == "id") {
+            job.id = value;
+        }
+        else if (key == "seed") {
+            good = static_cast<bool>(valueStream >> job.config.seed);
+        }
+        else if (key == "generations") {
+            good = (valueStream >> job.generations) && job.generations >= 0 && job.generations <= MAX_GENERATIONS;
+        }
+        else if (key == "size") {
+            char separator = 0;
+            Dimensions& size = job.config.worldSize;
+            good = (valueStream >> size.WIDTH >> separator >> size.HEIGHT) && separator == 'x'
+                   && size.WIDTH > 0 && size.HEIGHT > 0 && size.WIDTH <= MAX_WORLD_SIDE
+                   && size.HEIGHT <= MAX_WORLD_SIDE;
+        }
+        else if (key == "density") {
+            good = (valueStream >> job.config.density) && job.config.density >= 0 && job.config.density <= 1;
+        }
+        else if (key == "topology") {
+            good = value == "bounded" || value == "torus";
+            job.config.topology = (value == "torus") ? TORUS : BOUNDED;
+        }
+        else if (key == "rules") {
+            job.rules = value;
+        }
+        else {
+            error = "unknown field " + key;
+            return false;
+        }
+
+        if (!good || (valueStream.peek() != EOF && key != "id" && key != "rules" && key != "topology")) {
+            error = "bad value for " + key;
+            return false;
+        }
+    }
+
+    if (!job.ruleSchedule.parse(job.rules)) {
+        error = "bad rule schedule";
+        return false;
+    }
+
+    // checked before a worker allocates the world or runs it
+    uint64_t cells = static_cast<uint64_t>(job.config.worldSize.WIDTH) * job.config.worldSize.HEIGHT;
+    if (cells > maxCells || getWork(job) > maxWork) {
+        error = "too large";
+        return false;
+    }
+    return true;
+}
+
+// Complete lines are jobs or quit, a line without its break stays in input.
+bool SimulationServer::readRequests(Connection& connection, const shared_ptr<Connection>& shared,
+                                    vector<QueuedJob>& jobs) {
+    char buffer[4096];
+    bool hungUp = false;
+    while (true) {
+        ssize_t received = recv(connection.socket, buffer, sizeof(buffer), 0);
+        if (received > 0) {
+            connection.input.append(buffer, received);
+            continue;
+        }
+        if (received == 0)
+            hungUp = true;
+        else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            return false;
+        break;
+    }
+
+    size_t lineEnd;
+    while (!connection.inputClosed && (lineEnd = connection.input.find('\n')) != string::npos) {
+        string line = connection.input.substr(0, lineEnd);
+        connection.input.erase(0, lineEnd + 1);
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty())
+            continue;
+        if (line == "quit") {
+            connection.inputClosed = true;
+            break;
+        }
+
+        QueuedJob queued;
+        string error;
+        if (!parseJob(line, queued.job, error, maxCells, maxWork)) {
+            postResult(connection, "error " + queued.job.id + " " + error + "\n", false);
+            continue;
+        }
+        queued.connection = shared;
+        {
+            lock_guard<mutex> guard(connection.outputLock);
+            connection.pendingJobs++;
+        }
+        jobs.push_back(move(queued));
+    }
+
+    if (hungUp)
+        connection.inputClosed = true;
+    return true;
+}
+
+bool SimulationServer::writeResults(Connection& connection) {
+    lock_guard<mutex> guard(connection.outputLock);
+    while (!connection.output.empty()) {
+        ssize_t sent = send(connection.socket, connection.output.data(), connection.output.size(), MSG_NOSIGNAL);
+        if (sent > 0) {
+            connection.output.erase(0, sent);
+            continue;
+        }
+        return sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+    }
+    return true;
+}
+
+void SimulationServer::postResult(Connection& connection, const string& line, bool jobFinished) {
+    {
+        lock_guard<mutex> guard(connection.outputLock);
+        connection.output += line;
+        if (jobFinished)
+            connection.pendingJobs--;
+    }
+    char wake = 0;
+    ssize_t written = write(wakeWrite, &wake, 1);
+    (void) written;
+}
+
+void SimulationServer::runJob(QueuedJob& queued) {
+    ostringstream line;
+    try {
+        WarmSimulation warm = takeSimulation(queued.job);
+        Simulation& simulation = *warm.simulation;
+        simulation.setCache(cache.get(), cacheInterval);
+        simulation.step(queued.job.generations);
+        line << "done " << queued.job.id << " generation=" << simulation.getGeneration()
+             << " living=" << simulation.countLivingCells() << "\n";
+        keepSimulation(move(warm));
+    }
+    catch (...) {
+        line << "error " << queued.job.id << " simulation failed\n";
+    }
+    postResult(*queued.connection, line.str(), true);
+}
+
+// Small jobs fill batches up to batchWork, each batch and large job is a task.
+void SimulationServer::dispatch(vector<QueuedJob>& jobs) {
+    WorkStealingPool& pool = WorkStealingPool::getInstance();
+    shared_ptr<vector<QueuedJob>> batch = make_shared<vector<QueuedJob>>();
+    uint64_t work = 0;
+
+    auto submitBatch = [&]() {
+        runningTasks++;
+        pool.submit([this, batch]() {
+            for (QueuedJob& queued : *batch)
+                runJob(queued);
+            runningTasks--;
+        });
+        batch = make_shared<vector<QueuedJob>>();
+        work = 0;
+    };
+
+    for (QueuedJob& queued : jobs) {
+        uint64_t jobWork = getWork(queued.job);
+        if (jobWork >= batchWork) {
+            shared_ptr<QueuedJob> single = make_shared<QueuedJob>(move(queued));
+            runningTasks++;
+            pool.submit([this, single]() {
+                runJob(*single);
+                runningTasks--;
+            });
+            continue;
+        }
+
+        batch->push_back(move(queued));
+        work += jobWork;
+        if (work >= batchWork)
+            submitBatch();
+    }
+    if (!batch->empty())
+        submitBatch();
+    jobs.clear();
+}
+
+void SimulationServer::run() {
+    vector<QueuedJob> jobs;
+    vector<pollfd> polled;
+
+    while (!stopping) {
+        polled.clear();
+        polled.push_back(pollfd{wakeRead, POLLIN, 0});
+        polled.push_back(pollfd{listener, POLLIN, 0});
+        for (const shared_ptr<Connection>& connection : connections) {
+            // a client that is done sending is only polled while there is output
+            lock_guard<mutex> guard(connection->outputLock);
+            short events = (connection->inputClosed ? 0 : POLLIN) | (connection->output.empty() ? 0 : POLLOUT);
+            polled.push_back(pollfd{events ? connection->socket : -1, events, 0});
+        }
+
+        if (poll(polled.data(), polled.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        // results posted by workers, only the wakeup matters
+        char drained[64];
+        if (polled[0].revents & POLLIN)
+            while (read(wakeRead, drained, sizeof(drained)) > 0) {}
+
+        if (polled[1].revents & POLLIN) {
+            int client;
+            while ((client = accept(listener, nullptr, nullptr)) >= 0) {
+                setNonBlocking(client);
+                shared_ptr<Connection> connection = make_shared<Connection>();
+                connection->socket = client;
+                connection->inputClosed = false;
+                connection->pendingJobs = 0;
+                connections.push_back(connection);
+            }
+        }
+
+        // the connections accepted above were not polled yet
+        size_t polledConnections = polled.size() - 2;
+        for (size_t i = 0; i < connections.size(); i++) {
+            Connection& connection = *connections[i];
+            bool alive = true;
+            if (i < polledConnections && (polled[i + 2].revents & (POLLIN | POLLHUP | POLLERR)))
+                alive = readRequests(connection, connections[i], jobs);
+            alive = alive && writeResults(connection);
+
+            bool finished;
+            {
+                lock_guard<mutex> guard(connection.outputLock);
+                finished = connection.inputClosed && connection.pendingJobs == 0 && connection.output.empty();
+            }
+            if (!alive || finished) {
+                // tasks still running hold the connection, their results go nowhere
+                close(connection.socket);
+                connection.socket = -1;
+                connections.erase(connections.begin() + i);
+                polled.erase(polled.begin() + 2 + i);
+                if (i < polledConnections)
+                    polledConnections--;
+                i--;
+            }
+        }
+
+        dispatch(jobs);
+    }
+
+    // only the tasks of this server, the pool may be running others
+    while (runningTasks > 0)
+        this_thread::yield();
+}
+
+void SimulationServer::closeAll() {
+    for (const shared_ptr<Connection>& connection : connections) {
+        if (connection->socket >= 0)
+            close(connection->socket);
+    }
+    connections.clear();
+
+    if (listener >= 0) {
+        close(listener);
+        unlink(socketPath.c_str());
+        listener = -1;
+    }
+    if (wakeRead >= 0)
+        close(wakeRead);
+    if (wakeWrite >= 0)
+        close(wakeWrite);
+    wakeRead = wakeWrite = -1;
+}
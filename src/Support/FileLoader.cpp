@@ -13,8 +13,8 @@
 #include <iostream>
 #include <Cell_Culture/Population.h>
 
-// Loads the given map with cells read from the file thats pointed to by The global variable fileName
-void FileLoader::loadPopulationFromFile(map<Point, Cell>& cells) {
+// Loads the given grid with cells read from the file thats pointed to by fileName
+void FileLoader::loadPopulationFromFile(const string& fileName, CellGrid& cells, Dimensions& worldSize) {
 
     // Open file for reading, if file cant be found throw an exception that
     // prints a error message and throws back to main(closes application)
@@ -30,31 +30,32 @@ void FileLoader::loadPopulationFromFile(map<Point, Cell>& cells) {
     }
 
 
-    string worldSize;
+    string dimensions;
     // Read dimensions from file
-    getline(inFile, worldSize);
+    getline(inFile, dimensions);
 
     // Load the read dimensions
-    istringstream iss(worldSize);
-    iss >> WORLD_DIMENSIONS.WIDTH;
+    istringstream iss(dimensions);
+    iss >> worldSize.WIDTH;
     iss.get();
-    iss >> WORLD_DIMENSIONS.HEIGHT;
+    iss >> worldSize.HEIGHT;
     iss.clear();
 
+    cells.reset(worldSize.WIDTH + 2, worldSize.HEIGHT + 2);
 
-    for (int row = 0; row <= WORLD_DIMENSIONS.HEIGHT + 1; row++) {
+    for (int row = 0; row <= worldSize.HEIGHT + 1; row++) {
         // Dont read a line from file for rim rows
-        if (!(row == 0 || row == WORLD_DIMENSIONS.HEIGHT + 1)) {
+        if (!(row == 0 || row == worldSize.HEIGHT + 1)) {
             string populationRow;
             getline(inFile, populationRow);
             iss.str(populationRow);
         }
 
-        for (int column = 0; column <= WORLD_DIMENSIONS.WIDTH + 1; column++) {
+        for (int column = 0; column <= worldSize.WIDTH + 1; column++) {
             // if cell is a rim cell
             if (column == 0 || row == 0
-                || column == WORLD_DIMENSIONS.WIDTH + 1
-                || row == WORLD_DIMENSIONS.HEIGHT + 1) {
+                || column == worldSize.WIDTH + 1
+                || row == worldSize.HEIGHT + 1) {
 
                 cells[Point{column, row}] = Cell(true); // create a cell with rimCell state set to true
             }
@@ -72,4 +73,47 @@ void FileLoader::loadPopulationFromFile(map<Point, Cell>& cells) {
         }
     }
     inFile.close();
-}
\ No newline at end of file
+}
+
+// Reads the dimensions, the rule names and a digit per cell of the map.
+void FileLoader::loadRuleMapFromFile(const string& mapFileName, vector<string>& ruleNames, Dimensions& size,
+                                     vector<uint8_t>& ruleIds) {
+    ifstream inFile(mapFileName);
+    if (!inFile.good()) {
+        cout << "Could not find rule map " << mapFileName << ". Closing application." << endl;
+        throw ios_base::failure("");
+    }
+
+    string line;
+    getline(inFile, line);
+    istringstream dimensions(line);
+    size = Dimensions{0, 0};
+    dimensions >> size.WIDTH;
+    dimensions.get();
+    dimensions >> size.HEIGHT;
+
+    getline(inFile, line);
+    istringstream names(line);
+    ruleNames.clear();
+    string ruleName;
+    while (names >> ruleName)
+        ruleNames.push_back(ruleName);
+
+    bool malformed = size.WIDTH < 1 || size.HEIGHT < 1 || ruleNames.empty() || ruleNames.size() > 10;
+    ruleIds.assign(malformed ? 0 : size.WIDTH * size.HEIGHT, 0);
+    for (int row = 0; row < size.HEIGHT && !malformed; row++) {
+        getline(inFile, line);
+        for (int column = 0; column < size.WIDTH && !malformed; column++) {
+            int ruleId = (column < static_cast<int>(line.size())) ? line[column] - '0' : -1;
+            if (ruleId < 0 || ruleId >= static_cast<int>(ruleNames.size()))
+                malformed = true;
+            else
+                ruleIds[row * size.WIDTH + column] = static_cast<uint8_t>(ruleId);
+        }
+    }
+
+    if (malformed) {
+        cout << "Malformed rule map " << mapFileName << ". Closing application." << endl;
+        throw ios_base::failure("");
+    }
+}
@@ -1,12 +0,0 @@
-/**
- * @file Globals.cpp
- * @author Erik Ström
- * @brief Declaration of global variables.
- * @version 0.1
- * @date 2018-10-29
- */
-
-#include "Support/Globals.h"
-
-string fileName;
-Dimensions WORLD_DIMENSIONS = { 80, 24 };
\ No newline at end of file
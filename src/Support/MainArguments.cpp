@@ -29,9 +29,9 @@ void GenerationsArgument::execute(ApplicationValues& appValues, char* generation
 void WorldsizeArgument::execute(ApplicationValues& appValues, char* dimensions) {
     if (dimensions) {
         istringstream iss(dimensions);
-        iss >> WORLD_DIMENSIONS.WIDTH;
+        iss >> appValues.worldSize.WIDTH;
         iss.get();
-        iss >> WORLD_DIMENSIONS.HEIGHT;
+        iss >> appValues.worldSize.HEIGHT;
     }
     else {
         printNoValue();
@@ -41,7 +41,7 @@ void WorldsizeArgument::execute(ApplicationValues& appValues, char* dimensions)
 
 void FileArgument::execute(ApplicationValues& appValues, char* fileNameArg) {
     if (fileNameArg) {
-        fileName = fileNameArg;
+        appValues.fileName = fileNameArg;
     }
     else {
         printNoValue();
@@ -67,4 +67,302 @@ void OddRuleArgument::execute(ApplicationValues& appValues, char* oddRule) {
         printNoValue();
         appValues.runSimulation = false;
     }
-}
\ No newline at end of file
+}
+
+void SoupsArgument::execute(ApplicationValues& appValues, char* soups) {
+    if (!soups) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (!appValues.fileName.empty()) {
+        ScreenPrinter::getInstance().printMessage("--soups can not be combined with -f!");
+        appValues.runSimulation = false;
+    }
+    else {
+        appValues.nrOfSoups = stoi(soups);
+    }
+}
+
+void SeedArgument::execute(ApplicationValues& appValues, char* seed) {
+    if (seed) {
+        appValues.seed = stoull(seed);
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void DensityArgument::execute(ApplicationValues& appValues, char* density) {
+    if (!density) {
+        printNoValue();
+        appValues.runSimulation = false;
+        return;
+    }
+
+    appValues.density = stod(density);
+    if (appValues.density < 0 || appValues.density > 1) {
+        ScreenPrinter::getInstance().printMessage("--density must be between 0 and 1!");
+        appValues.runSimulation = false;
+    }
+}
+
+void TopologyArgument::execute(ApplicationValues& appValues, char* topology) {
+    if (!topology) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (string(topology) == "torus") {
+        appValues.topology = TORUS;
+    }
+    else if (string(topology) == "bounded") {
+        appValues.topology = BOUNDED;
+    }
+    else {
+        ScreenPrinter::getInstance().printMessage("Unknown topology " + string(topology) + "!");
+        appValues.runSimulation = false;
+    }
+}
+
+void ViewportArgument::execute(ApplicationValues& appValues, char* dimensions) {
+    if (dimensions) {
+        Dimensions screen{0, 0};
+        istringstream iss(dimensions);
+        iss >> screen.WIDTH;
+        iss.get();
+        iss >> screen.HEIGHT;
+        ScreenPrinter::getInstance().getViewport().setScreen(screen);
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ZoomArgument::execute(ApplicationValues& appValues, char* zoom) {
+    if (!zoom) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (stoi(zoom) < 1) {
+        ScreenPrinter::getInstance().printMessage("--zoom must be at least 1!");
+        appValues.runSimulation = false;
+    }
+    else {
+        ScreenPrinter::getInstance().getViewport().setZoom(stoi(zoom));
+    }
+}
+
+void PanArgument::execute(ApplicationValues& appValues, char* position) {
+    if (position) {
+        Point origin{0, 0};
+        istringstream iss(position);
+        iss >> origin.x;
+        iss.get();
+        iss >> origin.y;
+        ScreenPrinter::getInstance().getViewport().setOrigin(origin);
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void GlyphsArgument::execute(ApplicationValues& appValues, char* glyphs) {
+    Viewport& viewport = ScreenPrinter::getInstance().getViewport();
+
+    if (!glyphs) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (string(glyphs) == "cells") {
+        viewport.setGlyphs(CELL_CHARACTERS);
+    }
+    else if (string(glyphs) == "halfblock") {
+        viewport.setGlyphs(HALF_BLOCKS);
+    }
+    else if (string(glyphs) == "braille") {
+        viewport.setGlyphs(BRAILLE);
+    }
+    else {
+        ScreenPrinter::getInstance().printMessage("Unknown glyphs " + string(glyphs) + "!");
+        appValues.runSimulation = false;
+    }
+}
+
+void ExportArgument::execute(ApplicationValues& appValues, char* prefix) {
+    if (prefix) {
+        appValues.exportPrefix = prefix;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ExportFormatArgument::execute(ApplicationValues& appValues, char* format) {
+    if (!format) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (string(format) == "png") {
+        appValues.exportFormat = PNG;
+    }
+    else if (string(format) == "ppm") {
+        appValues.exportFormat = PPM;
+    }
+    else {
+        ScreenPrinter::getInstance().printMessage("Unknown image format " + string(format) + "!");
+        appValues.runSimulation = false;
+    }
+}
+
+void ExportIntervalArgument::execute(ApplicationValues& appValues, char* interval) {
+    if (!interval) {
+        printNoValue();
+        appValues.runSimulation = false;
+        return;
+    }
+
+    appValues.exportInterval = stoi(interval);
+    if (appValues.exportInterval < 1) {
+        ScreenPrinter::getInstance().printMessage("--export-every must be at least 1!");
+        appValues.runSimulation = false;
+    }
+}
+
+void ExportScaleArgument::execute(ApplicationValues& appValues, char* scale) {
+    if (!scale) {
+        printNoValue();
+        appValues.runSimulation = false;
+        return;
+    }
+
+    appValues.exportScale = stoi(scale);
+    if (appValues.exportScale < 1) {
+        ScreenPrinter::getInstance().printMessage("--export-scale must be at least 1!");
+        appValues.runSimulation = false;
+    }
+}
+
+void ScheduleArgument::execute(ApplicationValues& appValues, char* schedule) {
+    if (!schedule) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (!appValues.ruleSchedule.parse(schedule)) {
+        ScreenPrinter::getInstance().printMessage("Malformed rule schedule " + string(schedule) + "!");
+        appValues.runSimulation = false;
+    }
+}
+
+void ScheduleFileArgument::execute(ApplicationValues& appValues, char* scheduleFile) {
+    if (!scheduleFile) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (!appValues.ruleSchedule.loadFromFile(scheduleFile)) {
+        ScreenPrinter::getInstance().printMessage("Could not read a rule schedule from " + string(scheduleFile) + "!");
+        appValues.runSimulation = false;
+    }
+}
+
+void RuleMapArgument::execute(ApplicationValues& appValues, char* ruleMap) {
+    if (ruleMap) {
+        appValues.evenRuleName = "map:" + string(ruleMap);
+        appValues.oddRuleName = appValues.evenRuleName;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void WorkersArgument::execute(ApplicationValues& appValues, char* workers) {
+    if (!workers) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (!appValues.fileName.empty()) {
+        ScreenPrinter::getInstance().printMessage("--workers can not be combined with -f!");
+        appValues.runSimulation = false;
+    }
+    else {
+        appValues.nrOfWorkers = stoi(workers);
+        if (appValues.nrOfWorkers < 1) {
+            ScreenPrinter::getInstance().printMessage("--workers must be at least 1!");
+            appValues.runSimulation = false;
+        }
+    }
+}
+
+void CheckpointArgument::execute(ApplicationValues& appValues, char* prefix) {
+    if (prefix) {
+        appValues.checkpointPrefix = prefix;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void CheckpointIntervalArgument::execute(ApplicationValues& appValues, char* interval) {
+    if (!interval) {
+        printNoValue();
+        appValues.runSimulation = false;
+        return;
+    }
+
+    appValues.checkpointInterval = stoi(interval);
+    if (appValues.checkpointInterval < 1) {
+        ScreenPrinter::getInstance().printMessage("--checkpoint-every must be at least 1!");
+        appValues.runSimulation = false;
+    }
+}
+
+void LiveViewArgument::execute(ApplicationValues& appValues, char* name) {
+    if (!name) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (name[0] != '/' || string(name).find('/', 1) != string::npos || string(name).size() < 2) {
+        ScreenPrinter::getInstance().printMessage("--live-view takes a name such as /gameoflife!");
+        appValues.runSimulation = false;
+    }
+    else {
+        appValues.liveViewName = name;
+    }
+}
+
+void SweepArgument::execute(ApplicationValues& appValues, char* sweepFile) {
+    if (sweepFile) {
+        appValues.sweepFile = sweepFile;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void EngineArgument::execute(ApplicationValues& appValues, char* engine) {
+    if (!engine) {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+    else if (string(engine) == "grid") {
+        appValues.engine = GRID_ENGINE;
+    }
+    else if (string(engine) == "chunk") {
+        appValues.engine = CHUNK_ENGINE;
+    }
+    else if (string(engine) == "event") {
+        appValues.engine = EVENT_ENGINE;
+    }
+    else if (string(engine) == "adaptive") {
+        appValues.engine = ADAPTIVE_ENGINE;
+    }
+    else {
+        ScreenPrinter::getInstance().printMessage("Unknown engine " + string(engine) + "!");
+        appValues.runSimulation = false;
+    }
+}
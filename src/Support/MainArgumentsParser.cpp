@@ -12,8 +12,39 @@
 // Arguments provided by the user
 ApplicationValues &MainArgumentsParser::runParser(char *argv[], int length) {
 
-    vector<BaseArgument *> arguments = {new HelpArgument, new GenerationsArgument, new WorldsizeArgument,
-                                        new FileArgument, new EvenRuleArgument, new OddRuleArgument};
+    HelpArgument help;
+    GenerationsArgument generations;
+    WorldsizeArgument worldsize;
+    FileArgument file;
+    EvenRuleArgument evenRule;
+    OddRuleArgument oddRule;
+    RuleMapArgument ruleMap;
+    SoupsArgument soups;
+    SeedArgument seed;
+    DensityArgument density;
+    TopologyArgument topology;
+    EngineArgument engine;
+    ViewportArgument viewport;
+    ZoomArgument zoom;
+    PanArgument pan;
+    GlyphsArgument glyphs;
+    ExportArgument exportPrefix;
+    ExportFormatArgument exportFormat;
+    ExportIntervalArgument exportInterval;
+    ExportScaleArgument exportScale;
+    ScheduleArgument schedule;
+    ScheduleFileArgument scheduleFile;
+    WorkersArgument workers;
+    CheckpointArgument checkpoint;
+    CheckpointIntervalArgument checkpointInterval;
+    LiveViewArgument liveView;
+    SweepArgument sweep;
+
+    BaseArgument* arguments[] = {&help, &generations, &worldsize, &file, &evenRule, &oddRule,
+                                 &ruleMap, &soups, &seed, &density, &topology, &viewport, &zoom, &pan,
+                                 &glyphs, &exportPrefix, &exportFormat, &exportInterval, &exportScale,
+                                 &schedule, &scheduleFile, &workers, &checkpoint, &checkpointInterval,
+                                 &liveView, &sweep, &engine};
 
     for (auto arg : arguments) {
         const string& argValue = arg->getValue();
@@ -34,9 +65,9 @@ ApplicationValues &MainArgumentsParser::runParser(char *argv[], int length) {
     if (appValues.oddRuleName.empty()) {
         appValues.oddRuleName = appValues.evenRuleName;
     }
-
-    for(auto arg : arguments) {
-        delete arg;
+    // without a schedule, alternate between the even and odd rule
+    if (appValues.ruleSchedule.empty()) {
+        appValues.ruleSchedule = RuleSchedule(appValues.evenRuleName, appValues.oddRuleName);
     }
 
     return appValues;
@@ -0,0 +1,47 @@
+/**
+ * @file MonotonicArena.cpp
+ * @brief Implementation of MonotonicArena, an allocator that releases all its
+ *  memory at once.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Support/MonotonicArena.h"
+#include <cstdint>
+#include <cstdlib>
+
+// Bumps the pointer within the current block, or starts a new one.
+void* MonotonicArena::allocate(size_t size, size_t alignment) {
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(next) + alignment - 1) & ~(alignment - 1);
+
+    if (lastBlock == nullptr || aligned + size > reinterpret_cast<uintptr_t>(blockEnd)) {
+        size_t needed = sizeof(Block) + size + alignment;
+        while (nextBlockSize < needed)
+            nextBlockSize *= 2;
+
+        Block* block = static_cast<Block*>(malloc(nextBlockSize));
+        if (block == nullptr)
+            throw bad_alloc();
+
+        block->previous = lastBlock;
+        lastBlock = block;
+        next = reinterpret_cast<char*>(block + 1);
+        blockEnd = reinterpret_cast<char*>(block) + nextBlockSize;
+        nextBlockSize *= 2;
+
+        aligned = (reinterpret_cast<uintptr_t>(next) + alignment - 1) & ~(alignment - 1);
+    }
+
+    next = reinterpret_cast<char*>(aligned + size);
+    return reinterpret_cast<void*>(aligned);
+}
+
+// Frees every block, newest first.
+void MonotonicArena::release() {
+    while (lastBlock != nullptr) {
+        Block* previous = lastBlock->previous;
+        free(lastBlock);
+        lastBlock = previous;
+    }
+    next = blockEnd = nullptr;
+}
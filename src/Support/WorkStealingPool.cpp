@@ -0,0 +1,175 @@
+/**
+ * @file WorkStealingPool.cpp
+ * @brief Implementation of WorkStealingPool, a thread pool where idle workers
+ *  steal queued tasks from busy ones.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Support/WorkStealingPool.h"
+#include <algorithm>
+
+thread_local int WorkStealingPool::workerIndex = -1;
+thread_local WorkStealingPool* WorkStealingPool::workerPool = nullptr;
+
+// Starts the worker threads, each with a queue of its own.
+WorkStealingPool::WorkStealingPool(unsigned threadCount)
+        : stopping(false), queuedTasks(0), unfinishedTasks(0), nextQueue(0) {
+    if (threadCount == 0)
+        threadCount = 1;
+
+    for (unsigned i = 0; i < threadCount; i++)
+        queues.emplace_back(new WorkerQueue);
+
+    for (unsigned i = 0; i < threadCount; i++)
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+// Lets the workers finish what is queued, then joins them.
+WorkStealingPool::~WorkStealingPool() {
+    waitForAll();
+    {
+        lock_guard<mutex> guard(idleLock);
+        stopping = true;
+    }
+    idleCondition.notify_all();
+
+    for (auto& worker : workers)
+        worker.join();
+}
+
+// Process wide pool receiver.
+WorkStealingPool& WorkStealingPool::getInstance() {
+    static WorkStealingPool pool;
+    return pool;
+}
+
+// Queues a task, preferably on the calling worker's own queue.
+void WorkStealingPool::submit(function<void()> task) {
+    unfinishedTasks++;
+
+    int index = (workerPool == this) ? workerIndex : static_cast<int>(nextQueue++ % queues.size());
+    {
+        lock_guard<mutex> guard(queues[index]->lock);
+        queues[index]->tasks.push_back(move(task));
+    }
+    {
+        lock_guard<mutex> guard(idleLock);
+        queuedTasks++;
+    }
+    idleCondition.notify_one();
+}
+
+// Takes the most recently queued task of a worker.
+bool WorkStealingPool::popTask(int index, function<void()>& task) {
+    lock_guard<mutex> guard(queues[index]->lock);
+    if (queues[index]->tasks.empty())
+        return false;
+
+    task = move(queues[index]->tasks.back());
+    queues[index]->tasks.pop_back();
+    return true;
+}
+
+// Takes the oldest task of the first other worker that has any.
+bool WorkStealingPool::stealTask(int thief, function<void()>& task) {
+    int count = queues.size();
+    int start = (thief < 0) ? 0 : thief + 1;
+
+    for (int i = 0; i < count; i++) {
+        int victim = (start + i) % count;
+        if (victim == thief)
+            continue;
+
+        lock_guard<mutex> guard(queues[victim]->lock);
+        if (!queues[victim]->tasks.empty()) {
+            task = move(queues[victim]->tasks.front());
+            queues[victim]->tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+// Runs one task from the own queue, or a stolen one.
+bool WorkStealingPool::runPendingTask() {
+    function<void()> task;
+    int index = (workerPool == this) ? workerIndex : -1;
+
+    if ((index >= 0 && popTask(index, task)) || stealTask(index, task)) {
+        queuedTasks--;
+        task();
+        unfinishedTasks--;
+        return true;
+    }
+    return false;
+}
+
+// Keeps running tasks, sleeps while there are none.
+void WorkStealingPool::workerLoop(int index) {
+    workerIndex = index;
+    workerPool = this;
+
+    while (true) {
+        if (runPendingTask())
+            continue;
+
+        unique_lock<mutex> guard(idleLock);
+        idleCondition.wait(guard, [this] { return queuedTasks > 0 || stopping; });
+        if (stopping && queuedTasks <= 0)
+            return;
+    }
+}
+
+// Helps out until nothing is left to do.
+void WorkStealingPool::waitForAll() {
+    while (unfinishedTasks > 0) {
+        if (!runPendingTask())
+            this_thread::yield();
+    }
+}
+
+// Hands out chunks of the range to the caller and to helper tasks.
+void WorkStealingPool::parallelFor(int begin, int end, int grain, const function<void(int, int)>& body) {
+    if (end <= begin)
+        return;
+
+    grain = max(grain, 1);
+    int chunks = (end - begin + grain - 1) / grain;
+    if (chunks == 1 || workers.size() < 2) {
+        body(begin, end);
+        return;
+    }
+
+    // Shared by the caller and the helpers, helpers that start late find no
+    // chunks left and only touch this state.
+    struct ChunkCounter {
+        atomic<int> next;
+        atomic<int> done;
+    };
+    shared_ptr<ChunkCounter> counter = make_shared<ChunkCounter>();
+    counter->next = 0;
+    counter->done = 0;
+
+    const function<void(int, int)>* work = &body;
+    auto runChunks = [counter, work, begin, end, grain, chunks]() {
+        int chunk;
+        while ((chunk = counter->next++) < chunks) {
+            int chunkBegin = begin + chunk * grain;
+            (*work)(chunkBegin, min(end, chunkBegin + grain));
+            counter->done++;
+        }
+    };
+
+    int helpers = min<int>(chunks - 1, workers.size());
+    for (int i = 0; i < helpers; i++)
+        submit(runChunks);
+
+    runChunks();
+
+    // Chunks taken by helpers may still be running. Every chunk is taken, so
+    // they finish without help, and running other tasks here could start a
+    // task that touches what the caller of parallelFor is in the middle of.
+    while (counter->done < chunks)
+        this_thread::yield();
+}
@@ -0,0 +1,105 @@
+/**
+ * @file Viewport.cpp
+ * @brief Implementation of Viewport, the part of the world shown on screen.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include "Viewport.h"
+#include <algorithm>
+
+namespace {
+
+    // Dots covered by a living block need at least this share of living cells.
+    const int DOT_DENSITY_DIVISOR = 8;
+
+    // The bits of a braille pattern, indexed by dot row and column.
+    const int BRAILLE_DOTS[4][2] = { {0x01, 0x08}, {0x02, 0x10}, {0x04, 0x20}, {0x40, 0x80} };
+
+    // Appends code point U+2800 + dots, the braille pattern with those dots.
+    void appendBraille(string& line, int dots) {
+        line += static_cast<char>(0xE2);
+        line += static_cast<char>(0xA0 | (dots >> 6));
+        line += static_cast<char>(0x80 | (dots & 0x3F));
+    }
+
+    // Appends a space, an upper, a lower or a full block.
+    void appendHalfBlock(string& line, bool upper, bool lower) {
+        if (!upper && !lower) {
+            line += ' ';
+            return;
+        }
+        line += static_cast<char>(0xE2);
+        line += static_cast<char>(0x96);
+        line += static_cast<char>(upper && lower ? 0x88 : (upper ? 0x80 : 0x84));
+    }
+}
+
+// One character per cell if asked for, or if the fitted world fits as is.
+bool Viewport::showsCells(Dimensions world) const {
+    if (glyphs == CELL_CHARACTERS)
+        return zoom <= 1;
+    return zoom == 0 && world.WIDTH <= screen.WIDTH && world.HEIGHT <= screen.HEIGHT;
+}
+
+// The fixed zoom, or the smallest one that makes the world fit.
+int Viewport::getScale(Dimensions world) const {
+    if (zoom > 0)
+        return zoom;
+
+    int dotColumns = max(1, screen.WIDTH * (glyphs == BRAILLE ? 2 : 1));
+    int dotRows = max(1, screen.HEIGHT * (glyphs == BRAILLE ? 4 : 2));
+    return max(1, max((world.WIDTH + dotColumns - 1) / dotColumns, (world.HEIGHT + dotRows - 1) / dotRows));
+}
+
+// Keeps at least one cell of the world in view.
+Point Viewport::getClampedOrigin(Dimensions world) const {
+    return Point{ max(0, min(origin.x, world.WIDTH - 1)), max(0, min(origin.y, world.HEIGHT - 1)) };
+}
+
+// Packs the cells under the viewport, then turns each block into a dot.
+vector<string> Viewport::render(Population& population) {
+    Dimensions world = population.getWorldSize();
+    GLYPHS dotGlyphs = (glyphs == HALF_BLOCKS) ? HALF_BLOCKS : BRAILLE;
+    int dotWidth = (dotGlyphs == BRAILLE) ? 2 : 1;
+    int dotHeight = (dotGlyphs == BRAILLE) ? 4 : 2;
+
+    int scale = getScale(world);
+    Point first = getClampedOrigin(world);
+    int width = min(screen.WIDTH * dotWidth * scale, world.WIDTH - first.x);
+    int height = min(screen.HEIGHT * dotHeight * scale, world.HEIGHT - first.y);
+    board.capture(population, first.x, first.y, width, height);
+
+    int characterWidth = dotWidth * scale;
+    int characterHeight = dotHeight * scale;
+    int columns = (width + characterWidth - 1) / characterWidth;
+    int rows = (height + characterHeight - 1) / characterHeight;
+    int threshold = max(1, scale * scale / DOT_DENSITY_DIVISOR);
+
+    vector<string> lines(rows);
+    for (int row = 0; row < rows; row++) {
+        string& line = lines[row];
+        line.reserve(columns * 3);
+
+        for (int column = 0; column < columns; column++) {
+            int left = column * characterWidth;
+            int top = row * characterHeight;
+
+            if (dotGlyphs == HALF_BLOCKS) {
+                appendHalfBlock(line, board.countBlock(left, top, scale, scale) >= threshold,
+                                board.countBlock(left, top + scale, scale, scale) >= threshold);
+                continue;
+            }
+
+            int dots = 0;
+            for (int dotRow = 0; dotRow < 4; dotRow++) {
+                for (int dotColumn = 0; dotColumn < 2; dotColumn++) {
+                    if (board.countBlock(left + dotColumn * scale, top + dotRow * scale, scale, scale) >= threshold)
+                        dots |= BRAILLE_DOTS[dotRow][dotColumn];
+                }
+            }
+            appendBraille(line, dots);
+        }
+    }
+    return lines;
+}
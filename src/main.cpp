@@ -7,8 +7,13 @@
  */
 
 #include <iostream>
+#include <memory>
 #include "GameOfLife.h"
 #include "Support/MainArgumentsParser.h"
+#include "Experiments/SoupSearch.h"
+#include "Experiments/ParameterSweep.h"
+#include "Experiments/DistributedSimulation.h"
+#include "ImageExporter.h"
 
 #ifdef DEBUG
 #include <memstat.hpp>
@@ -31,11 +36,93 @@ int main(int argc, char* argv[]) {
     MainArgumentsParser parser;
     ApplicationValues appValues = parser.runParser(argv, argc);
 
-    if (appValues.runSimulation) {
+    if (appValues.runSimulation && !appValues.sweepFile.empty()) {
+        // Run every combination of the spec and write their census
+        ScreenPrinter& screenPrinter = ScreenPrinter::getInstance();
+        ParameterSweep sweep;
+        string error;
+        if (!sweep.loadFromFile(appValues.sweepFile, error)) {
+            screenPrinter.printMessage("Could not read the sweep " + appValues.sweepFile + ": " + error + "!");
+        }
+        else {
+            sweep.runSweep();
+            if (sweep.writeCsv())
+                screenPrinter.printMessage(to_string(sweep.getRuns().size()) + " runs written to "
+                                           + sweep.getOutputFile());
+            else
+                screenPrinter.printMessage("Could not write " + sweep.getOutputFile() + "!");
+        }
+    }
+    else if (appValues.runSimulation && appValues.nrOfSoups > 0) {
+        // Search soups and print their census
+        SoupSearch soupSearch(appValues.nrOfSoups, appValues.maxGenerations, appValues.ruleSchedule,
+                              appValues.getPopulationConfig());
+        soupSearch.runSearch();
+
+        ScreenPrinter& screenPrinter = ScreenPrinter::getInstance();
+        screenPrinter.printMessage(to_string(soupSearch.getStabilizedSoups()) + " of " + to_string(appValues.nrOfSoups)
+                                   + " soups stabilized");
+        for (const auto& count : soupSearch.getCensus().getObjectCounts())
+            screenPrinter.printMessage(count.first + " " + to_string(count.second));
+    }
+    else if (appValues.runSimulation && appValues.nrOfWorkers > 0) {
+        // Split the world over worker processes and print how many cells live
+        ScreenPrinter& screenPrinter = ScreenPrinter::getInstance();
+        string rejectedRule;
+        if (!DistributedSimulation::canDistribute(appValues.ruleSchedule, rejectedRule)) {
+            screenPrinter.printMessage("Rule " + rejectedRule + " can not be split over workers!");
+        }
+        else {
+            DistributedSimulation simulation(appValues.nrOfWorkers, appValues.maxGenerations, appValues.worldSize,
+                                             appValues.ruleSchedule, appValues.seed, appValues.density,
+                                             appValues.topology);
+            simulation.setCheckpoints(appValues.checkpointPrefix, appValues.checkpointInterval);
+
+            if (!simulation.run()) {
+                screenPrinter.printMessage("A worker process failed!");
+            }
+            else {
+                for (const DistributedStats& stats : simulation.getStats()) {
+                    if (stats.generation == appValues.maxGenerations || (appValues.checkpointInterval > 0
+                        && stats.generation % appValues.checkpointInterval == 0))
+                        screenPrinter.printMessage("Generation " + to_string(stats.generation) + ": "
+                                                   + to_string(stats.livingCells) + " living cells");
+                }
+            }
+        }
+    }
+    else if (appValues.runSimulation) {
         // Start simulation
         try {
-            GameOfLife gameOfLife = GameOfLife(appValues.maxGenerations, appValues.evenRuleName, appValues.oddRuleName);
+            GameOfLife gameOfLife(appValues.maxGenerations, appValues.ruleSchedule, appValues.getPopulationConfig());
+
+            // Write the generations to image files as well
+            unique_ptr<ImageExporter> imageExporter;
+            if (!appValues.exportPrefix.empty()) {
+                imageExporter.reset(new ImageExporter(appValues.exportPrefix, appValues.exportFormat,
+                                                      appValues.exportScale, appValues.exportInterval));
+                gameOfLife.setImageExporter(imageExporter.get());
+            }
+
+            // Publish the generations for other processes as well
+            unique_ptr<LiveView> liveView;
+            if (!appValues.liveViewName.empty()) {
+                liveView.reset(new LiveView(appValues.liveViewName, gameOfLife.getPopulation().getWorldSize()));
+                if (liveView->isOpen())
+                    gameOfLife.setLiveView(liveView.get());
+                else
+                    ScreenPrinter::getInstance().printMessage("Could not create the live view "
+                                                              + appValues.liveViewName + "!");
+            }
+
             gameOfLife.runSimulation();
+
+            if (imageExporter) {
+                imageExporter->finish();
+                if (imageExporter->getFailedFrames() > 0)
+                    ScreenPrinter::getInstance().printMessage(to_string(imageExporter->getFailedFrames())
+                                                              + " images could not be written!");
+            }
         }
         catch(ios_base::failure &e){}
 
@@ -0,0 +1,55 @@
+/**
+ * @file server.cpp
+ * @brief Main file of GameOfLife-server, serving simulation jobs over a Unix
+ *  domain socket.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include "Server/SimulationServer.h"
+
+using namespace std;
+
+namespace {
+    SimulationServer* runningServer = nullptr;
+
+    void stopServer(int) {
+        if (runningServer)
+            runningServer->stop();
+    }
+}
+
+/**
+ * @brief Main function of the server.
+ * @details Listens on the socket given as the first argument until it is
+ *  interrupted or terminated. A cache directory and the generations between
+ *  its entries may follow.
+ *
+ * @param argc Number of commandline arguments.
+ * @param argv Command line arguments.
+ * @return int 0 once stopped, 1 if the socket could not be created.
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 4) {
+        cerr << "usage: " << argv[0] << " <socket path> [cache directory [generations between entries]]" << endl;
+        return 1;
+    }
+
+    SimulationServer server(argv[1]);
+    if (argc > 2)
+        server.setCache(argv[2], (argc > 3) ? strtoull(argv[3], nullptr, 10) : 0);
+    if (!server.start()) {
+        cerr << "Could not listen on " << argv[1] << "!" << endl;
+        return 1;
+    }
+
+    runningServer = &server;
+    signal(SIGINT, stopServer);
+    signal(SIGTERM, stopServer);
+    server.run();
+    runningServer = nullptr;
+    return 0;
+}
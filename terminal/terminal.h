@@ -0,0 +1,15 @@
+#ifndef TERMINAL_STUB_H
+#define TERMINAL_STUB_H
+#include <iostream>
+#include <cstring>
+enum COLOR { BLACK, RED, GREEN, YELLOW, BLUE, MAGENTA, CYAN, WHITE };
+struct TerminalColor { COLOR fg, bg; TerminalColor(COLOR f, COLOR b) : fg(f), bg(b) {} };
+class Terminal {
+public:
+    void showCursor(bool) {}
+    void setCursor(int, int) {}
+    void pushColor(TerminalColor) {}
+    void popColor() {}
+    void clear() {}
+};
+#endif
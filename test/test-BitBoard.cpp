@@ -0,0 +1,69 @@
+/**
+ * @file test-BitBoard.cpp
+ * @brief Unit tests for the class BitBoard.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "Cell_Culture/BitBoard.h"
+#include "Cell_Culture/Population.h"
+
+SCENARIO("Packing cells into a BitBoard", "[BitBoard]") {
+  GIVEN("A world of 100x3 cells") {
+    PopulationConfig config;
+    config.worldSize = Dimensions{100, 3};
+    config.density = 0.0;
+    Population cells(config);
+    cells.initiatePopulation("conway");
+    const uint64_t first = 1, second = 1ULL << 1, third = 1ULL << 35;
+    cells.writeRegion(0, 0, 1, 1, &first, 1);
+    cells.writeRegion(64, 1, 2, 1, &second, 1);
+    cells.writeRegion(64, 2, 36, 1, &third, 1);
+
+    WHEN("The whole world is captured") {
+      BitBoard board;
+      board.capture(cells, 0, 0, 100, 3);
+
+      THEN("Living cells should be set bits at their world positions") {
+        REQUIRE(board.getWidth() == 100);
+        REQUIRE(board.getHeight() == 3);
+        REQUIRE(board.get(0, 0) == true);
+        REQUIRE(board.get(65, 1) == true);
+        REQUIRE(board.get(99, 2) == true);
+        REQUIRE(board.get(1, 0) == false);
+      }
+
+      THEN("Blocks spanning several words should count all their cells") {
+        REQUIRE(board.countBlock(0, 0, 100, 3) == 3);
+        REQUIRE(board.countBlock(60, 0, 10, 3) == 1);
+        REQUIRE(board.countBlock(2, 0, 64, 3) == 1);
+        REQUIRE(board.countBlock(66, 0, 33, 3) == 0);
+      }
+
+      THEN("Blocks reaching outside the board should be clipped") {
+        REQUIRE(board.countBlock(-5, -5, 10, 10) == 1);
+        REQUIRE(board.countBlock(90, 1, 50, 50) == 1);
+        REQUIRE(board.countBlock(200, 0, 10, 10) == 0);
+      }
+    }
+
+    WHEN("A rectangle partly outside the world is captured") {
+      BitBoard board;
+      board.capture(cells, 95, 1, 10, 4);
+
+      THEN("Only the cells inside the world should be packed") {
+        REQUIRE(board.get(4, 1) == true);
+        REQUIRE(board.countBlock(0, 0, 10, 4) == 1);
+      }
+    }
+  }
+
+  GIVEN("Words with known bits") {
+    THEN("popcount should count the set bits") {
+      REQUIRE(BitBoard::popcount(0) == 0);
+      REQUIRE(BitBoard::popcount(~0ULL) == 64);
+      REQUIRE(BitBoard::popcount(0x8000000000000001ULL) == 2);
+    }
+  }
+}
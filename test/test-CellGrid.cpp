@@ -0,0 +1,88 @@
+/**
+ * @file test-CellGrid.cpp
+ * @brief Unit tests for the class CellGrid.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "Cell_Culture/CellGrid.h"
+
+SCENARIO("Storing cells in a CellGrid", "[CellGrid]") {
+  GIVEN("An empty grid") {
+    CellGrid cells;
+
+    THEN("It should hold no cells") {
+      REQUIRE(cells.size() == 0);
+      REQUIRE(cells.begin() == cells.end());
+    }
+
+    WHEN("Cells are stored at arbitrary positions") {
+      cells[Point{1, 2}] = Cell(false, GIVE_CELL_LIFE);
+      cells[Point{3, 0}] = Cell(true);
+
+      THEN("The grid should grow to include them and keep the cells") {
+        REQUIRE(cells.getColumns() == 4);
+        REQUIRE(cells.getRows() == 3);
+        REQUIRE(cells.size() == 12);
+        REQUIRE(cells.at(Point{1, 2}).isAlive() == true);
+        REQUIRE(cells.at(Point{3, 0}).isRimCell() == true);
+        REQUIRE(cells.at(Point{0, 0}).isAlive() == false);
+      }
+
+      THEN("Positions outside the grid should throw") {
+        REQUIRE_THROWS_AS(cells.at(Point{4, 0}), std::out_of_range);
+        REQUIRE_THROWS_AS(cells.at(Point{0, -1}), std::out_of_range);
+      }
+    }
+  }
+
+  GIVEN("A grid of 3x2 cells") {
+    CellGrid cells;
+    cells.reset(3, 2);
+    cells[Point{2, 1}] = Cell(false, GIVE_CELL_LIFE);
+
+    THEN("Iteration should visit the cells column by column") {
+      vector<Point> visited;
+      for (auto it = cells.begin(); it != cells.end(); it++)
+        visited.push_back(it->first);
+
+      REQUIRE(visited.size() == 6);
+      REQUIRE(visited[0].x == 0);
+      REQUIRE(visited[0].y == 0);
+      REQUIRE(visited[1].x == 0);
+      REQUIRE(visited[1].y == 1);
+      REQUIRE(visited[5].x == 2);
+      REQUIRE(visited[5].y == 1);
+    }
+
+    THEN("Linear indices should address the same cells as points") {
+      REQUIRE(cells.getIndex(Point{2, 1}) == 5);
+      REQUIRE(cells[5].isAlive() == true);
+      REQUIRE(&cells[5] == &cells.at(Point{2, 1}));
+    }
+  }
+
+  GIVEN("A torus of 3x2 cells with a halo around it") {
+    CellGrid cells;
+    cells.setTopology(TORUS);
+    cells.reset(5, 4);
+    cells[Point{1, 1}] = Cell(false, GIVE_CELL_LIFE);
+    cells[Point{3, 2}] = Cell(false, GIVE_CELL_LIFE);
+
+    WHEN("The halo is refreshed") {
+      cells.refreshHalo();
+
+      THEN("Each halo cell should mirror the opposite edge") {
+        REQUIRE(cells.getTopology() == TORUS);
+        REQUIRE(cells.at(Point{4, 1}).isAlive() == true);
+        REQUIRE(cells.at(Point{1, 3}).isAlive() == true);
+        REQUIRE(cells.at(Point{4, 3}).isAlive() == true);
+        REQUIRE(cells.at(Point{0, 2}).isAlive() == true);
+        REQUIRE(cells.at(Point{3, 0}).isAlive() == true);
+        REQUIRE(cells.at(Point{0, 0}).isAlive() == true);
+        REQUIRE(cells.at(Point{2, 0}).isAlive() == false);
+      }
+    }
+  }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file test-Census.cpp
+ * @brief Unit tests for the class Census.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "Experiments/Census.h"
+
+SCENARIO("Classifying single objects", "[Census]") {
+  GIVEN("A blinker drawn horizontally and vertically") {
+    vector<Point> horizontal{ {0, 0}, {1, 0}, {2, 0} };
+    vector<Point> vertical{ {5, 3}, {5, 4}, {5, 5} };
+
+    THEN("Both should have the same code and be named blinker") {
+      REQUIRE(Census::getObjectCode(horizontal) == Census::getObjectCode(vertical));
+      REQUIRE(Census::classifyObject(horizontal) == "blinker");
+    }
+  }
+
+  GIVEN("A boat in two different orientations") {
+    vector<Point> boat{ {0, 0}, {1, 0}, {0, 1}, {2, 1}, {1, 2} };
+    vector<Point> mirrored{ {2, 0}, {1, 0}, {2, 1}, {0, 1}, {1, 2} };
+
+    THEN("Both should be named boat") {
+      REQUIRE(Census::classifyObject(boat) == "boat");
+      REQUIRE(Census::classifyObject(mirrored) == "boat");
+    }
+  }
+
+  GIVEN("An object that is not known") {
+    vector<Point> object{ {0, 0}, {1, 1} };
+
+    THEN("It should be named by its code") {
+      REQUIRE(Census::classifyObject(object) == "unknown_" + Census::getObjectCode(object));
+    }
+  }
+}
+
+SCENARIO("Taking the census of a population", "[Census]") {
+  GIVEN("Population loaded from objects.txt, holding two blocks and a blinker") {
+    PopulationConfig config;
+    config.fileName = "test/populations/objects.txt";
+
+    Population pop(config);
+    pop.initiatePopulation("conway");
+
+    Census census;
+    census.takeCensus(pop);
+
+    THEN("Each object should be counted by its name") {
+      REQUIRE(census.getTotalObjects() == 3);
+      REQUIRE(census.getObjectCounts().at("block") == 2);
+      REQUIRE(census.getObjectCounts().at("blinker") == 1);
+    }
+
+    WHEN("The population has advanced a generation") {
+      pop.calculateNewGeneration();
+      pop.calculateNewGeneration();
+
+      Census later;
+      later.takeCensus(pop);
+
+      THEN("The blinker should still be recognized") {
+        REQUIRE(later.getObjectCounts().at("blinker") == 1);
+      }
+    }
+
+    WHEN("The census is merged into another one") {
+      Census total;
+      total.merge(census);
+      total.merge(census);
+
+      THEN("The counts should add up") {
+        REQUIRE(total.getObjectCounts().at("block") == 4);
+        REQUIRE(total.getTotalObjects() == 6);
+      }
+    }
+  }
+}
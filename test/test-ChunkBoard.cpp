@@ -0,0 +1,91 @@
+/**
+ * @file test-ChunkBoard.cpp
+ * @brief Unit tests for the class ChunkBoard.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <memory>
+#include "Cell_Culture/ChunkBoard.h"
+#include "Cell_Culture/Population.h"
+#include "GoL_Rules/RuleFactory.h"
+
+// Returns the lane rule of a rule of the factory.
+static LaneRule getRule(string name) {
+  CellGrid cells;
+  cells.reset(3, 3);
+  unique_ptr<RuleOfExistence> rule(RuleFactory::getInstance().createAndReturnRule(cells, name));
+  ActionTable table;
+  REQUIRE(rule->getActionTable(table));
+  return LaneBoards::getLaneRule(table);
+}
+
+SCENARIO("Stepping a world chunk by chunk", "[ChunkBoard]") {
+  GIVEN("A blinker in a bounded 5x5 world") {
+    ChunkBoard board({5, 5}, BOUNDED);
+    vector<uint8_t> cells(25, 0);
+    cells[2 * 5 + 1] = cells[2 * 5 + 2] = cells[2 * 5 + 3] = 1;
+    board.setCells(cells.data());
+    LaneRule conway = getRule("conway");
+
+    WHEN("It is stepped twice") {
+      board.step(conway);
+      vector<int> firstChanges = board.getChanges();
+      board.step(conway);
+
+      THEN("Four cells should change each generation and the blinker return") {
+        REQUIRE(firstChanges.size() == 4);
+        REQUIRE(board.getChanges().size() == 4);
+        REQUIRE(board.getLivingCells() == 3);
+        REQUIRE(board.getRowLiving()[2] == 3);
+        REQUIRE(board.getColumnLiving()[2] == 1);
+        for (int i = 0; i < 25; i++)
+          REQUIRE(board.isAlive(i) == (cells[i] != 0));
+      }
+    }
+  }
+
+  GIVEN("Random worlds, also narrow ones and ones of several chunks, run by 'conway*3;von_neumann*2'") {
+    RuleSchedule schedule;
+    REQUIRE(schedule.parse("conway*3;von_neumann*2"));
+    vector<LaneRule> rules{getRule("conway"), getRule("von_neumann")};
+    int ruleOfGeneration[] = {0, 0, 0, 1, 1};
+
+    for (Dimensions size : {Dimensions{40, 30}, Dimensions{1, 7}, Dimensions{2, 5}, Dimensions{130, 70}}) {
+      for (TOPOLOGY topology : {BOUNDED, TORUS}) {
+        PopulationConfig config;
+        config.worldSize = size;
+        config.seed = 9;
+        config.density = 0.4;
+        config.topology = topology;
+        Population population(config);
+        population.initiatePopulation(schedule);
+
+        // the first generation is committed once the next is calculated
+        vector<uint8_t> cells(size.WIDTH * size.HEIGHT);
+        population.calculateNewGeneration();
+        population.readRegion(0, 0, size.WIDTH, size.HEIGHT, cells.data());
+        ChunkBoard board(size, topology);
+        board.setCells(cells.data());
+
+        THEN("Every generation should match the population's") {
+          for (int generation = 0; generation < 30; generation++) {
+            board.step(rules[ruleOfGeneration[generation % 5]]);
+            population.calculateNewGeneration();
+            population.readRegion(0, 0, size.WIDTH, size.HEIGHT, cells.data());
+            uint64_t livingCells = 0;
+            vector<int> rowLiving(size.HEIGHT, 0);
+            for (int i = 0; i < size.WIDTH * size.HEIGHT; i++) {
+              REQUIRE(board.isAlive(i) == (cells[i] != 0));
+              livingCells += cells[i];
+              rowLiving[i / size.WIDTH] += cells[i];
+            }
+            REQUIRE(board.getLivingCells() == livingCells);
+            REQUIRE(board.getRowLiving() == rowLiving);
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file test-DistributedSimulation.cpp
+ * @brief Unit tests for the class DistributedSimulation.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdio>
+#include "Experiments/DistributedSimulation.h"
+#include "Cell_Culture/Population.h"
+#include "Support/FileLoader.h"
+
+SCENARIO("Splitting the world into strips", "[DistributedSimulation]") {
+  GIVEN("A world of 23 rows") {
+    THEN("The strips of any number of workers should cover it without overlapping") {
+      for (int nrOfWorkers = 1; nrOfWorkers <= 23; nrOfWorkers++) {
+        int expectedFirstRow = 0;
+        for (int worker = 0; worker < nrOfWorkers; worker++) {
+          int firstRow, lastRow;
+          DistributedSimulation::getStrip(worker, nrOfWorkers, 23, firstRow, lastRow);
+          REQUIRE(firstRow == expectedFirstRow);
+          REQUIRE(lastRow > firstRow);
+          expectedFirstRow = lastRow;
+        }
+        REQUIRE(expectedFirstRow == 23);
+      }
+    }
+  }
+}
+
+SCENARIO("Running a distributed simulation", "[DistributedSimulation]") {
+  RuleSchedule ruleSchedule;
+  REQUIRE(ruleSchedule.parse("conway*3;von_neumann*2"));
+
+  for (TOPOLOGY topology : { BOUNDED, TORUS }) {
+    for (int nrOfWorkers : { 1, 2, 3, 5 }) {
+      GIVEN(to_string(nrOfWorkers) + " workers" + (topology == TORUS ? " on a torus" : " in a bounded world")) {
+        PopulationConfig config;
+        config.worldSize = {70, 23};
+        config.seed = 7;
+        config.density = 0.4;
+        config.topology = topology;
+
+        DistributedSimulation simulation(nrOfWorkers, 20, config.worldSize, ruleSchedule, 7, 0.4, topology);
+        simulation.setCheckpoints("test/populations/distributed", 10);
+        REQUIRE(simulation.run());
+
+        // a generation is committed when the next one is calculated
+        Population population(config);
+        population.initiatePopulation(ruleSchedule);
+        population.calculateNewGeneration();
+
+        THEN("The living cells and checkpoints should match a single population") {
+          REQUIRE(simulation.getStats().size() == 20);
+          for (int generation = 1; generation <= 20; generation++) {
+            population.calculateNewGeneration();
+
+            uint64_t livingCells = 0;
+            for (int row = 1; row <= 23; row++) {
+              for (int column = 1; column <= 70; column++)
+                livingCells += population.getCellAtPosition(Point{column, row}).isAlive();
+            }
+            REQUIRE(simulation.getStats()[generation - 1].generation == generation);
+            REQUIRE(simulation.getStats()[generation - 1].livingCells == livingCells);
+
+            if (generation % 10 == 0) {
+              CellGrid checkpoint;
+              FileLoader fileLoader;
+              Dimensions worldSize;
+              fileLoader.loadPopulationFromFile(simulation.getCheckpointName(generation), checkpoint, worldSize);
+              REQUIRE(worldSize.WIDTH == 70);
+              REQUIRE(worldSize.HEIGHT == 23);
+              for (int row = 1; row <= 23; row++) {
+                for (int column = 1; column <= 70; column++)
+                  REQUIRE(checkpoint.at(Point{column, row}).isAlive()
+                          == population.getCellAtPosition(Point{column, row}).isAlive());
+              }
+            }
+          }
+        }
+
+        remove(simulation.getCheckpointName(10).c_str());
+        remove(simulation.getCheckpointName(20).c_str());
+      }
+    }
+  }
+
+  GIVEN("Rules that look beyond the nearest neighbours or keep state") {
+    THEN("They should not be distributed") {
+      string rejectedRule;
+      REQUIRE(DistributedSimulation::canDistribute(RuleSchedule("conway", "von_neumann"), rejectedRule));
+      REQUIRE_FALSE(DistributedSimulation::canDistribute(RuleSchedule("conway", "erik"), rejectedRule));
+      REQUIRE(rejectedRule == "erik");
+      REQUIRE_FALSE(DistributedSimulation::canDistribute(RuleSchedule("bosco", "conway"), rejectedRule));
+      REQUIRE(rejectedRule == "bosco");
+
+      DistributedSimulation simulation(2, 5, Dimensions{10, 10}, RuleSchedule("brians_brain", ""));
+      REQUIRE_FALSE(simulation.run());
+    }
+  }
+}
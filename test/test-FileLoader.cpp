@@ -11,12 +11,11 @@
 
 // Test of initialization with custom population.
 SCENARIO("Loading good 5x5 cells 'good.txt'", "[FileLoader]") {
-	fileName = "test/populations/good.txt";
-
 	GIVEN("Cells loaded from file good.txt") {
 		FileLoader fileLoader;
-		std::map<Point, Cell> cells;
-		fileLoader.loadPopulationFromFile(cells);
+		CellGrid cells;
+		Dimensions worldSize;
+		fileLoader.loadPopulationFromFile("test/populations/good.txt", cells, worldSize);
 
 		THEN("Total should be (5+2)*(5+2) = 49") {
 			REQUIRE(cells.size() == 49);
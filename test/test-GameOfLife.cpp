@@ -11,14 +11,15 @@
 
 // Test of initialization with custom population.
 SCENARIO("Run game on good 5x5 cells 'good.txt'", "[GameOfLife]") {
+	PopulationConfig config;
 	#ifdef _WIN32
-		fileName = "../test/populations/good.txt";
+		config.fileName = "../test/populations/good.txt";
 	#else
-		fileName = "test/populations/good.txt";
+		config.fileName = "test/populations/good.txt";
 	#endif
 
 	GIVEN("Cells loaded from file good.txt") {
-		GameOfLife gameOfLife = GameOfLife(5, "conway", "erik");
+		GameOfLife gameOfLife(5, "conway", "erik", config);
 		gameOfLife.runSimulation();
 
 		THEN("Cell at position (1, 3) should be alive and 4 years old") {
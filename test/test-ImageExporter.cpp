@@ -0,0 +1,87 @@
+/**
+ * @file test-ImageExporter.cpp
+ * @brief Unit tests for the class ImageExporter.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include "ImageExporter.h"
+
+SCENARIO("Encoding images", "[ImageExporter]") {
+  GIVEN("The pixels of a 2x1 image, one white and one black") {
+    vector<uint8_t> pixels{229, 229, 229, 0, 0, 0};
+
+    THEN("The PPM image should be its header followed by the pixels") {
+      string image = ImageExporter::encodePPM(pixels, 2, 1);
+      REQUIRE(image == string("P6\n2 1\n255\n\xE5\xE5\xE5\0\0\0", 17));
+    }
+  }
+
+  GIVEN("The pixels of a uniform 100x100 image") {
+    vector<uint8_t> pixels(100 * 100 * 3, 17);
+    string image = ImageExporter::encodePNG(pixels, 100, 100);
+
+    THEN("It should start with the PNG signature and header") {
+      REQUIRE(image.substr(0, 8) == string("\x89PNG\r\n\x1a\n", 8));
+      REQUIRE(image.substr(12, 4) == "IHDR");
+      REQUIRE(image.substr(16, 8) == string("\0\0\0\x64\0\0\0\x64", 8));
+      REQUIRE(image.substr(image.size() - 8, 4) == "IEND");
+    }
+
+    THEN("Runs of equal pixels should be compressed") {
+      REQUIRE(image.size() < 1000);
+    }
+  }
+
+  GIVEN("The colors of the cell states") {
+    uint8_t living[3], dead[3];
+    ImageExporter::getRGB(STATE_COLORS.LIVING, living);
+    ImageExporter::getRGB(STATE_COLORS.DEAD, dead);
+
+    THEN("Living and dead cells should differ") {
+      REQUIRE(living[0] != dead[0]);
+      REQUIRE(dead[0] == 0);
+    }
+  }
+}
+
+SCENARIO("Exporting generations of a population", "[ImageExporter]") {
+  GIVEN("A randomized 8x4 population") {
+    PopulationConfig config;
+    config.worldSize = {8, 4};
+    config.seed = 7;
+    Population population(config);
+    population.initiatePopulation("conway");
+
+    WHEN("Every second of three generations is exported as PPM at scale 2") {
+      ImageExporter exporter("test-export-", PPM, 2, 2, 1, 1);
+      for (int generation = 0; generation < 3; generation++) {
+        exporter.exportFrame(population, generation);
+        population.calculateNewGeneration();
+      }
+      exporter.finish();
+
+      THEN("Only generations 0 and 2 should be written, 16x8 pixels each") {
+        REQUIRE(exporter.getFailedFrames() == 0);
+
+        ifstream first(exporter.getFileName(0), ios::binary);
+        ifstream second(exporter.getFileName(1), ios::binary);
+        ifstream third(exporter.getFileName(2), ios::binary);
+        REQUIRE(first.good());
+        REQUIRE_FALSE(second.good());
+        REQUIRE(third.good());
+
+        string header;
+        getline(first, header);
+        getline(first, header);
+        REQUIRE(header == "16 8");
+      }
+
+      remove(exporter.getFileName(0).c_str());
+      remove(exporter.getFileName(2).c_str());
+    }
+  }
+}
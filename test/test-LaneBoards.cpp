@@ -0,0 +1,73 @@
+/**
+ * @file test-LaneBoards.cpp
+ * @brief Unit tests for the class LaneBoards.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <memory>
+#include "Cell_Culture/LaneBoards.h"
+#include "Cell_Culture/Population.h"
+#include "GoL_Rules/RuleFactory.h"
+
+SCENARIO("Stepping worlds in lanes", "[LaneBoards]") {
+  GIVEN("Lanes filled with the random worlds of 64 populations of a 70x9 world") {
+    for (TOPOLOGY topology : {BOUNDED, TORUS}) {
+      LaneBoards boards({70, 9}, topology);
+      vector<Population*> populations;
+      vector<uint64_t> bitmap(boards.getBitmapWords());
+      for (int lane = 0; lane < LaneBoards::LANES; lane++) {
+        PopulationConfig config;
+        config.worldSize = {70, 9};
+        config.seed = lane;
+        config.density = 0.3;
+        config.topology = topology;
+        populations.push_back(new Population(config));
+        populations.back()->initiatePopulation((lane % 2) ? "von_neumann" : "conway");
+        for (int row = 0; row < 9; row++)
+          Population::randomizeRow(config, row, &bitmap[row * boards.getWordsPerRow()]);
+        boards.setLane(lane, bitmap.data());
+      }
+
+      WHEN("The even lanes are stepped by conway and the odd by von_neumann") {
+        CellGrid cells;
+        cells.reset(3, 3);
+        vector<LaneRule> rules;
+        for (string name : {"conway", "von_neumann"}) {
+          unique_ptr<RuleOfExistence> rule(RuleFactory::getInstance().createAndReturnRule(cells, name));
+          ActionTable table;
+          REQUIRE(rule->getActionTable(table));
+          rules.push_back(LaneBoards::getLaneRule(table));
+        }
+        REQUIRE(rules[0].birthCounts == 1 << 3);
+        REQUIRE(rules[0].survivalCounts == ((1 << 2) | (1 << 3)));
+        REQUIRE_FALSE(rules[1].diagonal);
+
+        // the first generation is committed once the next is calculated
+        for (int lane = 0; lane < LaneBoards::LANES; lane++)
+          populations[lane]->calculateNewGeneration();
+
+        vector<uint64_t> ruleLanes{0x5555555555555555ull, 0xAAAAAAAAAAAAAAAAull};
+
+        THEN("Every lane should match its population, generation after generation") {
+          vector<uint64_t> bitmaps;
+          for (int generation = 0; generation < 10; generation++) {
+            boards.readLanes(bitmaps);
+            for (int lane = 0; lane < LaneBoards::LANES; lane++) {
+              populations[lane]->readRegion(0, 0, 70, 9, bitmap.data(), boards.getWordsPerRow());
+              vector<uint64_t> laneBitmap(bitmaps.begin() + lane * boards.getBitmapWords(),
+                                          bitmaps.begin() + (lane + 1) * boards.getBitmapWords());
+              REQUIRE(laneBitmap == bitmap);
+              populations[lane]->calculateNewGeneration();
+            }
+            boards.step(rules, ruleLanes);
+          }
+        }
+      }
+
+      for (Population* population : populations)
+        delete population;
+    }
+  }
+}
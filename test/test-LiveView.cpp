@@ -0,0 +1,86 @@
+/**
+ * @file test-LiveView.cpp
+ * @brief Unit tests for the classes LiveView and LiveViewReader.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <unistd.h>
+#include "LiveView.h"
+
+SCENARIO("Publishing generations in shared memory", "[LiveView]") {
+  GIVEN("A live view of a 70x9 population and a reader") {
+    PopulationConfig config;
+    config.worldSize = {70, 9};
+    config.seed = 11;
+    Population population(config);
+    population.initiatePopulation("conway");
+
+    string name = "/gameoflife-test-" + to_string(getpid());
+    LiveView liveView(name, config.worldSize);
+    REQUIRE(liveView.isOpen());
+    LiveViewReader reader(name);
+    REQUIRE(reader.isOpen());
+
+    WHEN("Nothing has been published") {
+      THEN("There should be nothing to read") {
+        LiveViewSnapshot snapshot;
+        REQUIRE_FALSE(reader.beginRead(snapshot));
+      }
+    }
+
+    WHEN("A generation is published") {
+      liveView.publish(population, 3);
+
+      THEN("The reader should see it in place") {
+        LiveViewSnapshot snapshot;
+        REQUIRE(reader.beginRead(snapshot));
+        REQUIRE(snapshot.generation == 3);
+        REQUIRE(snapshot.width == 70);
+        REQUIRE(snapshot.height == 9);
+        REQUIRE(snapshot.wordsPerRow == 2);
+
+        uint64_t livingCells = 0;
+        for (int row = 0; row < 9; row++) {
+          for (int column = 0; column < 70; column++) {
+            bool alive = (snapshot.board[row * snapshot.wordsPerRow + column / 64] >> (column % 64)) & 1;
+            REQUIRE(alive == population.getCellAtPosition(Point{column + 1, row + 1}).isAlive());
+            livingCells += alive;
+          }
+        }
+        REQUIRE(snapshot.livingCells == livingCells);
+        REQUIRE(reader.endRead(snapshot));
+      }
+    }
+
+    WHEN("Generations are published while a snapshot is read") {
+      liveView.publish(population, 1);
+      LiveViewSnapshot snapshot;
+      REQUIRE(reader.beginRead(snapshot));
+
+      THEN("The read should hold while the other slot is written") {
+        population.calculateNewGeneration();
+        liveView.publish(population, 2);
+        REQUIRE(reader.endRead(snapshot));
+
+        AND_THEN("It should be rejected once its own slot is written again") {
+          liveView.publish(population, 3);
+          REQUIRE_FALSE(reader.endRead(snapshot));
+
+          LiveViewSnapshot latest;
+          REQUIRE(reader.beginRead(latest));
+          REQUIRE(latest.generation == 3);
+          REQUIRE(reader.endRead(latest));
+        }
+      }
+    }
+  }
+
+  GIVEN("A segment that does not exist") {
+    THEN("The reader should not open") {
+      LiveViewReader reader("/gameoflife-test-missing");
+      REQUIRE_FALSE(reader.isOpen());
+    }
+  }
+}
@@ -0,0 +1,46 @@
+/**
+ * @file test-MonotonicArena.cpp
+ * @brief Unit tests for the class MonotonicArena.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdint>
+#include <cstring>
+#include "Support/MonotonicArena.h"
+
+SCENARIO("Allocating from a MonotonicArena", "[MonotonicArena]") {
+  GIVEN("An arena with a small first block") {
+    MonotonicArena arena(64);
+
+    WHEN("Allocations of different sizes and alignments are made") {
+      char* first = static_cast<char*>(arena.allocate(10, 1));
+      double* second = static_cast<double*>(arena.allocate(sizeof(double) * 4, alignof(double)));
+      char* large = static_cast<char*>(arena.allocate(1000, 16));
+
+      memset(first, 1, 10);
+      memset(large, 2, 1000);
+      for (int i = 0; i < 4; i++)
+        second[i] = i;
+
+      THEN("They should be aligned and not overlap") {
+        REQUIRE(reinterpret_cast<uintptr_t>(second) % alignof(double) == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(large) % 16 == 0);
+        REQUIRE(first[9] == 1);
+        REQUIRE(second[3] == 3);
+        REQUIRE(large[999] == 2);
+      }
+    }
+
+    WHEN("An object is created in the arena") {
+      struct Pair { int first, second; Pair(int a, int b) : first(a), second(b) {} };
+      Pair* pair = arena.create<Pair>(3, 4);
+
+      THEN("It should be constructed with the given arguments") {
+        REQUIRE(pair->first == 3);
+        REQUIRE(pair->second == 4);
+      }
+    }
+  }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test-ParameterSweep.cpp
+ * @brief Unit tests for the class ParameterSweep.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "Experiments/ParameterSweep.h"
+#include "Cell_Culture/Population.h"
+#include "GoL_Rules/RuleFactory.h"
+
+SCENARIO("Reading sweep specs", "[ParameterSweep]") {
+  GIVEN("A sweep") {
+    ParameterSweep sweep;
+    string error;
+
+    THEN("Without a spec it should be a single default run") {
+      vector<SweepRun> runs = sweep.expand();
+      REQUIRE(runs.size() == 1);
+      REQUIRE(runs[0].rules == "conway");
+      REQUIRE(runs[0].config.worldSize.WIDTH == 80);
+      REQUIRE(runs[0].generations == 500);
+      REQUIRE(sweep.getOutputFile() == "sweep.csv");
+    }
+
+    THEN("Lists and ranges should expand to every combination") {
+      REQUIRE(sweep.parse("rules all conway*2;erik # comment\n"
+                          "\n"
+                          "densities 0.1..0.9:0.1\n"
+                          "sizes 10x10 20x5\n"
+                          "seeds 1..3\n"
+                          "topologies bounded torus\n"
+                          "output out.csv\n", error));
+      vector<SweepRun> runs = sweep.expand();
+      size_t ruleCount = RuleFactory::getRuleNames().size() + 1;
+      REQUIRE(runs.size() == ruleCount * 9 * 2 * 3 * 2);
+      REQUIRE(runs.front().rules == "conway");
+      REQUIRE(runs.back().rules == "conway*2;erik");
+      REQUIRE(runs.back().config.density == 0.9);
+      REQUIRE(runs.back().config.worldSize.HEIGHT == 5);
+      REQUIRE(runs.back().config.seed == 3);
+      REQUIRE(runs.back().config.topology == TORUS);
+      REQUIRE(runs[2].config.density == 0.1);
+      REQUIRE(runs[6].config.density == 0.2);
+      REQUIRE(sweep.getOutputFile() == "out.csv");
+    }
+
+    THEN("Bad lines should be rejected, keeping the parameters") {
+      REQUIRE_FALSE(sweep.parse("colours red\n", error));
+      REQUIRE_FALSE(sweep.parse("densities 1.5\n", error));
+      REQUIRE_FALSE(sweep.parse("densities 0.9..0.1\n", error));
+      REQUIRE_FALSE(sweep.parse("sizes 10by10\n", error));
+      REQUIRE_FALSE(sweep.parse("seeds\n", error));
+      REQUIRE_FALSE(sweep.parse("rules conway\ngenerations -5\n", error));
+      REQUIRE(error == "line 2: bad value for generations");
+      REQUIRE(sweep.expand().size() == 1);
+    }
+
+    THEN("Rules that can not be created should be rejected") {
+      REQUIRE_FALSE(sweep.parse("rules conway map:nope.txt\n", error));
+      REQUIRE(error == "line 1: unknown rule map:nope.txt");
+      REQUIRE_FALSE(sweep.parse("rules lookup:erik\n", error));
+      REQUIRE(error == "line 1: unknown rule lookup:erik");
+      REQUIRE_FALSE(sweep.parse("rules conway;conwy\n", error));
+      REQUIRE(sweep.expand().size() == 1);
+    }
+  }
+}
+
+SCENARIO("Running sweeps", "[ParameterSweep]") {
+  GIVEN("A sweep of two rules, sizes and seeds") {
+    ParameterSweep sweep;
+    string error;
+    REQUIRE(sweep.parse("rules conway von_neumann\nsizes 12x12 30x20\nseeds 7 8\ngenerations 25\n", error));
+    sweep.runSweep();
+
+    THEN("Every run should match a population simulated on its own") {
+      REQUIRE(sweep.getRuns().size() == 8);
+      for (const SweepRun& run : sweep.getRuns()) {
+        Population population(run.config);
+        population.initiatePopulation(run.rules);
+        for (int generation = 0; generation < 25; generation++)
+          population.calculateNewGeneration();
+
+        uint64_t livingCells = 0;
+        Dimensions worldSize = population.getWorldSize();
+        for (int y = 1; y <= worldSize.HEIGHT; y++)
+          for (int x = 1; x <= worldSize.WIDTH; x++)
+            livingCells += population.getCellAtPosition(Point{x, y}).isAliveAfterUpdate();
+        REQUIRE(run.livingCells == livingCells);
+      }
+    }
+
+    THEN("The CSV should have a header and a line per run, in spec order") {
+      ostringstream csv;
+      sweep.writeCsv(csv);
+      istringstream lines(csv.str());
+      string line;
+      getline(lines, line);
+      REQUIRE(line == "rules,width,height,topology,density,seed,generations,living_cells,objects,census,status");
+      getline(lines, line);
+      string first = "\"conway\",12,12,bounded,0.5,7,25,";
+      REQUIRE(line.compare(0, first.size(), first) == 0);
+
+      REQUIRE(line.compare(line.size() - 3, 3, ",ok") == 0);
+
+      int count = 1;
+      while (getline(lines, line))
+        count++;
+      REQUIRE(count == 8);
+    }
+  }
+
+  GIVEN("A sweep whose rule file is removed after the spec is read") {
+    string ruleFile = "sweep-removed-rule.txt";
+    {
+      ifstream source("test/populations/regions.txt");
+      ofstream copy(ruleFile);
+      copy << source.rdbuf();
+    }
+    ParameterSweep sweep;
+    string error;
+    REQUIRE(sweep.parse("rules conway map:" + ruleFile + "\nsizes 12x12\ngenerations 5\n", error));
+    remove(ruleFile.c_str());
+    sweep.runSweep();
+
+    THEN("Its runs should be recorded as failed, the others should finish") {
+      REQUIRE(sweep.getRuns().size() == 2);
+      REQUIRE_FALSE(sweep.getRuns()[0].failed);
+      REQUIRE(sweep.getRuns()[1].failed);
+      REQUIRE(sweep.getRuns()[1].livingCells == 0);
+
+      ostringstream csv;
+      sweep.writeCsv(csv);
+      string text = csv.str();
+      string failedLine = "\"map:" + ruleFile + "\",12,12,bounded,0.5,0,5,0,0,\"\",failed\n";
+      REQUIRE(text.compare(text.size() - failedLine.size(), failedLine.size(), failedLine) == 0);
+    }
+  }
+}
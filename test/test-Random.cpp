@@ -0,0 +1,54 @@
+/**
+ * @file test-Random.cpp
+ * @brief Unit tests for the random number generation in Random.h.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <bitset>
+#include "Support/Random.h"
+
+SCENARIO("Generating random bits", "[Random]") {
+  GIVEN("Two generators with the same seed and one with another seed") {
+    Xoshiro256 first(1234), second(1234), other(4321);
+
+    THEN("Generators with the same seed should give the same sequence") {
+      for (int i = 0; i < 100; i++)
+        REQUIRE(first.next() == second.next());
+    }
+
+    THEN("Generators with different seeds should give different sequences") {
+      REQUIRE(first.next() != other.next());
+    }
+  }
+
+  GIVEN("A generator drawing bits with a given probability") {
+    Xoshiro256 generator(99);
+
+    WHEN("The probability is one quarter") {
+      int setBits = 0;
+      for (int i = 0; i < 1000; i++)
+        setBits += std::bitset<64>(generator.nextBits(16384)).count();
+
+      THEN("Close to a quarter of the bits should be set") {
+        REQUIRE(setBits > 15000);
+        REQUIRE(setBits < 17000);
+      }
+    }
+
+    WHEN("The probability is zero or one") {
+      THEN("No bits or all bits should be set") {
+        REQUIRE(generator.nextBits(0) == 0);
+        REQUIRE(generator.nextBits(65536) == ~0ULL);
+      }
+    }
+  }
+
+  GIVEN("Streams derived from the same seed") {
+    THEN("Each stream should get a seed of its own, the same every time") {
+      REQUIRE(getStreamSeed(7, 0) != getStreamSeed(7, 1));
+      REQUIRE(getStreamSeed(7, 1) == getStreamSeed(7, 1));
+    }
+  }
+}
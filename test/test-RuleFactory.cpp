@@ -7,6 +7,7 @@
  */
 
 #include <catch.hpp>
+#include <sstream>
 #include "GoL_Rules/RuleFactory.h"
 #include "GoL_Rules/RuleOfExistence_Conway.h"
 #include "GoL_Rules/RuleOfExistence_Erik.h"
@@ -17,7 +18,7 @@ SCENARIO("Functions of the RuleFactory class", "[RuleFactory]")
     GIVEN("Getting an RuleFactory object by getInstance()")
 
     {
-        std::map<Point, Cell> cellGeneration;
+        CellGrid cellGeneration;
         RuleFactory test = RuleFactory::getInstance();
 
         WHEN("No rule name/invalid rule name is given")
@@ -53,3 +54,33 @@ SCENARIO("Functions of the RuleFactory class", "[RuleFactory]")
 }
 
 
+
+SCENARIO("Telling known rule names from unknown ones", "[RuleFactory]")
+{
+    GIVEN("Rule names of every kind, some misspelt")
+    {
+        THEN("Only the names the factory constructs should be known")
+        {
+            for (const string& ruleName : RuleFactory::getRuleNames())
+                REQUIRE(RuleFactory::isRuleName(ruleName));
+            REQUIRE(RuleFactory::isRuleName("23/36/2"));
+            REQUIRE(RuleFactory::isRuleName("lookup:conway"));
+            REQUIRE(RuleFactory::isRuleName("map:rules.txt"));
+            REQUIRE_FALSE(RuleFactory::isRuleName("conwy"));
+            REQUIRE_FALSE(RuleFactory::isRuleName("lookup:conwy"));
+            REQUIRE_FALSE(RuleFactory::isRuleName("map:"));
+        }
+
+        THEN("Rules that throw when constructed should not be creatable")
+        {
+            // keep the message about closing the application off the output
+            stringstream output;
+            streambuf* outBuffer = cout.rdbuf(output.rdbuf());
+            REQUIRE(RuleFactory::getInstance().canCreateRule("lookup:conway"));
+            REQUIRE_FALSE(RuleFactory::getInstance().canCreateRule("lookup:erik"));
+            REQUIRE_FALSE(RuleFactory::getInstance().canCreateRule("map:nope.txt"));
+            REQUIRE_FALSE(RuleFactory::getInstance().canCreateRule("conwy"));
+            cout.rdbuf(outBuffer);
+        }
+    }
+}
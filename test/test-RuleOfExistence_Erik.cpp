@@ -14,7 +14,7 @@ SCENARIO("RuleOfExistence_Erik testcase1", "[erik]")
 {
 	GIVEN("Spare population upgrade")
 	{
-		std::map<Point, Cell> cells;
+		CellGrid cells;
 		RuleFactory test = RuleFactory::getInstance();
 
 		WHEN("Cell values are set as [0 0;1 0]")
@@ -73,7 +73,7 @@ SCENARIO("RuleOfExistence_Erik testcase2", "[erik]")
 {
 	GIVEN("Dense population upgrade")
 	{
-		std::map<Point, Cell> cells;
+		CellGrid cells;
 		RuleFactory test = RuleFactory::getInstance();
 
 		WHEN("Cell values are set as [1 1;1 0]")
@@ -142,3 +142,51 @@ SCENARIO("RuleOfExistence_Erik testcase2", "[erik]")
 }
 
 
+
+SCENARIO("RuleOfExistence_Erik prime elder", "[erik]")
+{
+	GIVEN("A block of four equally old cells in a 4x4 world")
+	{
+		CellGrid cells;
+		cells.reset(6, 6);
+		for (int i = 0; i < 6; ++i) {
+			for (int j = 0; j < 6; ++j) {
+				bool rim = (i == 0 || j == 0 || i == 5 || j == 5);
+				bool block = (i == 2 || i == 3) && (j == 2 || j == 3);
+				cells[Point{ i, j }] = rim ? Cell(true) : Cell(false, block ? GIVE_CELL_LIFE : IGNORE_CELL);
+			}
+		}
+		RuleOfExistence_Erik rule(cells);
+
+		WHEN("Generations pass until the cells are older than 9")
+		{
+			int firstElderGeneration = -1;
+			for (int generation = 0; generation < 15 && firstElderGeneration < 0; ++generation) {
+				rule.executeRule();
+				for (int i = 1; i < 5; ++i) {
+					for (int j = 1; j < 5; ++j)
+						cells[Point{ i, j }].updateState();
+				}
+
+				int elders = 0;
+				for (int i = 1; i < 5; ++i) {
+					for (int j = 1; j < 5; ++j) {
+						if (cells[Point{ i, j }].getColor() == STATE_COLORS.ELDER)
+							elders++;
+					}
+				}
+				REQUIRE(elders <= 1);
+				if (elders == 1)
+					firstElderGeneration = generation;
+			}
+
+			THEN("The first of them in column order should become the only prime elder")
+			{
+				REQUIRE(firstElderGeneration >= 0);
+				REQUIRE(cells[Point{ 2, 2 }].getColor() == STATE_COLORS.ELDER);
+				REQUIRE(cells[Point{ 3, 2 }].getColor() == STATE_COLORS.OLD);
+				REQUIRE(cells[Point{ 2, 3 }].getColor() == STATE_COLORS.OLD);
+			}
+		}
+	}
+}
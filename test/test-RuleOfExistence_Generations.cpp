@@ -0,0 +1,159 @@
+/**
+ * @file test-RuleOfExistence_Generations.cpp
+ * @brief Unit tests for the class RuleOfExistence_Generations
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "GoL_Rules/RuleFactory.h"
+#include "GoL_Rules/RuleOfExistence_Generations.h"
+
+namespace {
+
+    // A world of 70x6 cells inside a rim, spanning two words per row.
+    void fillWorld(CellGrid& cells, TOPOLOGY topology) {
+        cells.setTopology(topology);
+        cells.reset(72, 8);
+        for (int row = 0; row < 8; row++) {
+            for (int column = 0; column < 72; column++) {
+                bool rim = row == 0 || column == 0 || row == 7 || column == 71;
+                bool alive = (column * 5 + row * 3) % 7 < 3;
+                cells[Point{ column, row }] = rim ? Cell(true) : Cell(false, alive ? GIVE_CELL_LIFE : DO_NOTHING);
+            }
+        }
+    }
+
+    // Steps each cell on its own.
+    vector<int> stepStates(const vector<int>& states, int width, int height, bool torus, int stateCount,
+                           uint16_t birthCounts, uint16_t survivalCounts) {
+        vector<int> next(states.size());
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int count = 0;
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dx = -1; dx <= 1; dx++) {
+                        int column = x + dx, row = y + dy;
+                        if (dx == 0 && dy == 0)
+                            continue;
+                        if (torus) {
+                            column = (column + width) % width;
+                            row = (row + height) % height;
+                        }
+                        else if (column < 0 || row < 0 || column >= width || row >= height)
+                            continue;
+                        count += states[row * width + column] == 1;
+                    }
+                }
+
+                int state = states[y * width + x];
+                if (state == 0)
+                    next[y * width + x] = ((birthCounts >> count) & 1) ? 1 : 0;
+                else if (state == 1 && ((survivalCounts >> count) & 1))
+                    next[y * width + x] = 1;
+                else
+                    next[y * width + x] = (state + 1) % stateCount;
+            }
+        }
+        return next;
+    }
+}
+
+SCENARIO("Reading Generations rule names", "[Generations]")
+{
+    int states;
+    uint16_t birthCounts, survivalCounts;
+
+    WHEN("Brian's Brain is given by name and in both forms")
+    {
+        THEN("Its parameters should be read")
+        {
+            for (string name : { "brians_brain", "/2/3", "B2/S/C3" }) {
+                REQUIRE(RuleOfExistence_Generations::parseRuleName(name, states, birthCounts, survivalCounts));
+                REQUIRE(states == 3);
+                REQUIRE(birthCounts == 1 << 2);
+                REQUIRE(survivalCounts == 0);
+            }
+        }
+    }
+
+    WHEN("Star Wars is given by name")
+    {
+        THEN("Its parameters should be read")
+        {
+            REQUIRE(RuleOfExistence_Generations::parseRuleName("star_wars", states, birthCounts, survivalCounts));
+            REQUIRE(states == 4);
+            REQUIRE(birthCounts == 1 << 2);
+            REQUIRE(survivalCounts == ((1 << 3) | (1 << 4) | (1 << 5)));
+        }
+    }
+
+    WHEN("Other names are given")
+    {
+        THEN("They should be rejected")
+        {
+            REQUIRE_FALSE(RuleOfExistence_Generations::parseRuleName("conway", states, birthCounts, survivalCounts));
+            REQUIRE_FALSE(RuleOfExistence_Generations::parseRuleName("/2/", states, birthCounts, survivalCounts));
+            REQUIRE_FALSE(RuleOfExistence_Generations::parseRuleName("/2/17", states, birthCounts, survivalCounts));
+            REQUIRE_FALSE(RuleOfExistence_Generations::parseRuleName("9/2/3", states, birthCounts, survivalCounts));
+            REQUIRE_FALSE(RuleOfExistence_Generations::parseRuleName("B2/C3/S", states, birthCounts, survivalCounts));
+        }
+    }
+}
+
+SCENARIO("Executing Generations rules", "[Generations]")
+{
+    const char* ruleNames[] = { "brians_brain", "star_wars", "23/3/2", "1358/24678/16" };
+
+    for (const char* ruleName : ruleNames) {
+        for (TOPOLOGY topology : { BOUNDED, TORUS }) {
+            GIVEN(string("The rule ") + ruleName + (topology == TORUS ? " on a torus" : " in a bounded world"))
+            {
+                CellGrid cells;
+                fillWorld(cells, topology);
+                int stateCount;
+                uint16_t birthCounts, survivalCounts;
+                REQUIRE(RuleOfExistence_Generations::parseRuleName(ruleName, stateCount, birthCounts, survivalCounts));
+
+                RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, ruleName);
+                RuleOfExistence_Generations* generations = dynamic_cast<RuleOfExistence_Generations*>(rule);
+                REQUIRE(generations != nullptr);
+                REQUIRE(rule->getRuleName() == ruleName);
+
+                WHEN("Several generations are run")
+                {
+                    vector<int> states(70 * 6);
+                    for (int y = 0; y < 6; y++) {
+                        for (int x = 0; x < 70; x++)
+                            states[y * 70 + x] = cells.at(Point{ x + 1, y + 1 }).isAlive();
+                    }
+
+                    THEN("Each state should match stepping the cells one by one")
+                    {
+                        for (int generation = 0; generation < 8; generation++) {
+                            rule->executeRule();
+                            for (int i = 0; i < cells.size(); i++)
+                                cells[i].updateState();
+                            states = stepStates(states, 70, 6, topology == TORUS, stateCount, birthCounts,
+                                                survivalCounts);
+
+                            for (int y = 0; y < 6; y++) {
+                                for (int x = 0; x < 70; x++) {
+                                    int state = states[y * 70 + x];
+                                    Cell& cell = cells.at(Point{ x + 1, y + 1 });
+                                    REQUIRE(generations->getState(x, y) == state);
+                                    REQUIRE(cell.isAlive() == (state == 1));
+                                    if (state == 0)
+                                        REQUIRE(cell.getColor() == STATE_COLORS.DEAD);
+                                    else if (state > 1)
+                                        REQUIRE(cell.getColor() == DYING_COLORS[(state - 2) * 4 / (stateCount - 2)]);
+                                }
+                            }
+                        }
+                    }
+                }
+                delete rule;
+            }
+        }
+    }
+}
@@ -0,0 +1,170 @@
+/**
+ * @file test-RuleOfExistence_LargerThanLife.cpp
+ * @brief Unit tests for the class RuleOfExistence_LargerThanLife
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdlib>
+#include "GoL_Rules/RuleFactory.h"
+#include "GoL_Rules/RuleOfExistence_Conway.h"
+#include "GoL_Rules/RuleOfExistence_LargerThanLife.h"
+
+namespace {
+
+    // A world of 13x9 cells inside a rim, about every third cell alive.
+    void fillWorld(CellGrid& cells, TOPOLOGY topology) {
+        cells.setTopology(topology);
+        cells.reset(15, 11);
+        for (int row = 0; row < 11; row++) {
+            for (int column = 0; column < 15; column++) {
+                bool rim = row == 0 || column == 0 || row == 10 || column == 14;
+                bool alive = (column * 7 + row * 3) % 5 < 2 || (column * row) % 11 == 1;
+                cells[Point{ column, row }] = rim ? Cell(true) : Cell(false, alive ? GIVE_CELL_LIFE : DO_NOTHING);
+            }
+        }
+        cells.refreshHalo();
+    }
+
+    // Counts the neighbours of world position (x, y) one by one.
+    int countNeighbours(CellGrid& cells, const LargerThanLifeLimits& limits, int x, int y) {
+        int width = cells.getColumns() - 2, height = cells.getRows() - 2;
+        int count = 0;
+        for (int dy = -limits.radius; dy <= limits.radius; dy++) {
+            for (int dx = -limits.radius; dx <= limits.radius; dx++) {
+                if (limits.shape == VON_NEUMANN && abs(dx) + abs(dy) > limits.radius)
+                    continue;
+                if (!limits.countsCell && dx == 0 && dy == 0)
+                    continue;
+
+                int column = x + dx, row = y + dy;
+                if (cells.getTopology() == TORUS) {
+                    column = ((column % width) + width) % width;
+                    row = ((row % height) + height) % height;
+                }
+                else if (column < 0 || row < 0 || column >= width || row >= height)
+                    continue;
+                count += cells.at(Point{ column + 1, row + 1 }).isAlive();
+            }
+        }
+        return count;
+    }
+}
+
+SCENARIO("Reading Larger than Life rule names", "[LargerThanLife]")
+{
+    LargerThanLifeLimits limits;
+
+    WHEN("Bosco's rule is given by name")
+    {
+        THEN("Its parameters should be read")
+        {
+            REQUIRE(RuleOfExistence_LargerThanLife::parseRuleName("bosco", limits));
+            REQUIRE(limits.radius == 5);
+            REQUIRE(limits.shape == MOORE);
+            REQUIRE(limits.countsCell == true);
+            REQUIRE(limits.survivalMin == 34);
+            REQUIRE(limits.survivalMax == 58);
+            REQUIRE(limits.birthMin == 34);
+            REQUIRE(limits.birthMax == 45);
+        }
+    }
+
+    WHEN("A von Neumann rule is given in Golly form")
+    {
+        THEN("Its parameters should be read")
+        {
+            REQUIRE(RuleOfExistence_LargerThanLife::parseRuleName("R3,C0,M0,S2..6,B5..7,NN", limits));
+            REQUIRE(limits.radius == 3);
+            REQUIRE(limits.shape == VON_NEUMANN);
+            REQUIRE(limits.countsCell == false);
+            REQUIRE(limits.birthMax == 7);
+        }
+    }
+
+    WHEN("Other names are given")
+    {
+        THEN("They should be rejected")
+        {
+            REQUIRE_FALSE(RuleOfExistence_LargerThanLife::parseRuleName("conway", limits));
+            REQUIRE_FALSE(RuleOfExistence_LargerThanLife::parseRuleName("R0,C0,M0,S2..3,B3..3,NM", limits));
+            REQUIRE_FALSE(RuleOfExistence_LargerThanLife::parseRuleName("R2,C3,M0,S2..3,B3..3,NM", limits));
+            REQUIRE_FALSE(RuleOfExistence_LargerThanLife::parseRuleName("R2,C0,M0,S5..3,B3..3,NM", limits));
+            REQUIRE_FALSE(RuleOfExistence_LargerThanLife::parseRuleName("R2,C0,M0,B3..3,NM", limits));
+        }
+    }
+}
+
+SCENARIO("Executing Larger than Life rules", "[LargerThanLife]")
+{
+    const char* ruleNames[] = { "R2,C0,M0,S3..8,B4..6,NM", "R3,C0,M1,S5..12,B6..9,NN", "R1,C0,M1,S3..4,B3..3,NN" };
+
+    for (const char* ruleName : ruleNames) {
+        for (TOPOLOGY topology : { BOUNDED, TORUS }) {
+            GIVEN(string("The rule ") + ruleName + (topology == TORUS ? " on a torus" : " in a bounded world"))
+            {
+                CellGrid cells;
+                fillWorld(cells, topology);
+                LargerThanLifeLimits limits;
+                REQUIRE(RuleOfExistence_LargerThanLife::parseRuleName(ruleName, limits));
+
+                RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, ruleName);
+                REQUIRE(dynamic_cast<RuleOfExistence_LargerThanLife*>(rule) != nullptr);
+                REQUIRE(rule->getRuleName() == ruleName);
+                REQUIRE(rule->needsCommittedGeneration());
+
+                WHEN("The rule is executed")
+                {
+                    rule->executeRule();
+
+                    THEN("Each action should match counting the neighbours one by one")
+                    {
+                        for (int y = 0; y < 9; y++) {
+                            for (int x = 0; x < 13; x++) {
+                                Cell& cell = cells.at(Point{ x + 1, y + 1 });
+                                int count = countNeighbours(cells, limits, x, y);
+                                ACTION expected;
+                                if (cell.isAlive())
+                                    expected = (count >= limits.survivalMin && count <= limits.survivalMax)
+                                               ? IGNORE_CELL : KILL_CELL;
+                                else
+                                    expected = (count >= limits.birthMin && count <= limits.birthMax)
+                                               ? GIVE_CELL_LIFE : DO_NOTHING;
+                                REQUIRE(cell.getNextGenerationAction() == expected);
+                            }
+                        }
+                    }
+                }
+                delete rule;
+            }
+        }
+    }
+
+    GIVEN("Conway's rule written as a Larger than Life rule")
+    {
+        CellGrid cells, conwayCells;
+        fillWorld(cells, TORUS);
+        fillWorld(conwayCells, TORUS);
+
+        RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, "R1,C0,M0,S2..3,B3..3,NM");
+        RuleOfExistence* conway = RuleFactory::getInstance().createAndReturnRule(conwayCells, "conway");
+
+        WHEN("Both rules are executed")
+        {
+            rule->executeRule();
+            conway->executeRule();
+
+            THEN("They should decide the same actions")
+            {
+                for (int y = 1; y < 10; y++) {
+                    for (int x = 1; x < 14; x++)
+                        REQUIRE(cells.at(Point{ x, y }).getNextGenerationAction()
+                                == conwayCells.at(Point{ x, y }).getNextGenerationAction());
+                }
+            }
+        }
+        delete rule;
+        delete conway;
+    }
+}
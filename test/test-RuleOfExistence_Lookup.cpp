@@ -0,0 +1,129 @@
+/**
+ * @file test-RuleOfExistence_Lookup.cpp
+ * @brief Unit tests and benchmark for the class RuleOfExistence_Lookup
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include "Cell_Culture/Population.h"
+#include "GoL_Rules/RuleFactory.h"
+#include "GoL_Rules/RuleOfExistence_Lookup.h"
+
+namespace {
+
+    // Returns the configuration of a random world.
+    PopulationConfig lookupConfig(Dimensions worldSize, TOPOLOGY topology) {
+        PopulationConfig config;
+        config.worldSize = worldSize;
+        config.seed = 17;
+        config.density = 0.35;
+        config.topology = topology;
+        return config;
+    }
+}
+
+SCENARIO("Tabulating 4x4 blocks", "[Lookup]")
+{
+    GIVEN("Conway's rule looked up")
+    {
+        CellGrid cells;
+        cells.reset(3, 3);
+        RuleOfExistence_Lookup rule(cells, "conway");
+
+        THEN("Empty and full blocks should die out and a row of three turn")
+        {
+            REQUIRE(rule.getNextBlock(0) == 0);
+            REQUIRE(rule.getNextBlock(0xFFFF) == 0);
+            // cells 0 to 2 of row 1 leave cell 1 of row 1 and cell 1 of row 2
+            REQUIRE(rule.getNextBlock(0x0070) == 0x5);
+        }
+
+        THEN("Its action table should be Conway's")
+        {
+            ActionTable table;
+            REQUIRE(rule.getActionTable(table));
+            REQUIRE(table.actions[0][3] == GIVE_CELL_LIFE);
+            REQUIRE(table.actions[1][4] == KILL_CELL);
+        }
+    }
+
+    GIVEN("Rules that can not be tabulated")
+    {
+        CellGrid cells;
+        cells.reset(3, 3);
+
+        THEN("Creating their lookup should throw")
+        {
+            // keep the message about closing the application off the output
+            stringstream output;
+            streambuf* outBuffer = cout.rdbuf(output.rdbuf());
+            REQUIRE_THROWS_AS(RuleOfExistence_Lookup(cells, "erik"), ios_base::failure);
+            REQUIRE_THROWS_AS(RuleOfExistence_Lookup(cells, "brians_brain"), ios_base::failure);
+            cout.rdbuf(outBuffer);
+        }
+    }
+}
+
+SCENARIO("Executing a rule from its lookup table", "[Lookup]")
+{
+    for (TOPOLOGY topology : { BOUNDED, TORUS }) {
+        for (string ruleName : { "conway", "von_neumann", "23/36/2" }) {
+            GIVEN("Populations of odd size run by " + ruleName + " and lookup:" + ruleName)
+            {
+                Population plain(lookupConfig({ 37, 23 }, topology));
+                plain.initiatePopulation(ruleName);
+                Population lookup(lookupConfig({ 37, 23 }, topology));
+                lookup.initiatePopulation("lookup:" + ruleName);
+
+                THEN("Every cell should be alike, generation after generation")
+                {
+                    bool same = true;
+                    for (int generation = 0; generation < 20; generation++) {
+                        REQUIRE(plain.calculateNewGeneration() == lookup.calculateNewGeneration());
+                        for (int i = 0; i < plain.getCells().size(); i++) {
+                            Cell& cell = plain.getCells()[i];
+                            Cell& other = lookup.getCells()[i];
+                            if (cell.isAlive() != other.isAlive() || cell.getAge() != other.getAge()
+                                || cell.getColor() != other.getColor())
+                                same = false;
+                        }
+                    }
+                    REQUIRE(same);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Timing a lookup rule against the rule it runs", "[.][benchmark]")
+{
+    GIVEN("Populations of 1024x1024 cells run by conway and lookup:conway")
+    {
+        Population plain(lookupConfig({ 1024, 1024 }, TORUS));
+        plain.initiatePopulation("conway");
+        Population lookup(lookupConfig({ 1024, 1024 }, TORUS));
+        lookup.initiatePopulation("lookup:conway");
+
+        THEN("Both should reach the same generation, and their times are reported")
+        {
+            double seconds[2];
+            Population* populations[2] = { &plain, &lookup };
+            for (int i = 0; i < 2; i++) {
+                auto start = chrono::steady_clock::now();
+                for (int generation = 0; generation < 100; generation++)
+                    populations[i]->calculateNewGeneration();
+                seconds[i] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            }
+
+            vector<uint64_t> plainBoard(1024 * 16), lookupBoard(1024 * 16);
+            plain.readRegion(0, 0, 1024, 1024, plainBoard.data(), 16);
+            lookup.readRegion(0, 0, 1024, 1024, lookupBoard.data(), 16);
+            REQUIRE(plainBoard == lookupBoard);
+            WARN("100 generations: per cell " << seconds[0] << " s, lookup " << seconds[1] << " s");
+        }
+    }
+}
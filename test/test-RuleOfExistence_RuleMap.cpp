@@ -0,0 +1,98 @@
+/**
+ * @file test-RuleOfExistence_RuleMap.cpp
+ * @brief Unit tests for the class RuleOfExistence_RuleMap
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "GoL_Rules/RuleFactory.h"
+#include "GoL_Rules/RuleOfExistence_RuleMap.h"
+
+namespace {
+
+    // A world of 20x8 cells inside a rim or halo.
+    void fillWorld(CellGrid& cells, TOPOLOGY topology) {
+        cells.setTopology(topology);
+        cells.reset(22, 10);
+        for (int row = 0; row < 10; row++) {
+            for (int column = 0; column < 22; column++) {
+                bool rim = row == 0 || column == 0 || row == 9 || column == 21;
+                bool alive = (column * 5 + row * 3) % 7 < 3;
+                cells[Point{ column, row }] = rim ? Cell(true) : Cell(false, alive ? GIVE_CELL_LIFE : DO_NOTHING);
+            }
+        }
+    }
+
+    // Runs the named rule for one generation.
+    void runRule(CellGrid& cells, const string& ruleName) {
+        if (cells.getTopology() == TORUS)
+            cells.refreshHalo();
+        RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, ruleName);
+        rule->executeRule();
+        delete rule;
+        for (int i = 0; i < cells.size(); i++)
+            cells[i].updateState();
+    }
+}
+
+SCENARIO("Executing a rule map", "[RuleMap]")
+{
+    for (TOPOLOGY topology : { BOUNDED, TORUS }) {
+        GIVEN(string("A map of Conway's rule left of Von Neumann's") + (topology == TORUS ? " on a torus" : " in a bounded world"))
+        {
+            CellGrid cells;
+            fillWorld(cells, topology);
+
+            THEN("Each half should match running its rule on the whole world")
+            {
+                for (int generation = 0; generation < 6; generation++) {
+                    CellGrid conway = cells, vonNeumann = cells;
+                    runRule(conway, "conway");
+                    runRule(vonNeumann, "von_neumann");
+                    runRule(cells, "map:test/populations/regions.txt");
+
+                    for (int row = 1; row < 9; row++) {
+                        for (int column = 1; column < 21; column++) {
+                            CellGrid& expected = (column <= 10) ? conway : vonNeumann;
+                            REQUIRE(cells.at(Point{ column, row }).isAlive() == expected.at(Point{ column, row }).isAlive());
+                            REQUIRE(cells.at(Point{ column, row }).getColor() == expected.at(Point{ column, row }).getColor());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN("A map stretched over the world")
+    {
+        CellGrid cells;
+        fillWorld(cells, BOUNDED);
+        RuleOfExistence_RuleMap rule(cells, "test/populations/regions.txt");
+        rule.executeRule();
+
+        THEN("The left half should follow the first rule and the right half the second")
+        {
+            REQUIRE(rule.getRuleId(1 * 22 + 1) == 0);
+            REQUIRE(rule.getRuleId(1 * 22 + 10) == 0);
+            REQUIRE(rule.getRuleId(1 * 22 + 11) == 1);
+            REQUIRE(rule.getRuleId(8 * 22 + 20) == 1);
+        }
+    }
+
+    GIVEN("A map that can not be read")
+    {
+        CellGrid cells;
+        fillWorld(cells, BOUNDED);
+
+        THEN("Missing and malformed maps should be rejected")
+        {
+            REQUIRE_THROWS_AS(RuleOfExistence_RuleMap(cells, "test/populations/missing.txt"), ios_base::failure);
+            REQUIRE_THROWS_AS(RuleOfExistence_RuleMap(cells, "test/populations/bad.txt"), ios_base::failure);
+        }
+        THEN("Rules without an action table should be rejected")
+        {
+            REQUIRE_THROWS_AS(RuleOfExistence_RuleMap(cells, "test/populations/erik_map.txt"), ios_base::failure);
+        }
+    }
+}
@@ -14,7 +14,7 @@ SCENARIO("RuleOfExistence_VonNeumann testcase1", "[von_neumann]")
 {
 	GIVEN("Spare population upgrade")
 	{
-		std::map<Point, Cell> cells;
+		CellGrid cells;
 		RuleFactory test = RuleFactory::getInstance();
 
 		WHEN("Cell values are set as [0 0;1 0]")
@@ -73,7 +73,7 @@ SCENARIO("RuleOfExistence_VonNeumann testcase2", "[von_neumann]")
 {
 	GIVEN("Dense population upgrade")
 	{
-		std::map<Point, Cell> cells;
+		CellGrid cells;
 		RuleFactory test = RuleFactory::getInstance();
 
 		WHEN("Cell values are set as [1 1;1 0]")
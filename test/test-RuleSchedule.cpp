@@ -0,0 +1,77 @@
+/**
+ * @file test-RuleSchedule.cpp
+ * @brief Unit tests for the class RuleSchedule.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include "GoL_Rules/RuleSchedule.h"
+
+SCENARIO("Writing rule schedules", "[RuleSchedule]") {
+  GIVEN("An empty schedule") {
+    RuleSchedule schedule;
+
+    WHEN("A schedule with counts is parsed") {
+      REQUIRE(schedule.parse("conway*100; von_neumann*5;R5,C0,M1,S34..58,B34..45,NM"));
+
+      THEN("Each entry should hold its rule and count, one by default") {
+        REQUIRE(schedule.getEntries().size() == 3);
+        REQUIRE(schedule.getEntries()[0].ruleName == "conway");
+        REQUIRE(schedule.getEntries()[0].generations == 100);
+        REQUIRE(schedule.getEntries()[1].ruleName == "von_neumann");
+        REQUIRE(schedule.getEntries()[1].generations == 5);
+        REQUIRE(schedule.getEntries()[2].ruleName == "R5,C0,M1,S34..58,B34..45,NM");
+        REQUIRE(schedule.getEntries()[2].generations == 1);
+        REQUIRE(schedule.getPeriod() == 106);
+      }
+    }
+
+    WHEN("Malformed schedules are parsed") {
+      THEN("They should be rejected and leave the schedule empty") {
+        REQUIRE_FALSE(schedule.parse(""));
+        REQUIRE_FALSE(schedule.parse("conway*0"));
+        REQUIRE_FALSE(schedule.parse("conway*x;erik"));
+        REQUIRE_FALSE(schedule.parse("*3"));
+        REQUIRE(schedule.empty());
+      }
+    }
+
+    WHEN("A schedule is read from a file") {
+      const char* path = "test-schedule.txt";
+      {
+        std::ofstream file(path);
+        file << "# warm up\nconway*10\n\nerik*2; von_neumann # and back\n";
+      }
+      bool loaded = schedule.loadFromFile(path);
+      std::remove(path);
+
+      THEN("Lines and semicolons should separate the entries") {
+        REQUIRE(loaded);
+        REQUIRE(schedule.getEntries().size() == 3);
+        REQUIRE(schedule.getEntries()[1].ruleName == "erik");
+        REQUIRE(schedule.getEntries()[2].ruleName == "von_neumann");
+        REQUIRE(schedule.getPeriod() == 13);
+      }
+    }
+
+    WHEN("The file does not exist") {
+      THEN("Loading should fail") {
+        REQUIRE_FALSE(schedule.loadFromFile("no-such-schedule.txt"));
+      }
+    }
+  }
+
+  GIVEN("A schedule of an even and an odd rule") {
+    RuleSchedule schedule("erik", "");
+
+    THEN("The rules should alternate, the odd one defaulting to the even one") {
+      REQUIRE(schedule.getEntries().size() == 2);
+      REQUIRE(schedule.getEntries()[0].ruleName == "erik");
+      REQUIRE(schedule.getEntries()[1].ruleName == "erik");
+      REQUIRE(schedule.getPeriod() == 2);
+    }
+  }
+}
@@ -0,0 +1,78 @@
+/**
+ * @file test-RunCache.cpp
+ * @brief Unit tests for the class RunCache.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdlib>
+#include <unistd.h>
+#include "Library/RunCache.h"
+
+namespace {
+
+  // A cache entry of a 70x3 world with a few cells set.
+  CachedBoard makeEntry(uint64_t generation) {
+    CachedBoard entry;
+    entry.generation = generation;
+    entry.worldSize = {70, 3};
+    entry.wordsPerRow = 2;
+    entry.board = {1, 0, 0, 1ULL << 5, generation, 0};
+    entry.livingCells = 3;
+    return entry;
+  }
+}
+
+SCENARIO("Keying runs", "[RunCache]") {
+  GIVEN("The key of a run") {
+    RuleSchedule conway("conway", "");
+    vector<uint64_t> board{5, 7, 9};
+    string key = RunCache::getRunKey(board, {64, 3}, BOUNDED, conway);
+
+    THEN("It should be the same for the same run and differ otherwise") {
+      REQUIRE(key.size() == 16);
+      RuleSchedule written;
+      REQUIRE(written.parse("conway*1"));
+      REQUIRE(RunCache::getRunKey(board, {64, 3}, BOUNDED, written) == key);
+
+      vector<uint64_t> changed{5, 7, 8};
+      REQUIRE(RunCache::getRunKey(changed, {64, 3}, BOUNDED, conway) != key);
+      REQUIRE(RunCache::getRunKey(board, {64, 3}, TORUS, conway) != key);
+      REQUIRE(RunCache::getRunKey(board, {64, 3}, BOUNDED, RuleSchedule("von_neumann", "")) != key);
+    }
+  }
+}
+
+SCENARIO("Storing and finding generations", "[RunCache]") {
+  GIVEN("A cache holding generations 10 and 20 of a run") {
+    char directory[] = "/tmp/gameoflife-cache-XXXXXX";
+    REQUIRE(mkdtemp(directory) != nullptr);
+    RunCache cache(string(directory) + "/cache");
+    RuleSchedule conway("conway", "");
+    REQUIRE(cache.store("0123456789abcdef", TORUS, conway, makeEntry(10)));
+    REQUIRE(cache.store("0123456789abcdef", TORUS, conway, makeEntry(20)));
+
+    THEN("The latest generation in range should be read back") {
+      CachedBoard entry;
+      REQUIRE(cache.findLatest("0123456789abcdef", {70, 3}, TORUS, conway, 1, 15, entry));
+      REQUIRE(entry.generation == 10);
+      REQUIRE(cache.findLatest("0123456789abcdef", {70, 3}, TORUS, conway, 1, 100, entry));
+      REQUIRE(entry.generation == 20);
+      REQUIRE(entry.board == makeEntry(20).board);
+      REQUIRE(entry.livingCells == 3);
+      REQUIRE_FALSE(cache.findLatest("0123456789abcdef", {70, 3}, TORUS, conway, 21, 100, entry));
+    }
+
+    THEN("Entries of another run with the same key should be rejected") {
+      CachedBoard entry;
+      REQUIRE_FALSE(cache.findLatest("0123456789abcdef", {70, 3}, BOUNDED, conway, 1, 100, entry));
+      REQUIRE_FALSE(cache.findLatest("0123456789abcdef", {71, 3}, TORUS, conway, 1, 100, entry));
+      REQUIRE_FALSE(cache.findLatest("0123456789abcdef", {70, 3}, TORUS, RuleSchedule("erik", ""), 1, 100, entry));
+      REQUIRE_FALSE(cache.findLatest("fedcba9876543210", {70, 3}, TORUS, conway, 1, 100, entry));
+    }
+
+    string command = "rm -rf " + string(directory);
+    REQUIRE(system(command.c_str()) == 0);
+  }
+}
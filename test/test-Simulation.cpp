@@ -0,0 +1,191 @@
+/**
+ * @file test-Simulation.cpp
+ * @brief Unit tests for Simulation and the C interface of libgameoflife.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdlib>
+#include <unistd.h>
+#include <vector>
+#include "Library/gameoflife.h"
+#include "Library/Simulation.h"
+
+SCENARIO("Stepping a simulation through the C interface", "[Simulation]") {
+  GIVEN("A simulation of a random 40x25 torus and a Population of the same seed") {
+    gol_simulation* simulation = nullptr;
+    REQUIRE(gol_create("conway*2;von_neumann", 40, 25, 9, 0.4, 1, &simulation) == GOL_OK);
+    REQUIRE(simulation != nullptr);
+
+    PopulationConfig config;
+    config.worldSize = {40, 25};
+    config.seed = 9;
+    config.density = 0.4;
+    config.topology = TORUS;
+    RuleSchedule ruleSchedule;
+    REQUIRE(ruleSchedule.parse("conway*2;von_neumann"));
+    Population population(config);
+    population.initiatePopulation(ruleSchedule);
+
+    WHEN("Both are stepped 7 generations") {
+      REQUIRE(gol_step(simulation, 3) == GOL_OK);
+      REQUIRE(gol_step(simulation, 4) == GOL_OK);
+
+      // a generation is committed when the next one is calculated
+      for (int generation = 0; generation < 8; generation++)
+        population.calculateNewGeneration();
+
+      THEN("The whole world and the stats should match the population") {
+        vector<uint8_t> cells(40 * 25);
+        REQUIRE(gol_query_region(simulation, 0, 0, 40, 25, cells.data()) == GOL_OK);
+
+        uint64_t livingCells = 0;
+        for (int row = 0; row < 25; row++) {
+          for (int column = 0; column < 40; column++) {
+            bool alive = population.getCellAtPosition(Point{column + 1, row + 1}).isAlive();
+            REQUIRE(cells[row * 40 + column] == alive);
+            livingCells += alive;
+          }
+        }
+
+        gol_stats stats;
+        REQUIRE(gol_get_stats(simulation, &stats) == GOL_OK);
+        REQUIRE(stats.generation == 7);
+        REQUIRE(stats.living_cells == livingCells);
+        REQUIRE(stats.width == 40);
+        REQUIRE(stats.height == 25);
+      }
+
+      THEN("A region should hold the cells at its position") {
+        vector<uint8_t> region(5 * 3, 2);
+        REQUIRE(gol_query_region(simulation, 35, 22, 5, 3, region.data()) == GOL_OK);
+        for (int row = 0; row < 3; row++) {
+          for (int column = 0; column < 5; column++)
+            REQUIRE(region[row * 5 + column]
+                    == population.getCellAtPosition(Point{column + 36, row + 23}).isAlive());
+        }
+      }
+
+      THEN("Regions reaching outside the world should be rejected") {
+        vector<uint8_t> region(4);
+        REQUIRE(gol_query_region(simulation, 38, 0, 4, 1, region.data()) == GOL_ERROR_ARGUMENT);
+        REQUIRE(gol_query_region(simulation, 0, -1, 1, 1, region.data()) == GOL_ERROR_ARGUMENT);
+      }
+    }
+
+    gol_destroy(simulation);
+  }
+
+  GIVEN("Invalid requests") {
+    gol_simulation* simulation = nullptr;
+
+    THEN("They should fail with a status and leave no simulation") {
+      REQUIRE(gol_create("conway*x", 10, 10, 1, 0.5, 0, &simulation) == GOL_ERROR_RULES);
+      REQUIRE(simulation == nullptr);
+      REQUIRE(gol_create("conwy", 10, 10, 1, 0.5, 0, &simulation) == GOL_ERROR_RULES);
+      REQUIRE(simulation == nullptr);
+      REQUIRE(gol_create("conway;vonneumann", 10, 10, 1, 0.5, 0, &simulation) == GOL_ERROR_RULES);
+      REQUIRE(simulation == nullptr);
+      REQUIRE(gol_create("conway", 0, 10, 1, 0.5, 0, &simulation) == GOL_ERROR_ARGUMENT);
+      REQUIRE(simulation == nullptr);
+      REQUIRE(gol_load(nullptr, "test/populations/doesNotExist.txt", 0, &simulation) == GOL_ERROR_FILE);
+      REQUIRE(simulation == nullptr);
+      REQUIRE(gol_step(nullptr, 1) == GOL_ERROR_ARGUMENT);
+      REQUIRE(gol_api_version() == GOL_API_VERSION);
+    }
+  }
+}
+
+SCENARIO("Loading a simulation from a population file", "[Simulation]") {
+  GIVEN("A simulation of good.txt") {
+    gol_simulation* simulation = nullptr;
+    REQUIRE(gol_load(nullptr, "test/populations/good.txt", 0, &simulation) == GOL_OK);
+
+    THEN("It should have the size and cells of the file before stepping") {
+      gol_stats stats;
+      REQUIRE(gol_get_stats(simulation, &stats) == GOL_OK);
+      REQUIRE(stats.width == 5);
+      REQUIRE(stats.height == 5);
+      REQUIRE(stats.generation == 0);
+
+      uint8_t cell = 0;
+      REQUIRE(gol_query_region(simulation, 0, 1, 1, 1, &cell) == GOL_OK);
+      REQUIRE(cell == 1);
+    }
+
+    gol_destroy(simulation);
+  }
+}
+
+SCENARIO("Stepping simulations through a run cache", "[Simulation]") {
+  GIVEN("An empty cache and a simulation of a random 70x30 torus stepped without it") {
+    char directory[] = "/tmp/gameoflife-cache-XXXXXX";
+    REQUIRE(mkdtemp(directory) != nullptr);
+    RunCache cache(directory);
+
+    PopulationConfig config;
+    config.worldSize = {70, 30};
+    config.seed = 3;
+    config.density = 0.35;
+    config.topology = TORUS;
+    RuleSchedule ruleSchedule;
+    REQUIRE(ruleSchedule.parse("conway*2;von_neumann"));
+
+    Simulation uncached(config, ruleSchedule);
+    vector<uint8_t> expected30(70 * 30), expected50(70 * 30), cells(70 * 30);
+    uncached.step(30);
+    uncached.readRegion(0, 0, 70, 30, expected30.data());
+    uncached.step(20);
+    uncached.readRegion(0, 0, 70, 30, expected50.data());
+
+    WHEN("One cached simulation runs to 30 generations and another to 50") {
+      Simulation first(config, ruleSchedule);
+      first.setCache(&cache, 16);
+      first.step(30);
+      first.readRegion(0, 0, 70, 30, cells.data());
+      REQUIRE(cells == expected30);
+
+      gol_simulation* second = nullptr;
+      REQUIRE(gol_create("conway*2;von_neumann", 70, 30, 3, 0.35, 1, &second) == GOL_OK);
+      REQUIRE(gol_set_cache(second, directory, 16) == GOL_OK);
+      REQUIRE(gol_step(second, 50) == GOL_OK);
+
+      THEN("The second should resume from the first and reach the same world") {
+        gol_stats stats;
+        REQUIRE(gol_get_stats(second, &stats) == GOL_OK);
+        REQUIRE(stats.generation == 50);
+        REQUIRE(gol_query_region(second, 0, 0, 70, 30, cells.data()) == GOL_OK);
+        REQUIRE(cells == expected50);
+
+        vector<uint64_t> board;
+        CachedBoard entry;
+        Simulation third(config, ruleSchedule);
+        third.setCache(&cache);
+        vector<uint64_t> firstBoard((70 + 63) / 64 * 30);
+        for (int row = 0; row < 30; row++)
+          for (int column = 0; column < 70; column++)
+            if (third.isAlive(column, row))
+              firstBoard[row * 2 + column / 64] |= 1ULL << (column % 64);
+        string runKey = RunCache::getRunKey(firstBoard, {70, 30}, TORUS, ruleSchedule);
+        for (uint64_t generation : {16, 30, 32, 48, 50}) {
+          REQUIRE(cache.findLatest(runKey, {70, 30}, TORUS, ruleSchedule, generation, generation, entry));
+          REQUIRE(entry.generation == generation);
+        }
+
+        // a run that is cached is read rather than simulated
+        entry.board.assign(entry.board.size(), 0);
+        entry.generation = 40;
+        REQUIRE(cache.store(runKey, TORUS, ruleSchedule, entry));
+        third.step(40);
+        REQUIRE(third.getGeneration() == 40);
+        REQUIRE(third.countLivingCells() == 0);
+      }
+
+      gol_destroy(second);
+    }
+
+    string command = "rm -rf " + string(directory);
+    REQUIRE(system(command.c_str()) == 0);
+  }
+}
@@ -0,0 +1,193 @@
+/**
+ * @file test-SimulationServer.cpp
+ * @brief Unit tests for the class SimulationServer.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "Library/Simulation.h"
+#include "Server/SimulationServer.h"
+
+namespace {
+
+  // Sends the requests and reads lines until expected lines have arrived.
+  vector<string> exchange(const string& socketPath, const string& requests, int expected) {
+    int client = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    REQUIRE(connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(write(client, requests.data(), requests.size()) == static_cast<ssize_t>(requests.size()));
+
+    vector<string> lines;
+    string received;
+    char buffer[256];
+    while (static_cast<int>(lines.size()) < expected) {
+      ssize_t count = read(client, buffer, sizeof(buffer));
+      if (count <= 0)
+        break;
+      received.append(buffer, count);
+      size_t lineEnd;
+      while ((lineEnd = received.find('\n')) != string::npos) {
+        lines.push_back(received.substr(0, lineEnd));
+        received.erase(0, lineEnd + 1);
+      }
+    }
+    close(client);
+    return lines;
+  }
+
+  // The result line a job of a randomized world should get.
+  string expectedResult(string id, Dimensions size, uint64_t seed, double density, TOPOLOGY topology, string rules,
+                        int generations) {
+    PopulationConfig config;
+    config.worldSize = size;
+    config.seed = seed;
+    config.density = density;
+    config.topology = topology;
+    RuleSchedule ruleSchedule;
+    ruleSchedule.parse(rules);
+    Simulation simulation(config, ruleSchedule);
+    simulation.step(generations);
+    return "done " + id + " generation=" + to_string(generations) + " living="
+           + to_string(simulation.countLivingCells());
+  }
+}
+
+SCENARIO("Reading jobs from request lines", "[SimulationServer]") {
+  GIVEN("Requests with all, some and bad fields") {
+    ServerJob job;
+    string error;
+
+    THEN("The fields should be read and the others defaulted") {
+      REQUIRE(SimulationServer::parseJob("run id=a seed=5 generations=7 size=30x20 density=0.25 topology=torus "
+                                         "rules=conway*2;erik", job, error));
+      REQUIRE(job.id == "a");
+      REQUIRE(job.config.seed == 5);
+      REQUIRE(job.generations == 7);
+      REQUIRE(job.config.worldSize.WIDTH == 30);
+      REQUIRE(job.config.worldSize.HEIGHT == 20);
+      REQUIRE(job.config.density == 0.25);
+      REQUIRE(job.config.topology == TORUS);
+      REQUIRE(job.ruleSchedule.getEntries().size() == 2);
+
+      REQUIRE(SimulationServer::parseJob("run id=b", job, error));
+      REQUIRE(job.generations == 100);
+      REQUIRE(job.config.worldSize.WIDTH == 80);
+      REQUIRE(job.rules == "conway");
+    }
+
+    THEN("Bad requests should be rejected") {
+      REQUIRE_FALSE(SimulationServer::parseJob("walk id=a", job, error));
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a size=0x5", job, error));
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a generations=-1", job, error));
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a seed=12x", job, error));
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a colour=red", job, error));
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a rules=conway*x", job, error));
+      REQUIRE(error == "bad rule schedule");
+    }
+
+    THEN("Jobs beyond the limits should be rejected as too large") {
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a size=65536x65536 generations=0", job, error));
+      REQUIRE(error == "too large");
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a size=4096x4096 generations=16777216", job, error));
+      REQUIRE(error == "too large");
+      REQUIRE(SimulationServer::parseJob("run id=a size=4096x4096 generations=1024", job, error));
+
+      REQUIRE(SimulationServer::parseJob("run id=a size=10x10 generations=10", job, error, 100, 1000));
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a size=11x10 generations=1", job, error, 100, 1000));
+      REQUIRE(error == "too large");
+      REQUIRE_FALSE(SimulationServer::parseJob("run id=a size=10x10 generations=11", job, error, 100, 1000));
+      REQUIRE(error == "too large");
+    }
+  }
+}
+
+SCENARIO("Serving jobs over a Unix domain socket", "[SimulationServer]") {
+  GIVEN("A running server batching jobs below 5000 cell generations") {
+    string socketPath = "/tmp/gameoflife-test-" + to_string(getpid()) + ".sock";
+    SimulationServer server(socketPath, 5000);
+    server.setJobLimits(100000, 100000);
+    REQUIRE(server.start());
+    thread serving([&server]() { server.run(); });
+
+    WHEN("Small, large, repeated, bad and too large jobs are sent at once") {
+      ostringstream requests;
+      requests << "run id=small1 seed=1 generations=10 size=20x20 density=0.4 rules=conway\n"
+               << "run id=small2 seed=2 generations=10 size=20x20 density=0.4 rules=conway\n"
+               << "run id=large seed=3 generations=20 size=64x64 density=0.3 topology=torus rules=conway*2;von_neumann\n"
+               << "run id=bad size=x\n"
+               << "run id=huge size=400x400 generations=0\n"
+               << "run id=stars seed=4 generations=12 size=20x20 rules=345/2/4\n"
+               << "run id=small1again seed=1 generations=10 size=20x20 density=0.4 rules=conway\n"
+               << "run id=stars2 seed=5 generations=12 size=20x20 rules=345/2/4\n"
+               << "quit\n";
+      vector<string> lines = exchange(socketPath, requests.str(), 8);
+
+      THEN("Every job should get its result, as if run on its own") {
+        map<string, string> results;
+        for (const string& line : lines) {
+          istringstream words(line);
+          string status, id;
+          words >> status >> id;
+          results[id] = line;
+        }
+        REQUIRE(lines.size() == 8);
+        REQUIRE(results["small1"] == expectedResult("small1", {20, 20}, 1, 0.4, BOUNDED, "conway", 10));
+        REQUIRE(results["small2"] == expectedResult("small2", {20, 20}, 2, 0.4, BOUNDED, "conway", 10));
+        REQUIRE(results["large"] == expectedResult("large", {64, 64}, 3, 0.3, TORUS, "conway*2;von_neumann", 20));
+        REQUIRE(results["small1again"] == expectedResult("small1again", {20, 20}, 1, 0.4, BOUNDED, "conway", 10));
+        REQUIRE(results["stars"] == expectedResult("stars", {20, 20}, 4, 0.5, BOUNDED, "345/2/4", 12));
+        REQUIRE(results["stars2"] == expectedResult("stars2", {20, 20}, 5, 0.5, BOUNDED, "345/2/4", 12));
+        REQUIRE(results["bad"] == "error bad bad value for size");
+        REQUIRE(results["huge"] == "error huge too large");
+      }
+    }
+
+    server.stop();
+    serving.join();
+  }
+}
+
+SCENARIO("Serving jobs from a run cache", "[SimulationServer]") {
+  GIVEN("A running server with a cache") {
+    char directory[] = "/tmp/gameoflife-cache-XXXXXX";
+    REQUIRE(mkdtemp(directory) != nullptr);
+    string socketPath = "/tmp/gameoflife-test-cache-" + to_string(getpid()) + ".sock";
+    SimulationServer server(socketPath);
+    server.setCache(directory, 8);
+    REQUIRE(server.start());
+    thread serving([&server]() { server.run(); });
+
+    WHEN("A job is sent, then the same job and a longer one") {
+      vector<string> first = exchange(socketPath, "run id=a seed=6 generations=20 size=30x30 rules=conway\nquit\n", 1);
+      vector<string> second = exchange(socketPath, "run id=a seed=6 generations=20 size=30x30 rules=conway\n"
+                                                   "run id=b seed=6 generations=35 size=30x30 rules=conway\nquit\n", 2);
+
+      THEN("The results should be those of uncached jobs") {
+        string expected = expectedResult("a", {30, 30}, 6, 0.5, BOUNDED, "conway", 20);
+        REQUIRE(first.size() == 1);
+        REQUIRE(first[0] == expected);
+        REQUIRE(second.size() == 2);
+        REQUIRE((second[0] == expected || second[1] == expected));
+        string longer = expectedResult("b", {30, 30}, 6, 0.5, BOUNDED, "conway", 35);
+        REQUIRE((second[0] == longer || second[1] == longer));
+      }
+    }
+
+    server.stop();
+    serving.join();
+    string command = "rm -rf " + string(directory);
+    REQUIRE(system(command.c_str()) == 0);
+  }
+}
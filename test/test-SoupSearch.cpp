@@ -0,0 +1,101 @@
+/**
+ * @file test-SoupSearch.cpp
+ * @brief Unit tests for the class SoupSearch.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "Experiments/SoupSearch.h"
+
+SCENARIO("Searching soups", "[SoupSearch]") {
+  GIVEN("Two searches of 16x16 soups with the same base seed") {
+    PopulationConfig config;
+    config.worldSize = {16, 16};
+    config.seed = 42;
+
+    SoupSearch first(8, 500, "conway", "conway", config);
+    SoupSearch second(8, 500, "conway", "conway", config);
+    first.runSearch();
+    second.runSearch();
+
+    THEN("Every soup should have been simulated") {
+      REQUIRE(first.getResults().size() == 8);
+      for (const SoupResult& result : first.getResults())
+        REQUIRE(result.generations > 0);
+    }
+
+    THEN("Each soup should get a seed of its own") {
+      REQUIRE(first.getResults()[0].seed != first.getResults()[1].seed);
+      REQUIRE(first.getResults()[0].seed == SoupSearch::getSoupSeed(42, 0));
+    }
+
+    THEN("The searches should give identical results") {
+      REQUIRE(first.getCensus().getObjectCounts() == second.getCensus().getObjectCounts());
+      REQUIRE(first.getStabilizedSoups() == second.getStabilizedSoups());
+      for (int i = 0; i < 8; i++) {
+        REQUIRE(first.getResults()[i].generations == second.getResults()[i].generations);
+        REQUIRE(first.getResults()[i].period == second.getResults()[i].period);
+      }
+    }
+  }
+}
+
+SCENARIO("Searching soups in lanes", "[SoupSearch]") {
+  GIVEN("Searches of 150 soups on a 20x20 torus, by a rule and by a schedule") {
+    PopulationConfig config;
+    config.worldSize = {20, 20};
+    config.seed = 7;
+    config.density = 0.4;
+    config.topology = TORUS;
+
+    for (string rules : {"conway", "conway*3;von_neumann"}) {
+      RuleSchedule schedule;
+      REQUIRE(schedule.parse(rules));
+
+      SoupSearch lanes(150, 300, schedule, config);
+      SoupSearch populations(150, 300, schedule, config);
+      populations.setLaneParallel(false);
+      lanes.runSearch();
+      populations.runSearch();
+
+      THEN("Running soups in lanes should give the outcome of running them one by one") {
+        REQUIRE(lanes.getCensus().getObjectCounts() == populations.getCensus().getObjectCounts());
+        for (int i = 0; i < 150; i++) {
+          REQUIRE(lanes.getResults()[i].seed == populations.getResults()[i].seed);
+          REQUIRE(lanes.getResults()[i].stabilized == populations.getResults()[i].stabilized);
+          REQUIRE(lanes.getResults()[i].generations == populations.getResults()[i].generations);
+          REQUIRE(lanes.getResults()[i].period == populations.getResults()[i].period);
+        }
+      }
+    }
+  }
+
+  GIVEN("A schedule with a rule that can not run in lanes") {
+    vector<LaneRule> rules;
+    vector<int> entryRules;
+
+    THEN("It should be rejected, and equal rules should share a lane rule") {
+      REQUIRE_FALSE(SoupSearch::getLaneRules(RuleSchedule("conway", "erik"), rules, entryRules));
+      REQUIRE(SoupSearch::getLaneRules(RuleSchedule("conway", "von_neumann"), rules, entryRules));
+      REQUIRE(rules.size() == 2);
+      REQUIRE(SoupSearch::getLaneRules(RuleSchedule("conway", "conway"), rules, entryRules));
+      REQUIRE(rules.size() == 1);
+      REQUIRE(entryRules == vector<int>{0, 0});
+    }
+  }
+}
+
+SCENARIO("Hashing the states of a soup", "[SoupSearch]") {
+  GIVEN("Bitmaps that differ only in the highest bit of some words") {
+    const uint64_t high = 1ULL << 63;
+    const uint64_t first[4] = {high, 0, 0, 0}, last[4] = {0, 0, 0, high};
+    const uint64_t pair[4] = {high, high, 0, 0}, empty[4] = {0, 0, 0, 0};
+
+    THEN("Their hashes should differ") {
+      REQUIRE(SoupSearch::hashBitmap(first, 4) != SoupSearch::hashBitmap(last, 4));
+      REQUIRE(SoupSearch::hashBitmap(pair, 4) != SoupSearch::hashBitmap(empty, 4));
+      REQUIRE(SoupSearch::hashBitmap(first, 4) == SoupSearch::hashBitmap(first, 4));
+    }
+  }
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test-SummedAreaTable.cpp
+ * @brief Unit tests for the class SummedAreaTable.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include <cstdlib>
+#include "Cell_Culture/SummedAreaTable.h"
+
+SCENARIO("Counting cells with a SummedAreaTable", "[SummedAreaTable]") {
+  GIVEN("A world of 6x4 cells inside a rim") {
+    CellGrid cells;
+    cells.reset(8, 6);
+    cells[Point{1, 1}] = Cell(false, GIVE_CELL_LIFE);
+    cells[Point{3, 2}] = Cell(false, GIVE_CELL_LIFE);
+    cells[Point{6, 4}] = Cell(false, GIVE_CELL_LIFE);
+    cells[Point{0, 2}] = Cell(true);
+
+    WHEN("The table is built for a bounded world") {
+      SummedAreaTable table;
+      table.build(cells);
+
+      THEN("Sums should match counting the cells one by one") {
+        REQUIRE(table.getWidth() == 6);
+        REQUIRE(table.getHeight() == 4);
+        for (int top = 0; top < 4; top++) {
+          for (int left = 0; left < 6; left++) {
+            for (int bottom = top; bottom < 4; bottom++) {
+              for (int right = left; right < 6; right++) {
+                int expected = 0;
+                for (int y = top; y <= bottom; y++) {
+                  for (int x = left; x <= right; x++)
+                    expected += cells.at(Point{x + 1, y + 1}).isAlive();
+                }
+                REQUIRE(table.sum(left, top, right, bottom) == expected);
+              }
+            }
+          }
+        }
+      }
+
+      THEN("Rectangles reaching outside the world should be clipped") {
+        REQUIRE(table.sum(-3, -3, 0, 0) == 1);
+        REQUIRE(table.sum(4, 2, 10, 10) == 1);
+        REQUIRE(table.sum(-10, -10, 10, 10) == 3);
+        REQUIRE(table.sum(7, 0, 9, 3) == 0);
+      }
+    }
+
+    WHEN("The table is built for a torus") {
+      cells.setTopology(TORUS);
+      SummedAreaTable table;
+      table.build(cells);
+
+      THEN("Rectangles reaching outside the world should wrap around") {
+        REQUIRE(table.sum(-1, -1, 0, 0) == 2);
+        REQUIRE(table.sum(5, 3, 6, 4) == 2);
+        REQUIRE(table.sum(-7, 0, 0, 0) == 1);
+        REQUIRE(table.sum(-10, -10, 10, 10) == 3);
+      }
+    }
+
+    for (TOPOLOGY topology : { BOUNDED, TORUS }) {
+      WHEN(string(topology == TORUS ? "Diamonds are counted on a torus" : "Diamonds are counted in a bounded world")) {
+        cells.setTopology(topology);
+
+        THEN("Sums should match counting each cell within the radius once") {
+          // up to radii wider and taller than the torus, which must not count
+          // the cells they overlap twice
+          for (int radius = 0; radius <= 6; radius++) {
+            SummedAreaTable table;
+            table.buildDiamonds(cells, radius);
+            for (int row = 0; row < 4; row++) {
+              for (int column = 0; column < 6; column++) {
+                int expected = 0;
+                for (int y = 0; y < 4; y++) {
+                  for (int x = 0; x < 6; x++) {
+                    int dx = abs(x - column), dy = abs(y - row);
+                    if (topology == TORUS) {
+                      dx = min(dx, 6 - dx);
+                      dy = min(dy, 4 - dy);
+                    }
+                    if (dx + dy <= radius)
+                      expected += cells.at(Point{x + 1, y + 1}).isAlive();
+                  }
+                }
+                REQUIRE(table.sumDiamond(column, row) == expected);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("Random worlds of odd and even sizes") {
+    for (TOPOLOGY topology : { BOUNDED, TORUS }) {
+      for (Dimensions size : { Dimensions{7, 5}, Dimensions{8, 6}, Dimensions{5, 9}, Dimensions{1, 3} }) {
+        CellGrid cells;
+        cells.reset(size.WIDTH + 2, size.HEIGHT + 2);
+        cells.setTopology(topology);
+        srand(size.WIDTH * 31 + size.HEIGHT);
+        for (int y = 1; y <= size.HEIGHT; y++)
+          for (int x = 1; x <= size.WIDTH; x++)
+            cells[Point{x, y}] = Cell(false, rand() % 2 == 0 ? GIVE_CELL_LIFE : DO_NOTHING);
+
+        THEN("Every diamond should match counting its cells one by one") {
+          for (int radius = 0; radius <= size.WIDTH + size.HEIGHT; radius++) {
+            SummedAreaTable table;
+            table.buildDiamonds(cells, radius);
+            for (int row = 0; row < size.HEIGHT; row++) {
+              for (int column = 0; column < size.WIDTH; column++) {
+                int expected = 0;
+                for (int y = 0; y < size.HEIGHT; y++) {
+                  for (int x = 0; x < size.WIDTH; x++) {
+                    int dx = abs(x - column), dy = abs(y - row);
+                    if (topology == TORUS) {
+                      dx = min(dx, size.WIDTH - dx);
+                      dy = min(dy, size.HEIGHT - dy);
+                    }
+                    if (dx + dy <= radius)
+                      expected += cells.at(Point{x + 1, y + 1}).isAlive();
+                  }
+                }
+                REQUIRE(table.sumDiamond(column, row) == expected);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,86 @@
+/**
+ * @file test-Viewport.cpp
+ * @brief Unit tests for the class Viewport.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "Viewport.h"
+
+SCENARIO("Showing a world through a Viewport", "[Viewport]") {
+  GIVEN("A viewport of 10x5 characters") {
+    Viewport viewport;
+    viewport.setScreen(Dimensions{10, 5});
+
+    THEN("Worlds that fit should be shown one character per cell") {
+      REQUIRE(viewport.showsCells(Dimensions{10, 5}) == true);
+      REQUIRE(viewport.showsCells(Dimensions{11, 5}) == false);
+    }
+
+    THEN("Larger worlds should be scaled to fit the braille dots") {
+      REQUIRE(viewport.getScale(Dimensions{20, 20}) == 1);
+      REQUIRE(viewport.getScale(Dimensions{21, 20}) == 2);
+      REQUIRE(viewport.getScale(Dimensions{100000, 100000}) == 5000);
+    }
+
+    THEN("Zooming should halve and double the cells per dot") {
+      viewport.setZoom(4);
+      viewport.zoomIn();
+      REQUIRE(viewport.getZoom() == 2);
+      viewport.zoomOut();
+      viewport.zoomOut();
+      REQUIRE(viewport.getZoom() == 8);
+      REQUIRE(viewport.getScale(Dimensions{21, 20}) == 8);
+    }
+
+    THEN("The origin should be kept inside the world") {
+      viewport.pan(50, -3);
+      Point origin = viewport.getClampedOrigin(Dimensions{30, 30});
+      REQUIRE(origin.x == 29);
+      REQUIRE(origin.y == 0);
+    }
+  }
+
+  GIVEN("A world of 4x4 cells with a full 2x2 block in the top left") {
+    PopulationConfig config;
+    config.worldSize = Dimensions{4, 4};
+    config.density = 0.0;
+    Population cells(config);
+    cells.initiatePopulation("conway");
+    const uint64_t block[2] = {0x3, 0x3};
+    cells.writeRegion(0, 0, 2, 2, block, 1);
+
+    Viewport viewport;
+    viewport.setScreen(Dimensions{1, 1});
+
+    WHEN("It is rendered in braille at one cell per dot") {
+      viewport.setZoom(1);
+      vector<string> lines = viewport.render(cells);
+
+      THEN("The top left 2x2 dots should be set in the first glyph") {
+        REQUIRE(lines.size() == 1);
+        REQUIRE(lines[0] == "⠛");
+      }
+    }
+
+    WHEN("It is rendered in braille at two cells per dot") {
+      viewport.setZoom(2);
+      vector<string> lines = viewport.render(cells);
+
+      THEN("Only the top left dot should be set") {
+        REQUIRE(lines[0] == "⠁");
+      }
+    }
+
+    WHEN("It is rendered in half blocks at two cells per dot") {
+      viewport.setZoom(2);
+      viewport.setGlyphs(HALF_BLOCKS);
+      vector<string> lines = viewport.render(cells);
+
+      THEN("The glyph should be an upper half block") {
+        REQUIRE(lines[0] == "▀");
+      }
+    }
+  }
+}
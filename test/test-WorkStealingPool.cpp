@@ -0,0 +1,59 @@
+/**
+ * @file test-WorkStealingPool.cpp
+ * @brief Unit tests for the class WorkStealingPool.
+ * @version 0.1
+ * @date 2018-11-04
+ */
+
+#include <catch.hpp>
+#include "Support/WorkStealingPool.h"
+
+SCENARIO("Running tasks on a WorkStealingPool", "[WorkStealingPool]") {
+  GIVEN("A pool with four workers") {
+    WorkStealingPool pool(4);
+
+    WHEN("Many tasks are submitted and waited for") {
+      atomic<int> sum(0);
+      for (int i = 1; i <= 1000; i++)
+        pool.submit([&sum, i] { sum += i; });
+      pool.waitForAll();
+
+      THEN("All of them should have run") {
+        REQUIRE(sum == 500500);
+      }
+    }
+
+    WHEN("Tasks submit tasks of their own") {
+      atomic<int> count(0);
+      for (int i = 0; i < 10; i++) {
+        pool.submit([&pool, &count] {
+          for (int j = 0; j < 10; j++)
+            pool.submit([&count] { count++; });
+        });
+      }
+      pool.waitForAll();
+
+      THEN("The nested tasks should have run as well") {
+        REQUIRE(count == 100);
+      }
+    }
+
+    WHEN("A parallel for loop is nested inside tasks") {
+      vector<int> values(4000, 0);
+      for (int block = 0; block < 4; block++) {
+        pool.submit([&pool, &values, block] {
+          pool.parallelFor(block * 1000, (block + 1) * 1000, 64, [&values](int begin, int end) {
+            for (int i = begin; i < end; i++)
+              values[i] = i;
+          });
+        });
+      }
+      pool.waitForAll();
+
+      THEN("Every index should have been visited exactly once") {
+        for (int i = 0; i < 4000; i++)
+          REQUIRE(values[i] == i);
+      }
+    }
+  }
+}
@@ -35,7 +35,7 @@ SCENARIO("Testing MainArgumentsParser", "[MainArgumentsParser]") {
       ApplicationValues appValues = parser.runParser(argv, argc);
       
       THEN("Filename should be set to argument value and simulation should run") {
-        REQUIRE(fileName == "Population_Seed.txt");
+        REQUIRE(appValues.fileName == "Population_Seed.txt");
         REQUIRE(appValues.runSimulation == true);
       } 
     }
@@ -71,8 +71,8 @@ SCENARIO("Testing MainArgumentsParser", "[MainArgumentsParser]") {
       ApplicationValues appValues = parser.runParser(argv, argc);
 
       THEN("The dimensions should be updated and simulation should run.") {
-        REQUIRE(WORLD_DIMENSIONS.WIDTH == 10);
-        REQUIRE(WORLD_DIMENSIONS.HEIGHT == 10);
+        REQUIRE(appValues.worldSize.WIDTH == 10);
+        REQUIRE(appValues.worldSize.HEIGHT == 10);
         REQUIRE(appValues.runSimulation == true);
       }
     }
@@ -119,6 +119,172 @@ SCENARIO("Testing MainArgumentsParser", "[MainArgumentsParser]") {
       }
     }
 
+    WHEN("It is passed --seed and --density") {
+      // Create own argc and argv to parse.
+      int argc = 5;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--seed"), strdup("12345"), strdup("--density"), strdup("0.3")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("Seed and density should be updated and simulation should run.") {
+        REQUIRE(appValues.seed == 12345);
+        REQUIRE(appValues.density == Approx(0.3));
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed --topology torus") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--topology"), strdup("torus")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("Topology should be updated and simulation should run.") {
+        REQUIRE(appValues.topology == TORUS);
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed --engine event") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--engine"), strdup("event")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("Engine should be updated and simulation should run.") {
+        REQUIRE(appValues.engine == EVENT_ENGINE);
+        REQUIRE(appValues.getPopulationConfig().engine == EVENT_ENGINE);
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed --engine chunk") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--engine"), strdup("chunk")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("Engine should be updated and simulation should run.") {
+        REQUIRE(appValues.engine == CHUNK_ENGINE);
+        REQUIRE(appValues.getPopulationConfig().engine == CHUNK_ENGINE);
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed --schedule") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--schedule"), strdup("conway*100;von_neumann*5")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("The schedule should be set and simulation should run.") {
+        REQUIRE(appValues.ruleSchedule.getEntries().size() == 2);
+        REQUIRE(appValues.ruleSchedule.getEntries()[1].ruleName == "von_neumann");
+        REQUIRE(appValues.ruleSchedule.getPeriod() == 105);
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed --live-view") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--live-view"), strdup("/gameoflife")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("The name should be set and simulation should run.") {
+        REQUIRE(appValues.liveViewName == "/gameoflife");
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed --live-view without a leading slash") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--live-view"), strdup("gameoflife")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("Simulation should not run.") {
+        REQUIRE(appValues.runSimulation == false);
+      }
+    }
+
+    WHEN("It is passed --sweep") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--sweep"), strdup("sweep.txt")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("The spec file should be set and simulation should run.") {
+        REQUIRE(appValues.sweepFile == "sweep.txt");
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed --rule-map") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--rule-map"), strdup("test/populations/regions.txt")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("Both rules should be set to the map and simulation should run.") {
+        REQUIRE(appValues.evenRuleName == "map:test/populations/regions.txt");
+        REQUIRE(appValues.oddRuleName == "map:test/populations/regions.txt");
+        REQUIRE(appValues.runSimulation == true);
+      }
+    }
+
+    WHEN("It is passed a malformed --schedule") {
+      // Create own argc and argv to parse.
+      int argc = 3;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--schedule"), strdup("conway*0")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+
+      THEN("Simulation should not run.") {
+        REQUIRE(appValues.runSimulation == false);
+      }
+    }
+
+    WHEN("It is passed --zoom, --pan and --glyphs") {
+      // Create own argc and argv to parse.
+      int argc = 7;
+      char* argv[] = {strdup("./GameOfLife"), strdup("--zoom"), strdup("4"), strdup("--pan"), strdup("10,20"),
+                      strdup("--glyphs"), strdup("halfblock")};
+
+      // Run parser.
+      ApplicationValues appValues = parser.runParser(argv, argc);
+      Viewport& viewport = ScreenPrinter::getInstance().getViewport();
+
+      THEN("The viewport should be updated and simulation should run.") {
+        REQUIRE(viewport.getZoom() == 4);
+        REQUIRE(viewport.getOrigin().x == 10);
+        REQUIRE(viewport.getOrigin().y == 20);
+        REQUIRE(viewport.getGlyphs() == HALF_BLOCKS);
+        REQUIRE(appValues.runSimulation == true);
+      }
+
+      // Restore the default viewport for other tests.
+      viewport = Viewport();
+    }
+
     WHEN("It is passed -x, invalid argument") {
       // See what is printed with ostringstream and streambuf.
       std::ostringstream outStream;
@@ -12,14 +12,30 @@
 
 #include <catch.hpp>
 #include "../include/Cell_Culture/Population.h"
+#include <thread>
+
+// Returns the configuration of a population randomized with seed.
+static PopulationConfig randomConfig(Dimensions worldSize, uint64_t seed, double density = 0.5,
+                                     TOPOLOGY topology = BOUNDED) {
+  PopulationConfig config;
+  config.worldSize = worldSize;
+  config.seed = seed;
+  config.density = density;
+  config.topology = topology;
+  return config;
+}
+
+// Returns the configuration of a population read from fileName.
+static PopulationConfig fileConfig(string fileName, TOPOLOGY topology = BOUNDED) {
+  PopulationConfig config;
+  config.fileName = fileName;
+  config.topology = topology;
+  return config;
+}
 
 // Test of board size and standard initialization.
-SCENARIO("Using a default population size 80x24 (defined in globals.cpp", "[Population]") {
+SCENARIO("Using a default population size 80x24 (defined in PopulationConfig)", "[Population]") {
   GIVEN("Default population that is initialized with default rule 'conway'") {
-    // Set globals to default in case other test modified it:
-    WORLD_DIMENSIONS = {80, 24};
-    fileName = "";
-
     Population pop;
     pop.initiatePopulation("conway");
 
@@ -34,12 +50,12 @@ SCENARIO("Using good 5x5 population 'good.txt'", "[Population]") {
   GIVEN("Population is initialized by file good.txt with default rule 'conway'") {
     // Compability for windows build.
     #ifdef _WIN32
-      fileName = "../test/populations/good.txt";
+      string fileName = "../test/populations/good.txt";
     #else
-      fileName = "test/populations/good.txt";
+      string fileName = "test/populations/good.txt";
     #endif
     
-    Population pop;
+    Population pop(fileConfig(fileName));
     pop.initiatePopulation("conway");
     
     THEN("Total should be (5+2)*(5+2) = 49") {
@@ -72,12 +88,12 @@ SCENARIO("Using good 10x10 population 'good2.txt'", "[Population]") {
   GIVEN("Population is initialized by file good2.txt with default rule 'conway'") {
     // Compability for windows build.
     #ifdef _WIN32
-      fileName = "../test/populations/good2.txt";
+      string fileName = "../test/populations/good2.txt";
     #else
-      fileName = "test/populations/good2.txt";
+      string fileName = "test/populations/good2.txt";
     #endif
 
-    Population pop;
+    Population pop(fileConfig(fileName));
     pop.initiatePopulation("conway");
     
     THEN("Total should be (10+2)*(10+2) = 144") {
@@ -110,12 +126,12 @@ SCENARIO("If empty or non-existing file is given error should be thrown", "[Popu
   GIVEN("Empty file is given at program start") {
     // Compability for windows build.
     #ifdef _WIN32
-      fileName = "../test/populations/empty.txt";
+      string fileName = "../test/populations/empty.txt";
     #else
-      fileName = "test/populations/empty.txt";
+      string fileName = "test/populations/empty.txt";
     #endif
 
-    Population pop;
+    Population pop(fileConfig(fileName));
     
     THEN("Error should be thrown when initializing the population") {
       REQUIRE_THROWS(pop.initiatePopulation("conway"));
@@ -123,8 +139,7 @@ SCENARIO("If empty or non-existing file is given error should be thrown", "[Popu
   }
 
   GIVEN("Non-existing file is given at program start") {
-    fileName = "test/populations/doesNotExist.txt";
-    Population pop;
+    Population pop(fileConfig("test/populations/doesNotExist.txt"));
 
     THEN("Error should be thrown when initializing the population") {
       REQUIRE_THROWS(pop.initiatePopulation("conway"));
@@ -137,12 +152,12 @@ SCENARIO("File with bad/corrupted input is given", "[Population]") {
   GIVEN("File with bad input is given at program start") {
     // Compability for windows build.
     #ifdef _win32
-      fileName = "../test/populations/bad.txt";
+      string fileName = "../test/populations/bad.txt";
     #else
-      fileName = "test/populations/bad.txt";
+      string fileName = "test/populations/bad.txt";
     #endif
 
-    Population pop;
+    Population pop(fileConfig(fileName));
     
     THEN("Error should be thrown when initializing the population") {
       REQUIRE_THROWS(pop.initiatePopulation("conway"));
@@ -151,15 +166,518 @@ SCENARIO("File with bad/corrupted input is given", "[Population]") {
 
   GIVEN("File with another bad input is given at program start") {
     #ifdef _win32
-      fileName = "../test/populations/bad2.txt";
+      string fileName = "../test/populations/bad2.txt";
     #else
-      fileName = "test/populations/bad2.txt";
+      string fileName = "test/populations/bad2.txt";
     #endif
 
-    Population pop;
+    Population pop(fileConfig(fileName));
     
     THEN("Error should be thrown when initializing the population") {
       REQUIRE_THROWS(pop.initiatePopulation("conway"));
     }
   }
-}
\ No newline at end of file
+}
+// Test of reproducible randomization
+SCENARIO("Randomizing populations with a seed", "[Population]") {
+  GIVEN("Two populations with the same seed and one with another seed") {
+    Population first(randomConfig({100, 30}, 2018)), second(randomConfig({100, 30}, 2018)),
+               other(randomConfig({100, 30}, 2019));
+    first.initiatePopulation("conway");
+    second.initiatePopulation("conway");
+    other.initiatePopulation("conway");
+
+    THEN("Populations with the same seed should be identical") {
+      for (int row = 1; row <= 30; row++) {
+        for (int column = 1; column <= 100; column++) {
+          REQUIRE(first.getCellAtPosition(Point{column, row}).isAlive()
+                  == second.getCellAtPosition(Point{column, row}).isAlive());
+        }
+      }
+    }
+
+    THEN("Populations with different seeds should differ") {
+      int differences = 0;
+      for (int row = 1; row <= 30; row++) {
+        for (int column = 1; column <= 100; column++) {
+          if (first.getCellAtPosition(Point{column, row}).isAlive()
+              != other.getCellAtPosition(Point{column, row}).isAlive())
+            differences++;
+        }
+      }
+      REQUIRE(differences > 0);
+    }
+  }
+
+  GIVEN("Populations randomized with density 0 and 1") {
+    Population empty(randomConfig({100, 30}, 1, 0.0)), full(randomConfig({100, 30}, 1, 1.0));
+    empty.initiatePopulation("conway");
+    full.initiatePopulation("conway");
+
+    THEN("All cells should be dead or alive respectively") {
+      for (int row = 1; row <= 30; row++) {
+        for (int column = 1; column <= 100; column++) {
+          REQUIRE(empty.getCellAtPosition(Point{column, row}).isAlive() == false);
+          REQUIRE(full.getCellAtPosition(Point{column, row}).isAlive() == true);
+        }
+      }
+    }
+
+    THEN("Rim cells should still be created") {
+      REQUIRE(full.getCellAtPosition(Point{0, 0}).isRimCell() == true);
+      REQUIRE(full.getCellAtPosition(Point{101, 31}).isRimCell() == true);
+    }
+  }
+}
+
+// Test of a world that wraps around
+SCENARIO("A glider travelling across the edges of a torus", "[Population]") {
+  GIVEN("A glider in an 8x8 world, once bounded and once a torus") {
+    #ifdef _WIN32
+      string fileName = "../test/populations/glider.txt";
+    #else
+      string fileName = "test/populations/glider.txt";
+    #endif
+
+    Population bounded(fileConfig(fileName, BOUNDED)), torus(fileConfig(fileName, TORUS));
+    bounded.initiatePopulation("conway");
+    torus.initiatePopulation("conway");
+
+    // The board shown lags one generation behind, so start after the first.
+    bounded.calculateNewGeneration();
+    torus.calculateNewGeneration();
+    vector<bool> start;
+    for (int row = 1; row <= 8; row++) {
+      for (int column = 1; column <= 8; column++)
+        start.push_back(torus.getCellAtPosition(Point{column, row}).isAlive());
+    }
+
+    WHEN("32 generations pass, moving the glider 8 cells diagonally") {
+      for (int generation = 0; generation < 32; generation++) {
+        bounded.calculateNewGeneration();
+        torus.calculateNewGeneration();
+      }
+
+      THEN("The glider should be back where it started on the torus") {
+        for (int row = 1; row <= 8; row++) {
+          for (int column = 1; column <= 8; column++)
+            REQUIRE(torus.getCellAtPosition(Point{column, row}).isAlive() == start[(row - 1) * 8 + column - 1]);
+        }
+      }
+
+      THEN("The glider should have crashed into the edge of the bounded world") {
+        int differences = 0;
+        for (int row = 1; row <= 8; row++) {
+          for (int column = 1; column <= 8; column++) {
+            if (bounded.getCellAtPosition(Point{column, row}).isAlive() != start[(row - 1) * 8 + column - 1])
+              differences++;
+          }
+        }
+        REQUIRE(differences > 0);
+      }
+    }
+  }
+}
+
+// Test of applying the rules in the order of a schedule.
+SCENARIO("Following a rule schedule", "[Population]") {
+  GIVEN("A random 20x12 population run by 'conway*2;von_neumann*3'") {
+    RuleSchedule schedule;
+    REQUIRE(schedule.parse("conway*2;von_neumann*3"));
+    Population pop(randomConfig({20, 12}, 42, 0.4));
+    pop.initiatePopulation(schedule);
+
+    // the same world stepped by hand, committing every cell before each rule
+    CellGrid cells = pop.getCells();
+    RuleOfExistence* conway = RuleFactory::getInstance().createAndReturnRule(cells, "conway");
+    RuleOfExistence* vonNeumann = RuleFactory::getInstance().createAndReturnRule(cells, "von_neumann");
+
+    WHEN("Two periods of the schedule pass") {
+      bool same = true;
+      for (int generation = 0; generation < 10; generation++) {
+        pop.calculateNewGeneration();
+
+        for (int i = 0; i < cells.size(); i++)
+          cells[i].updateState();
+        (generation % 5 < 2 ? conway : vonNeumann)->executeRule();
+
+        for (int i = 0; i < cells.size(); i++) {
+          if (cells[i].isAlive() != pop.getCells()[i].isAlive()
+              || cells[i].getNextGenerationAction() != pop.getCells()[i].getNextGenerationAction())
+            same = false;
+        }
+      }
+
+      THEN("Each generation should have been run by the scheduled rule") {
+        REQUIRE(same);
+      }
+    }
+
+    delete conway;
+    delete vonNeumann;
+  }
+}
+
+// Test of populations of their own configuration running side by side.
+SCENARIO("Populations of different sizes running on their own threads", "[Population]") {
+  GIVEN("Three random populations of different sizes, seeds and topologies") {
+    vector<PopulationConfig> configs = { randomConfig({30, 20}, 3, 0.4), randomConfig({64, 9}, 5, 0.5, TORUS),
+                                         randomConfig({17, 41}, 8, 0.3) };
+
+    // the same populations run one after the other
+    vector<vector<bool>> expected;
+    for (const PopulationConfig& config : configs) {
+      Population pop(config);
+      pop.initiatePopulation("conway");
+      for (int generation = 0; generation < 25; generation++)
+        pop.calculateNewGeneration();
+      vector<bool> alive;
+      for (int i = 0; i < pop.getCells().size(); i++)
+        alive.push_back(pop.getCells()[i].isAlive());
+      expected.push_back(alive);
+    }
+
+    WHEN("Each population is run on a thread of its own") {
+      vector<vector<bool>> results(configs.size());
+      vector<thread> threads;
+      for (size_t index = 0; index < configs.size(); index++) {
+        threads.emplace_back([&configs, &results, index]() {
+          Population pop(configs[index]);
+          pop.initiatePopulation("conway");
+          for (int generation = 0; generation < 25; generation++)
+            pop.calculateNewGeneration();
+          for (int i = 0; i < pop.getCells().size(); i++)
+            results[index].push_back(pop.getCells()[i].isAlive());
+        });
+      }
+      for (thread& worker : threads)
+        worker.join();
+
+      THEN("Every population should match the one run on its own") {
+        for (size_t index = 0; index < configs.size(); index++)
+          REQUIRE(results[index] == expected[index]);
+      }
+    }
+  }
+}
+
+// Test of reading and stamping rectangles of cells.
+SCENARIO("Reading and writing regions of the world", "[Population]") {
+  GIVEN("A random 100x20 torus") {
+    Population pop(randomConfig({100, 20}, 13, 0.5, TORUS));
+    pop.initiatePopulation("conway");
+    pop.calculateNewGeneration();
+
+    WHEN("A region reaching past the right edge is read as bits and bytes") {
+      vector<uint64_t> bitmap(2 * 4, ~0ULL);
+      vector<uint8_t> bytes(70 * 4, 2);
+      pop.readRegion(40, 5, 70, 4, bitmap.data(), 2);
+      pop.readRegion(40, 5, 70, 4, bytes.data());
+
+      THEN("Both should hold the cells, dead outside the world") {
+        for (int y = 0; y < 4; y++) {
+          for (int x = 0; x < 70; x++) {
+            bool alive = 40 + x < 100 && pop.getCellAtPosition(Point{41 + x, 6 + y}).isAlive();
+            REQUIRE(((bitmap[y * 2 + x / 64] >> (x % 64)) & 1) == alive);
+            REQUIRE(bytes[y * 70 + x] == alive);
+          }
+          REQUIRE((bitmap[y * 2 + 1] >> 6) == 0);
+        }
+      }
+    }
+
+    WHEN("What was read is stamped back") {
+      CellGrid before = pop.getCells();
+      vector<uint64_t> bitmap(2 * 20);
+      pop.readRegion(0, 0, 100, 20, bitmap.data(), 2);
+      pop.writeRegion(0, 0, 100, 20, bitmap.data(), 2);
+
+      THEN("Every cell should keep its state and age, also once committed") {
+        bool same = true;
+        for (int i = 0; i < before.size(); i++) {
+          Cell& cell = pop.getCells()[i];
+          if (before[i].isAlive() != cell.isAlive() || before[i].getAge() != cell.getAge()
+              || (!cell.isRimCell() && cell.isAliveAfterUpdate() != cell.isAlive()))
+            same = false;
+        }
+        REQUIRE(same);
+      }
+    }
+
+  }
+
+  GIVEN("A blinker in a bounded 5x5 world, one generation in") {
+    Population pop(randomConfig({5, 5}, 1, 0.0));
+    pop.initiatePopulation("conway");
+    uint64_t blinker = 0x0E;
+    pop.writeRegion(0, 2, 5, 1, &blinker, 1);
+    pop.calculateNewGeneration();
+
+    WHEN("Its row is stamped full, over cells about to die, and a generation is calculated") {
+      uint64_t full = 0x1F;
+      pop.writeRegion(0, 2, 5, 1, &full, 1);
+      pop.calculateNewGeneration();
+
+      THEN("The row should be as stamped, the cells around it as the blinker left them") {
+        uint64_t rows[5];
+        pop.readRegion(0, 0, 5, 5, rows, 1);
+        REQUIRE(rows[0] == 0);
+        REQUIRE(rows[1] == 0x04);
+        REQUIRE(rows[2] == full);
+        REQUIRE(rows[3] == 0x04);
+        REQUIRE(rows[4] == 0);
+      }
+    }
+  }
+
+  GIVEN("An empty 100x20 torus") {
+    Population pop(randomConfig({100, 20}, 13, 0.0, TORUS));
+    pop.initiatePopulation("conway");
+
+    WHEN("A blinker is stamped in the top row") {
+      uint64_t blinker = 0x0E;
+      pop.writeRegion(48, 0, 5, 1, &blinker, 1);
+
+      THEN("The stamped cells should show, the halo included") {
+        REQUIRE(pop.getCellAtPosition(Point{50, 1}).isAlive() == true);
+        REQUIRE(pop.getCellAtPosition(Point{51, 1}).isAlive() == true);
+        REQUIRE(pop.getCellAtPosition(Point{52, 1}).isAlive() == true);
+        REQUIRE(pop.getCellAtPosition(Point{49, 1}).isAlive() == false);
+        REQUIRE(pop.getCellAtPosition(Point{51, 20}).isAlive() == false);
+        REQUIRE(pop.getCellAtPosition(Point{51, 21}).isAlive() == true);
+      }
+
+      AND_THEN("The blinker should oscillate across the edge") {
+        pop.calculateNewGeneration();
+        pop.calculateNewGeneration();
+        REQUIRE(pop.getCellAtPosition(Point{51, 20}).isAlive() == true);
+        REQUIRE(pop.getCellAtPosition(Point{51, 1}).isAlive() == true);
+        REQUIRE(pop.getCellAtPosition(Point{51, 2}).isAlive() == true);
+        REQUIRE(pop.getCellAtPosition(Point{50, 1}).isAlive() == false);
+      }
+    }
+  }
+}
+
+// Test of reusing a population for another world of the same size.
+SCENARIO("Restarting a population with another seed", "[Population]") {
+  GIVEN("A population run by 'erik;345/2/4' for a while") {
+    RuleSchedule schedule;
+    REQUIRE(schedule.parse("erik;345/2/4"));
+    Population pop(randomConfig({30, 20}, 1, 0.5, TORUS));
+    pop.initiatePopulation(schedule);
+    for (int generation = 0; generation < 9; generation++)
+      pop.calculateNewGeneration();
+
+    WHEN("It is restarted and run next to a new population of the new seed") {
+      pop.restart(2, 0.4);
+      Population fresh(randomConfig({30, 20}, 2, 0.4, TORUS));
+      fresh.initiatePopulation(schedule);
+
+      THEN("Both should run the same generations") {
+        bool same = true;
+        for (int generation = 0; generation < 12; generation++) {
+          REQUIRE(pop.calculateNewGeneration() == fresh.calculateNewGeneration());
+          for (int i = 0; i < fresh.getCells().size(); i++) {
+            if (pop.getCells()[i].isAlive() != fresh.getCells()[i].isAlive()
+                || pop.getCells()[i].getColor() != fresh.getCells()[i].getColor())
+              same = false;
+          }
+        }
+        REQUIRE(same);
+      }
+    }
+  }
+}
+
+SCENARIO("Resuming a population from a board", "[Population]") {
+  GIVEN("A population run by 'conway*2;von_neumann*3' for 7 generations") {
+    RuleSchedule schedule;
+    REQUIRE(schedule.parse("conway*2;von_neumann*3"));
+    Population pop(randomConfig({30, 20}, 5, 0.4, TORUS));
+    pop.initiatePopulation(schedule);
+    for (int generation = 0; generation < 8; generation++)
+      pop.calculateNewGeneration();
+    REQUIRE(pop.canResume());
+
+    WHEN("A new population of another seed is resumed from its board") {
+      vector<uint64_t> board(20);
+      pop.readRegion(0, 0, 30, 20, board.data(), 1);
+      Population resumed(randomConfig({30, 20}, 6, 0.4, TORUS));
+      resumed.initiatePopulation(schedule);
+      resumed.resume(board.data(), 1, 7);
+
+      THEN("Both should run the same generations") {
+        // the board read is generation 7, committed once 8 is calculated
+        REQUIRE(resumed.calculateNewGeneration() == 8);
+        bool same = true;
+        for (int generation = 0; generation < 12; generation++) {
+          for (int i = 0; i < pop.getCells().size(); i++) {
+            if (pop.getCells()[i].isAlive() != resumed.getCells()[i].isAlive())
+              same = false;
+          }
+          REQUIRE(pop.calculateNewGeneration() == resumed.calculateNewGeneration());
+        }
+        REQUIRE(same);
+      }
+    }
+  }
+
+  GIVEN("Populations run by rules that remember more than the board") {
+    Population erik(randomConfig({10, 10}, 1, 0.5, BOUNDED));
+    erik.initiatePopulation("erik");
+    Population stars(randomConfig({10, 10}, 1, 0.5, BOUNDED));
+    stars.initiatePopulation("star_wars");
+    Population twoStates(randomConfig({10, 10}, 1, 0.5, BOUNDED));
+    twoStates.initiatePopulation("23/3/2");
+
+    THEN("Only the two state rule should be resumable") {
+      REQUIRE_FALSE(erik.canResume());
+      REQUIRE_FALSE(stars.canResume());
+      REQUIRE(twoStates.canResume());
+    }
+  }
+}
+
+SCENARIO("Calculating generations with the event engine", "[Population]") {
+  GIVEN("Populations run by 'conway*2;von_neumann' on the grid and by events") {
+    RuleSchedule schedule;
+    REQUIRE(schedule.parse("conway*2;von_neumann"));
+    for (TOPOLOGY topology : {BOUNDED, TORUS}) {
+      Population grid(randomConfig({30, 20}, 3, 0.4, topology));
+      grid.initiatePopulation(schedule);
+      PopulationConfig config = randomConfig({30, 20}, 3, 0.4, topology);
+      config.engine = EVENT_ENGINE;
+      Population events(config);
+      events.initiatePopulation(schedule);
+      REQUIRE(events.getEngine() == EVENT_ENGINE);
+
+      WHEN("They are stamped with a glider halfway and the engines swap for a while") {
+        THEN("Every cell should be alike, halo included, generation after generation") {
+          const uint64_t glider[3] = {0x2, 0x4, 0x7};
+          bool same = true;
+          for (int generation = 0; generation < 40; generation++) {
+            if (generation == 15) {
+              grid.writeRegion(27, 17, 3, 3, glider, 1);
+              events.writeRegion(27, 17, 3, 3, glider, 1);
+            }
+            if (generation == 25 || generation == 30)
+              events.setEngine(generation == 25 ? GRID_ENGINE : EVENT_ENGINE);
+            REQUIRE(grid.calculateNewGeneration() == events.calculateNewGeneration());
+
+            for (int i = 0; i < grid.getCells().size(); i++) {
+              Cell& cell = grid.getCells()[i];
+              Cell& other = events.getCells()[i];
+              if (cell.isAlive() != other.isAlive() || cell.isAliveAfterUpdate() != other.isAliveAfterUpdate()
+                  || cell.getColor() != other.getColor())
+                same = false;
+            }
+          }
+          REQUIRE(same);
+        }
+      }
+    }
+  }
+
+  GIVEN("A population run by 'erik' asking for the event engine") {
+    PopulationConfig config = randomConfig({10, 10}, 1);
+    config.engine = EVENT_ENGINE;
+    Population erik(config);
+    erik.initiatePopulation("erik");
+
+    THEN("It should stay on the grid") {
+      REQUIRE(erik.getEngine() == GRID_ENGINE);
+    }
+  }
+}
+
+SCENARIO("Calculating generations with the chunk and adaptive engines", "[Population]") {
+  GIVEN("Populations run by 'conway*2;von_neumann' on the grid and by chunks") {
+    RuleSchedule schedule;
+    REQUIRE(schedule.parse("conway*2;von_neumann"));
+    for (TOPOLOGY topology : {BOUNDED, TORUS}) {
+      Population grid(randomConfig({100, 70}, 3, 0.4, topology));
+      grid.initiatePopulation(schedule);
+      PopulationConfig config = randomConfig({100, 70}, 3, 0.4, topology);
+      config.engine = CHUNK_ENGINE;
+      Population chunks(config);
+      chunks.initiatePopulation(schedule);
+      REQUIRE(chunks.getEngine() == CHUNK_ENGINE);
+
+      WHEN("They are stamped with a glider halfway and the engine changes a few times") {
+        THEN("Every cell should be alike, halo included, generation after generation") {
+          const uint64_t glider[3] = {0x2, 0x4, 0x7};
+          const ENGINE engines[] = {EVENT_ENGINE, CHUNK_ENGINE, GRID_ENGINE, CHUNK_ENGINE};
+          bool same = true;
+          for (int generation = 0; generation < 45; generation++) {
+            if (generation == 15) {
+              grid.writeRegion(97, 67, 3, 3, glider, 1);
+              chunks.writeRegion(97, 67, 3, 3, glider, 1);
+            }
+            if (generation >= 20 && generation % 5 == 0 && generation < 40)
+              chunks.setEngine(engines[(generation - 20) / 5]);
+            REQUIRE(grid.calculateNewGeneration() == chunks.calculateNewGeneration());
+
+            for (int i = 0; i < grid.getCells().size(); i++) {
+              Cell& cell = grid.getCells()[i];
+              Cell& other = chunks.getCells()[i];
+              if (cell.isAlive() != other.isAlive() || cell.isAliveAfterUpdate() != other.isAliveAfterUpdate()
+                  || cell.getColor() != other.getColor())
+                same = false;
+            }
+          }
+          REQUIRE(same);
+        }
+      }
+    }
+  }
+
+  GIVEN("Two gliders in an empty 200x200 torus run by the adaptive engine") {
+    PopulationConfig config = randomConfig({200, 200}, 1, 0.0, TORUS);
+    config.engine = ADAPTIVE_ENGINE;
+    Population gliders(config);
+    gliders.initiatePopulation("conway");
+    Population grid(randomConfig({200, 200}, 1, 0.0, TORUS));
+    grid.initiatePopulation("conway");
+    const uint64_t glider[3] = {0x2, 0x4, 0x7};
+    for (Population* population : {&gliders, &grid}) {
+      population->writeRegion(10, 20, 3, 3, glider, 1);
+      population->writeRegion(150, 100, 3, 3, glider, 1);
+    }
+
+    WHEN("It runs for a while") {
+      for (int generation = 0; generation < 2 * Population::ENGINE_SAMPLE_INTERVAL; generation++) {
+        gliders.calculateNewGeneration();
+        grid.calculateNewGeneration();
+      }
+
+      THEN("It should have moved to the event engine and kept the same cells") {
+        REQUIRE(gliders.getEngine() == EVENT_ENGINE);
+        const EngineSample& sample = gliders.getEngineSample();
+        REQUIRE(sample.generation == Population::ENGINE_SAMPLE_INTERVAL + 1);
+        REQUIRE(sample.density == Approx(10.0 / 40000));
+        REQUIRE(sample.activity > 0);
+        REQUIRE(sample.boxCorner.x >= 10);
+        REQUIRE(sample.boxSize.WIDTH <= 150);
+        REQUIRE(sample.boxSize.HEIGHT <= 90);
+
+        vector<uint64_t> bitmap(200 * 4), gridBitmap(200 * 4);
+        gliders.readRegion(0, 0, 200, 200, bitmap.data(), 4);
+        grid.readRegion(0, 0, 200, 200, gridBitmap.data(), 4);
+        REQUIRE(bitmap == gridBitmap);
+      }
+    }
+  }
+
+  GIVEN("A population run by 'erik' asking for the adaptive engine") {
+    PopulationConfig config = randomConfig({10, 10}, 1);
+    config.engine = ADAPTIVE_ENGINE;
+    Population erik(config);
+    erik.initiatePopulation("erik");
+
+    THEN("It should stay on the grid") {
+      erik.calculateNewGeneration();
+      REQUIRE(erik.getEngine() == GRID_ENGINE);
+    }
+  }
+}